@@ -38,6 +38,7 @@
 #include "Map.h"
 #include "MotionMaster.h"
 #include "MovementGenerator.h"
+#include "PathGenerator.h"
 #include "ObjectAccessor.h"
 #include "Opcodes.h"
 #include "WorldPacket.h"
@@ -45,6 +46,7 @@
 #include "ScriptedGossip.h"
 #include "TemporarySummon.h"
 #include "CellImpl.h"
+#include "CharacterCache.h"
 #include "Corpse.h"
 #include "GridNotifiers.h"
 #include "GridNotifiersImpl.h"
@@ -55,7 +57,12 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <functional>
+#include <limits>
 #include <random>
 #include <thread>
 
@@ -139,14 +146,17 @@ EverQuestMod::EverQuestMod() :
     ConfigTrackingMaxResults(0),
     ConfigTrackingPulseIntervalInMS(5000),
     ConfigGroupZoneWideLootAndExperienceEnabled(true),
-    CrossClassExemptSpellIDsBuilt(false),
-    IllusionMaxFaceIndex(0)
+    ConfigPathingBakedWaypointLegFile("everquest_baked_waypoint_legs.bin"),
+    ConfigStartupDataLoadThreadCount(4),
+    ConfigStartupDataSnapshotFile(""),
+    CrossClassExemptSpellIDsBuilt(false)
 {
 }
 
 EverQuestMod::~EverQuestMod()
 {
-
+    if (WorldDataReloadThread.joinable() == true)
+        WorldDataReloadThread.join();
 }
 
 bool EverQuestMod::LoadConfigurationSystemDataFromDB()
@@ -415,6 +425,15 @@ void EverQuestMod::LoadConfigurationFile()
     // Group
     ConfigGroupZoneWideLootAndExperienceEnabled = sConfigMgr->GetOption<bool>("EverQuest.Group.ZoneWideLootAndExperienceEnabled", true);
 
+    // Pathing
+    ConfigPathingBakedWaypointLegFile = sConfigMgr->GetOption<std::string>("EverQuest.Pathing.BakedWaypointLegFile", "everquest_baked_waypoint_legs.bin");
+
+    // Startup
+    ConfigStartupDataLoadThreadCount = sConfigMgr->GetOption<uint32>("EverQuest.Startup.DataLoadThreadCount", 4);
+    if (ConfigStartupDataLoadThreadCount < 1)
+        ConfigStartupDataLoadThreadCount = 1;
+    ConfigStartupDataSnapshotFile = sConfigMgr->GetOption<std::string>("EverQuest.Startup.DataSnapshotFile", "");
+
     // Cross-Class values
     ConfigCrossClassIncludeSkillIDs = GetSetFromConfigString("EverQuest.CrossClass.IncludeSkillIDs");
 
@@ -425,9 +444,307 @@ void EverQuestMod::LoadConfigurationFile()
     CrossClassExemptSpellIDsBuilt = false;
 }
 
-void EverQuestMod::LoadCreatureData()
+void EverQuestMod::LoadWorldDataTables(EverQuestWorldData& worldData, const string& snapshotFilePath)
+{
+    // Each loader fills its own containers, so they only need ordering when one reads what another loaded
+    vector<EverQuestDataTableLoader> loaders = {
+        { "ClassMap", [this, &worldData]() { LoadClassMapData(worldData); }, [&worldData]() { return worldData.ClassMapByWOWClassID.size(); }, {} },
+        { "Creature", [this, &worldData]() { LoadCreatureData(worldData); }, [&worldData]() { return worldData.CreaturesByTemplateID.size(); }, {} },
+        { "CreatureSpawnPoints", [this, &worldData]() { LoadCreatureSpawnPoints(worldData); }, [&worldData]() { return worldData.CreatureSpawnPointsByCreatureGUID.size(); }, {} },
+        { "CreatureKillSpawn", [this, &worldData]() { LoadCreatureKillSpawnData(worldData); }, [&worldData]() { return worldData.CreatureKillSpawnsByTriggerCreatureTemplateID.size(); }, {} },
+        { "CreatureEmote", [this, &worldData]() { LoadCreatureEmoteData(worldData); }, [&worldData]() { return worldData.CreatureEmotesByCreatureTemplateID.size(); }, {} },
+        { "CreatureMovementSound", [this, &worldData]() { LoadCreatureMovementSoundData(worldData); }, [&worldData]() { return worldData.CreatureMovementSoundsByDisplayID.size(); }, {} },
+        { "CreatureOnkillReputation", [this, &worldData]() { LoadCreatureOnkillReputations(worldData); }, [&worldData]() { return worldData.CreatureOnkillReputationsByCreatureTemplateID.size(); }, {} },
+        { "ItemTemplate", [this, &worldData]() { LoadItemTemplateData(worldData); }, [&worldData]() { return worldData.ItemTemplatesByEntryID.size(); }, {} },
+        { "ItemWoWToEQSwap", [this, &worldData]() { LoadItemWoWToEQSwapData(worldData); }, [&worldData]() { return worldData.GearSwapCandidatesByLookupKey.size(); }, {} },
+        { "Spell", [this, &worldData]() { LoadSpellData(worldData); }, [&worldData]() { return worldData.SpellDataBySpellID.size(); }, {} },
+        { "IllusionDisplay", [this, &worldData]() { LoadIllusionDisplayData(worldData); }, [&worldData]() { return worldData.IllusionDisplayIDsByLookupKey.size(); }, {} },
+        { "IllusionFace", [this, &worldData]() { LoadIllusionFaceData(worldData); }, [&worldData]() { return worldData.IllusionFaceDisplayIDsByLookupKey.size(); }, {} },
+        { "QuestCompletionReputation", [this, &worldData]() { LoadQuestCompletionReputations(worldData); }, [&worldData]() { return worldData.QuestCompletionReputationsByQuestTemplateID.size(); }, {} },
+        { "QuestReaction", [this, &worldData]() { LoadQuestReactions(worldData); }, [&worldData]() { return worldData.QuestReactionListByQuestTemplateID.size(); }, {} },
+        { "GossipReaction", [this, &worldData]() { LoadGossipReactions(worldData); }, [&worldData]() { return worldData.GossipReactionsByGossipCreatureTemplateID.size(); }, {} },
+        { "Pet", [this, &worldData]() { LoadPetData(worldData); }, [&worldData]() { return worldData.PetDataByCreatureTemplateID.size(); }, {} },
+        { "PetSilentDisplay", [this, &worldData]() { LoadPetSilentDisplayData(worldData); }, [&worldData]() { return worldData.SilentFidgetDisplayIDsByDisplayID.size(); }, {} },
+        { "CreatePlayer", [this, &worldData]() { LoadCreatePlayerData(worldData); }, [&worldData]() { return worldData.PlayerCreateInfoByRaceIDThenClassID.size(); }, {} },
+        { "CreatureLoot", [this, &worldData]() { LoadCreatureLootData(worldData); }, [&worldData]() { return worldData.CreatureLootGroupsByCreatureTemplateID.size(); }, {} },
+        { "ShipTrigger", [this, &worldData]() { LoadShipTriggerData(worldData); }, [&worldData]() { return worldData.ShipTriggersByTriggeringGameObjectTemplateEntryID.size(); }, {} },
+        { "CreatureInstance", [this, &worldData]() { LoadCreatureInstanceData(worldData); }, [&worldData]() { return worldData.CreatureInstancesByCreatureGUID.size(); }, {} },
+        { "CreatureWaypoint", [this, &worldData]() { LoadCreatureWaypointData(worldData); }, [&worldData]() { return worldData.CreatureWaypointSetsByMapIDAndWaypointID.size(); }, {} },
+        { "AutoLearnSkills", [this, &worldData]() { LoadAutoLearnSkillsData(worldData); }, [&worldData]() { return worldData.PlayerAutoLearnSkillsByEQClassID.size(); }, {} },
+        { "AutoLearnSpells", [this, &worldData]() { LoadAutoLearnSpellsData(worldData); }, [&worldData]() { return worldData.PlayerAutoLearnSpellsByClassID.size(); }, {} },
+        { "Forage", [this, &worldData]() { LoadForageData(worldData); }, [&worldData]() { return worldData.ForageZoneItemsByMapID.size(); }, {} },
+        { "ZoneSafePoint", [this, &worldData]() { LoadZoneSafePointData(worldData); }, [&worldData]() { return worldData.ZoneSafePointByMapID.size(); }, {} },
+        { "Zone", [this, &worldData]() { LoadZoneData(worldData); }, [&worldData]() { return worldData.ZoneByMapID.size(); }, {} },
+        { "Faction", [this, &worldData]() { LoadFactionData(worldData); }, [&worldData]() { return worldData.FactionsByFactionTemplateID.size(); }, {} }
+    };
+
+    // A snapshot built from the same source tables stands in for all of the loaders
+    uint64 snapshotSourceChecksum = 0;
+    if (snapshotFilePath.empty() == false)
+    {
+        snapshotSourceChecksum = GetWorldDataSourceChecksum();
+        if (snapshotSourceChecksum == 0)
+            LOG_ERROR("module.EverQuest", "EverQuestMod::LoadWorldDataTables could not checksum the world tables, so the world data snapshot was neither read nor written");
+        else if (LoadWorldDataSnapshot(snapshotFilePath, snapshotSourceChecksum, worldData) == true)
+            return;
+    }
+
+    // Resolve the declared dependencies to indexes
+    size_t loaderCount = loaders.size();
+    vector<vector<size_t>> dependencyIndexesByLoaderIndex(loaderCount);
+    vector<vector<size_t>> dependentIndexesByLoaderIndex(loaderCount);
+    for (size_t loaderIndex = 0; loaderIndex < loaderCount; ++loaderIndex)
+    {
+        for (const string& dependsOnName : loaders[loaderIndex].DependsOnNames)
+        {
+            auto dependsOnIter = std::find_if(loaders.begin(), loaders.end(), [&dependsOnName](const EverQuestDataTableLoader& loader) { return loader.Name == dependsOnName; });
+            if (dependsOnIter == loaders.end())
+            {
+                LOG_ERROR("module.EverQuest", "EverQuestMod::LoadWorldDataTables loader {} depends on unknown loader {}, so that dependency was ignored", loaders[loaderIndex].Name, dependsOnName);
+                continue;
+            }
+            size_t dependsOnIndex = (size_t)std::distance(loaders.begin(), dependsOnIter);
+            dependencyIndexesByLoaderIndex[loaderIndex].push_back(dependsOnIndex);
+            dependentIndexesByLoaderIndex[dependsOnIndex].push_back(loaderIndex);
+        }
+    }
+
+    // A dependency cycle would leave loaders waiting forever, so check for one up front and fall back to the declared order on one thread
+    uint32 threadCount = std::min<uint32>(ConfigStartupDataLoadThreadCount, (uint32)loaderCount);
+    vector<size_t> remainingDependencyCounts(loaderCount);
+    deque<size_t> readyLoaderIndexes;
+    for (size_t loaderIndex = 0; loaderIndex < loaderCount; ++loaderIndex)
+    {
+        remainingDependencyCounts[loaderIndex] = dependencyIndexesByLoaderIndex[loaderIndex].size();
+        if (remainingDependencyCounts[loaderIndex] == 0)
+            readyLoaderIndexes.push_back(loaderIndex);
+    }
+    {
+        vector<size_t> checkCounts = remainingDependencyCounts;
+        deque<size_t> checkQueue = readyLoaderIndexes;
+        size_t reachableCount = 0;
+        while (checkQueue.empty() == false)
+        {
+            size_t loaderIndex = checkQueue.front();
+            checkQueue.pop_front();
+            ++reachableCount;
+            for (size_t dependentIndex : dependentIndexesByLoaderIndex[loaderIndex])
+                if (--checkCounts[dependentIndex] == 0)
+                    checkQueue.push_back(dependentIndex);
+        }
+        if (reachableCount != loaderCount)
+        {
+            LOG_ERROR("module.EverQuest", "EverQuestMod::LoadWorldDataTables found a dependency cycle between its loaders, so they will run one at a time in declared order");
+            threadCount = 1;
+            readyLoaderIndexes.clear();
+            for (size_t loaderIndex = 0; loaderIndex < loaderCount; ++loaderIndex)
+            {
+                dependencyIndexesByLoaderIndex[loaderIndex].clear();
+                dependentIndexesByLoaderIndex[loaderIndex].clear();
+                remainingDependencyCounts[loaderIndex] = 0;
+                readyLoaderIndexes.push_back(loaderIndex);
+            }
+        }
+    }
+
+    // Workers pull whichever loader is ready, and finishing one releases any loaders that were waiting on it
+    std::mutex scheduleMutex;
+    std::condition_variable scheduleCondition;
+    size_t finishedCount = 0;
+    vector<size_t> finishedLoaderIndexes;
+    vector<uint64> loadTimesInUS(loaderCount, 0);
+    auto runLoaders = [&]()
+    {
+        std::unique_lock<std::mutex> scheduleLock(scheduleMutex);
+        while (true)
+        {
+            scheduleCondition.wait(scheduleLock, [&]() { return readyLoaderIndexes.empty() == false || finishedCount == loaderCount; });
+            if (readyLoaderIndexes.empty() == true)
+                return;
+            size_t loaderIndex = readyLoaderIndexes.front();
+            readyLoaderIndexes.pop_front();
+            scheduleLock.unlock();
+
+            std::chrono::steady_clock::time_point loadStartTime = std::chrono::steady_clock::now();
+            loaders[loaderIndex].Load();
+            size_t loadedEntryCount = loaders[loaderIndex].GetLoadedEntryCount();
+            uint64 loadTimeInUS = (uint64)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - loadStartTime).count();
+            LOG_INFO("module.EverQuest", "EverQuestMod::LoadWorldDataTables loaded {} {} entries in {:.1f} ms", loadedEntryCount, loaders[loaderIndex].Name, (double)loadTimeInUS / 1000.0);
+
+            scheduleLock.lock();
+            loadTimesInUS[loaderIndex] = loadTimeInUS;
+            finishedLoaderIndexes.push_back(loaderIndex);
+            ++finishedCount;
+            for (size_t dependentIndex : dependentIndexesByLoaderIndex[loaderIndex])
+                if (--remainingDependencyCounts[dependentIndex] == 0)
+                    readyLoaderIndexes.push_back(dependentIndex);
+            scheduleCondition.notify_all();
+        }
+    };
+
+    std::chrono::steady_clock::time_point allLoadStartTime = std::chrono::steady_clock::now();
+    vector<std::thread> workerThreads;
+    for (uint32 threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+        workerThreads.emplace_back(runLoaders);
+    runLoaders();
+    for (std::thread& workerThread : workerThreads)
+        workerThread.join();
+    uint64 allLoadTimeInUS = (uint64)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - allLoadStartTime).count();
+
+    // The critical path is the slowest chain of dependent loaders, which is as fast as the load can get no matter how many threads run it.
+    // Finish order is always a valid dependency order, so every loader's dependencies are walked before it is
+    vector<uint64> pathTimesInUS(loaderCount, 0);
+    vector<size_t> pathPreviousIndexes(loaderCount, loaderCount);
+    uint64 summedLoadTimeInUS = 0;
+    size_t criticalPathEndIndex = 0;
+    for (size_t loaderIndex : finishedLoaderIndexes)
+    {
+        for (size_t dependencyIndex : dependencyIndexesByLoaderIndex[loaderIndex])
+        {
+            if (pathTimesInUS[dependencyIndex] >= pathTimesInUS[loaderIndex])
+            {
+                pathTimesInUS[loaderIndex] = pathTimesInUS[dependencyIndex];
+                pathPreviousIndexes[loaderIndex] = dependencyIndex;
+            }
+        }
+        pathTimesInUS[loaderIndex] += loadTimesInUS[loaderIndex];
+        summedLoadTimeInUS += loadTimesInUS[loaderIndex];
+        if (pathTimesInUS[loaderIndex] > pathTimesInUS[criticalPathEndIndex])
+            criticalPathEndIndex = loaderIndex;
+    }
+    string criticalPathText;
+    for (size_t pathIndex = criticalPathEndIndex; pathIndex < loaderCount; pathIndex = pathPreviousIndexes[pathIndex])
+    {
+        string stepText = fmt::format("{} ({:.1f} ms)", loaders[pathIndex].Name, (double)loadTimesInUS[pathIndex] / 1000.0);
+        criticalPathText = criticalPathText.empty() == true ? stepText : stepText + " -> " + criticalPathText;
+    }
+    LOG_INFO("module.EverQuest", "EverQuestMod::LoadWorldDataTables loaded {} tables in {:.1f} ms on {} threads ({:.1f} ms of loader time), critical path {:.1f} ms: {}", loaderCount,
+        (double)allLoadTimeInUS / 1000.0, threadCount, (double)summedLoadTimeInUS / 1000.0, (double)pathTimesInUS[criticalPathEndIndex] / 1000.0, criticalPathText);
+
+    // Only after a full load from the database, so the snapshot always holds exactly what the loaders built
+    if (snapshotSourceChecksum != 0)
+        WriteWorldDataSnapshot(snapshotFilePath, snapshotSourceChecksum, worldData);
+}
+
+void EverQuestMod::PublishWorldData(std::unique_ptr<EverQuestWorldData> worldData, unordered_map<uint32, unordered_map<uint64, EverQuestCachedWaypointLeg>> bakedWaypointLegs)
+{
+    // Readers that picked up the old tables this tick may still be holding references into them, so they are retired rather than freed
+    if (CurrentWorldData != nullptr)
+        RetiredWorldData.emplace_back(WorldUpdateTickCount, std::move(CurrentWorldData));
+    CurrentWorldData = std::move(worldData);
+    PublishedWorldData.store(CurrentWorldData.get(), std::memory_order_release);
+    WorldDataGeneration.fetch_add(1, std::memory_order_release);
+
+    // The cycle spawn timers are written by the map threads without a lock, so every map that has cycle spawns needs its entry before a map update
+    for (const auto& cycleMapPair : CurrentWorldData->CycleSpawnGroupsByMapIDThenSpawnGroupID)
+        CycleSpawnCheckTimerInMSByMapID.try_emplace(cycleMapPair.first, 0);
+
+    // The runtime caches below hold waypoint leg keys into the old tables, so they start over against the new ones
+    {
+        std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+        for (const auto& legCachePair : WaypointLegCachesByMapInstanceKey)
+        {
+            for (const auto& legByKey : legCachePair.second.LegsByKey)
+            {
+                WaypointLegCacheStats.CachedLegCount--;
+                WaypointLegCacheStats.CachedBytes -= GetCachedWaypointLegBytes(legByKey.second);
+                WaypointLegCacheStats.InvalidatedLegs++;
+            }
+        }
+        WaypointLegCachesByMapInstanceKey.clear();
+
+        // The baked legs were read and checked against the new waypoints before publishing, so only the swap happens under the lock
+        BakedWaypointLegsByMapIDThenLegKey = std::move(bakedWaypointLegs);
+        WaypointLegCacheStats.BakedLegCount = 0;
+        for (const auto& bakedLegsByMapID : BakedWaypointLegsByMapIDThenLegKey)
+            WaypointLegCacheStats.BakedLegCount += bakedLegsByMapID.second.size();
+    }
+}
+
+void EverQuestMod::ResolveWorldDataReferences(EverQuestWorldData& worldData)
+{
+    // The creature spawn tables aren't loaded yet when the kill spawn data loads with the config so respawn target spawn points resolve here instead
+    ResolveKillSpawnRespawnTargetSpawnPoints(worldData);
+
+    // The silent pet displays validate against CreatureDisplayInfo.dbc, which isn't loaded when the pet silent display data loads with the config
+    RemoveInvalidPetSilentDisplays(worldData);
+
+    // Defend combat faction templates validate against FactionTemplate.dbc, which isn't loaded when the faction data loads with the config
+    ResolveDefendCombatFactionTemplates(worldData);
+
+    // The set of reputation-capable EQ factions validates against Faction.dbc, which also isn't loaded when the faction data loads with the config
+    ResolveEQReputationFactions(worldData);
+}
+
+// Note: Runs at world startup (OnStartup), before any map has updated, so the published tables can still be resolved in place
+void EverQuestMod::ResolveStartupWorldDataReferences()
+{
+    ResolveWorldDataReferences(*CurrentWorldData);
+}
+
+bool EverQuestMod::StartWorldDataReload()
+{
+    std::lock_guard<std::mutex> lock(WorldDataReloadMutex);
+    if (WorldDataReloadRunning == true)
+        return false;
+    WorldDataReloadRunning = true;
+    WorldDataReloadReady = false;
+
+    // A ".reload config" on the world thread can rewrite the config strings while the reload runs, so the thread works from copies
+    string snapshotFilePath = ConfigStartupDataSnapshotFile;
+    string bakeFilePath = ConfigPathingBakedWaypointLegFile;
+
+    // The tables only read the database and the files, so they build off the world thread and UpdateWorldDataReload picks them up once they're done
+    WorldDataReloadThread = std::thread([this, snapshotFilePath, bakeFilePath]()
+    {
+        std::unique_ptr<EverQuestWorldData> worldData(new EverQuestWorldData());
+        LoadWorldDataTables(*worldData, snapshotFilePath);
+        unordered_map<uint32, unordered_map<uint64, EverQuestCachedWaypointLeg>> bakedWaypointLegs;
+        LoadBakedWaypointLegs(bakeFilePath, *worldData, bakedWaypointLegs);
+        std::lock_guard<std::mutex> readyLock(WorldDataReloadMutex);
+        ReloadedWorldData = std::move(worldData);
+        ReloadedBakedWaypointLegs = std::move(bakedWaypointLegs);
+        WorldDataReloadReady = true;
+    });
+    LOG_INFO("module.EverQuest", "EverQuestMod::StartWorldDataReload started rebuilding the world data tables in the background");
+    return true;
+}
+
+// Note: Runs on the world thread (WorldScript::OnUpdate), after the map updates have been waited on, so no map thread is reading the tables
+void EverQuestMod::UpdateWorldDataReload()
+{
+    WorldUpdateTickCount++;
+
+    std::unique_ptr<EverQuestWorldData> reloadedWorldData;
+    unordered_map<uint32, unordered_map<uint64, EverQuestCachedWaypointLeg>> reloadedBakedWaypointLegs;
+    {
+        std::lock_guard<std::mutex> lock(WorldDataReloadMutex);
+        if (WorldDataReloadReady == true)
+        {
+            reloadedWorldData = std::move(ReloadedWorldData);
+            reloadedBakedWaypointLegs = std::move(ReloadedBakedWaypointLegs);
+            WorldDataReloadReady = false;
+            WorldDataReloadRunning = false;
+        }
+    }
+    if (reloadedWorldData != nullptr)
+    {
+        WorldDataReloadThread.join();
+
+        // The references resolve against the object manager and the DBC stores, which are only safe to walk from the world thread
+        ResolveWorldDataReferences(*reloadedWorldData);
+        PublishWorldData(std::move(reloadedWorldData), std::move(reloadedBakedWaypointLegs));
+        LOG_INFO("module.EverQuest", "EverQuestMod::UpdateWorldDataReload published world data generation {}", WorldDataGeneration.load(std::memory_order_relaxed));
+    }
+
+    // Nothing holds a reference into the tables across a world update, so once the grace has passed the retired ones can go
+    while (RetiredWorldData.empty() == false && WorldUpdateTickCount - RetiredWorldData.front().first >= EQ_WORLD_DATA_RETIRE_GRACE_TICKS)
+        RetiredWorldData.erase(RetiredWorldData.begin());
+}
+
+void EverQuestMod::LoadCreatureData(EverQuestWorldData& worldData)
 {
-    CreaturesByTemplateID.clear();
+    worldData.CreaturesByTemplateID.clear();
     QueryResult queryResult = WorldDatabase.Query("SELECT CreatureTemplateID, CanShowHeldLootItems, CanShowHeldLootShields, SpawnLimit, RangedAttackEnabled, RangedAttackMinRange, RangedAttackMaxRange, RangedAttackDamageModPct, AgroSocialDistanceMod, EnrageEnabled, EnrageHPPct, EnrageDurationInMS, EnrageCooldownInMS, FlurryEnabled, FlurryChancePct, RampageEnabled, RampageChancePct, RampageRange, RampageDamagePct, WildRampageEnabled, WildRampageChancePct, WildRampageMaxTargets, WildRampageDamagePct, AttackRoundTimeInMS, DifficultyType FROM mod_everquest_creature ORDER BY CreatureTemplateID;");
     if (queryResult)
     {
@@ -461,14 +778,14 @@ void EverQuestMod::LoadCreatureData()
             everQuestCreature.WildRampageDamagePct = fields[22].Get<uint32>();
             everQuestCreature.AttackRoundTimeInMS = fields[23].Get<uint32>();
             everQuestCreature.DifficultyType = fields[24].Get<uint32>();
-            CreaturesByTemplateID[everQuestCreature.CreatureTemplateID] = everQuestCreature;
+            worldData.CreaturesByTemplateID[everQuestCreature.CreatureTemplateID] = everQuestCreature;
         } while (queryResult->NextRow());
     }
 }
 
-void EverQuestMod::LoadCreatureSpawnPoints()
+void EverQuestMod::LoadCreatureSpawnPoints(EverQuestWorldData& worldData)
 {
-    CreatureSpawnPointsByCreatureGUID.clear();
+    worldData.CreatureSpawnPointsByCreatureGUID.clear();
     QueryResult queryResult = WorldDatabase.Query("SELECT CreatureGUID, MapID, SpawnPointID, SpawnGroupID, SpawnGroupLimit, CycleRespawnTimeSec, CycleChance FROM mod_everquest_creature_spawn_point;");
     if (queryResult)
     {
@@ -484,19 +801,18 @@ void EverQuestMod::LoadCreatureSpawnPoints()
             creatureSpawnPoint.SpawnGroupLimit = fields[4].Get<uint32>();
             creatureSpawnPoint.CycleRespawnTimeSec = fields[5].Get<uint32>();
             creatureSpawnPoint.CycleChance = fields[6].Get<uint32>();
-            CreatureSpawnPointsByCreatureGUID[creatureSpawnPoint.CreatureGUID] = creatureSpawnPoint;
+            worldData.CreatureSpawnPointsByCreatureGUID[creatureSpawnPoint.CreatureGUID] = creatureSpawnPoint;
         } while (queryResult->NextRow());
     }
 
     // Cycle group spawn metadata
-    CycleSpawnGroupsByMapIDThenSpawnGroupID.clear();
-    CycleSpawnCheckTimerInMSByMapID.clear();
-    for (auto& spawnPointPair : CreatureSpawnPointsByCreatureGUID)
+    worldData.CycleSpawnGroupsByMapIDThenSpawnGroupID.clear();
+    for (auto& spawnPointPair : worldData.CreatureSpawnPointsByCreatureGUID)
     {
         const EverQuestCreatureSpawnPoint& spawnPoint = spawnPointPair.second;
         if (spawnPoint.CycleRespawnTimeSec == 0)
             continue;
-        EverQuestCycleSpawnGroup& cycleSpawnGroup = CycleSpawnGroupsByMapIDThenSpawnGroupID[spawnPoint.MapID][spawnPoint.SpawnGroupID];
+        EverQuestCycleSpawnGroup& cycleSpawnGroup = worldData.CycleSpawnGroupsByMapIDThenSpawnGroupID[spawnPoint.MapID][spawnPoint.SpawnGroupID];
         cycleSpawnGroup.MapID = spawnPoint.MapID;
         cycleSpawnGroup.SpawnGroupID = spawnPoint.SpawnGroupID;
         if (spawnPoint.SpawnGroupLimit > 0)
@@ -506,9 +822,6 @@ void EverQuestMod::LoadCreatureSpawnPoints()
         cycleSpawnCandidate.CreatureGUID = spawnPoint.CreatureGUID;
         cycleSpawnCandidate.Chance = spawnPoint.CycleChance;
         cycleSpawnGroup.CandidatesBySpawnPointID[spawnPoint.SpawnPointID].push_back(cycleSpawnCandidate);
-
-        // Pre-create the per-map check timer so map update threads never change the container's shape
-        CycleSpawnCheckTimerInMSByMapID[spawnPoint.MapID] = 0;
     }
 }
 
@@ -577,17 +890,18 @@ ObjectGuid::LowType EverQuestMod::RollCycleSpawnCreatureGUID(const EverQuestCycl
 
 void EverQuestMod::ProcessCycleSpawnForCreatureDeath(Creature* deadCreature)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
     if (deadCreature->GetSpawnId() == 0)
         return;
-    auto spawnPointIter = CreatureSpawnPointsByCreatureGUID.find(deadCreature->GetSpawnId());
-    if (spawnPointIter == CreatureSpawnPointsByCreatureGUID.end())
+    auto spawnPointIter = worldData.CreatureSpawnPointsByCreatureGUID.find(deadCreature->GetSpawnId());
+    if (spawnPointIter == worldData.CreatureSpawnPointsByCreatureGUID.end())
         return;
     const EverQuestCreatureSpawnPoint& spawnPoint = spawnPointIter->second;
     if (spawnPoint.CycleRespawnTimeSec == 0)
         return;
     uint32 mapID = deadCreature->GetMapId();
-    auto cycleMapIter = CycleSpawnGroupsByMapIDThenSpawnGroupID.find(mapID);
-    if (cycleMapIter == CycleSpawnGroupsByMapIDThenSpawnGroupID.end())
+    auto cycleMapIter = worldData.CycleSpawnGroupsByMapIDThenSpawnGroupID.find(mapID);
+    if (cycleMapIter == worldData.CycleSpawnGroupsByMapIDThenSpawnGroupID.end())
         return;
     auto cycleGroupIter = cycleMapIter->second.find(spawnPoint.SpawnGroupID);
     if (cycleGroupIter == cycleMapIter->second.end())
@@ -654,12 +968,14 @@ void EverQuestMod::ApplyRaidBossRespawnVariance(Creature* deadCreature)
 
 void EverQuestMod::UpdateCycleSpawns(Map* map, uint32 diff)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
+
     // Cycle spawn groups only exist on world maps (instanced map copies never get spawn point rows)
     if (map->GetInstanceId() != 0)
         return;
     uint32 mapID = map->GetId();
-    auto cycleMapIter = CycleSpawnGroupsByMapIDThenSpawnGroupID.find(mapID);
-    if (cycleMapIter == CycleSpawnGroupsByMapIDThenSpawnGroupID.end())
+    auto cycleMapIter = worldData.CycleSpawnGroupsByMapIDThenSpawnGroupID.find(mapID);
+    if (cycleMapIter == worldData.CycleSpawnGroupsByMapIDThenSpawnGroupID.end())
         return;
     CycleSpawnCheckTimerInMSByMapID[mapID] -= (int32)diff;
     if (CycleSpawnCheckTimerInMSByMapID[mapID] > 0)
@@ -717,6 +1033,8 @@ void EverQuestMod::UpdateCycleSpawns(Map* map, uint32 diff)
 
 bool EverQuestMod::ShouldDespawnCreatureDueToSpawnRestrictions(Creature* creature)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
+
     // Creatures loading in dead (corpses) never count against spawn restrictions
     if (creature->IsAlive() == false)
         return false;
@@ -739,9 +1057,9 @@ bool EverQuestMod::ShouldDespawnCreatureDueToSpawnRestrictions(Creature* creatur
     }
 
     // Pooled spawn points can only ever have one creature alive on them, and capped spawn groups so many alive in total
-    if (creature->GetSpawnId() != 0 && CreatureSpawnPointsByCreatureGUID.find(creature->GetSpawnId()) != CreatureSpawnPointsByCreatureGUID.end())
+    if (creature->GetSpawnId() != 0 && worldData.CreatureSpawnPointsByCreatureGUID.find(creature->GetSpawnId()) != worldData.CreatureSpawnPointsByCreatureGUID.end())
     {
-        const EverQuestCreatureSpawnPoint& creatureSpawnPoint = CreatureSpawnPointsByCreatureGUID[creature->GetSpawnId()];
+        const EverQuestCreatureSpawnPoint& creatureSpawnPoint = worldData.CreatureSpawnPointsByCreatureGUID.at(creature->GetSpawnId());
         std::lock_guard<std::mutex> lock(RuntimeStateMutex);
         if (AllLoadedCreaturesByMapInstanceKeyThenSpawnPointID.find(mapInstanceKey) != AllLoadedCreaturesByMapInstanceKeyThenSpawnPointID.end())
         {
@@ -771,7 +1089,8 @@ bool EverQuestMod::ShouldDespawnCreatureDueToSpawnRestrictions(Creature* creatur
 
 bool EverQuestMod::HasCreatureDataForCreatureTemplateID(uint32 creatureTemplateID)
 {
-    if (CreaturesByTemplateID.find(creatureTemplateID) != CreaturesByTemplateID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.CreaturesByTemplateID.find(creatureTemplateID) != worldData.CreaturesByTemplateID.end())
         return true;
     else
         return false;
@@ -779,9 +1098,10 @@ bool EverQuestMod::HasCreatureDataForCreatureTemplateID(uint32 creatureTemplateI
 
 const EverQuestCreature& EverQuestMod::GetCreatureDataForCreatureTemplateID(uint32 creatureTemplateID)
 {
-    if (CreaturesByTemplateID.find(creatureTemplateID) != CreaturesByTemplateID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.CreaturesByTemplateID.find(creatureTemplateID) != worldData.CreaturesByTemplateID.end())
     {
-        return CreaturesByTemplateID[creatureTemplateID];
+        return worldData.CreaturesByTemplateID.at(creatureTemplateID);
     }
     else
     {
@@ -790,11 +1110,11 @@ const EverQuestCreature& EverQuestMod::GetCreatureDataForCreatureTemplateID(uint
     }
 }
 
-void EverQuestMod::LoadCreatureKillSpawnData()
+void EverQuestMod::LoadCreatureKillSpawnData(EverQuestWorldData& worldData)
 {
-    CreatureKillSpawnsByTriggerCreatureTemplateID.clear();
-    EvadeKillSpawnTriggerCreatureTemplateIDs.clear();
-    OocTimerKillSpawnDurationMSByCreatureTemplateID.clear();
+    worldData.CreatureKillSpawnsByTriggerCreatureTemplateID.clear();
+    worldData.EvadeKillSpawnTriggerCreatureTemplateIDs.clear();
+    worldData.OocTimerKillSpawnDurationMSByCreatureTemplateID.clear();
 
     QueryResult queryResult = WorldDatabase.Query("SELECT ID, TriggerCreatureTemplateID, TriggerTypeID, MapID, ActionType, TargetCreatureTemplateID, Chance, AltGroup, AltID, AltWeight, SpawnAtCorpse, PositionX, PositionY, PositionZ, Orientation, DelayMinMS, DelayMaxMS, OnlyIfNotAliveCreatureTemplateID, RequireDeadCreatureTemplateIDs, RequireAliveCreatureTemplateIDs, AddToHateList, TriggerMinLevel, TriggerMaxLevel, RespawnTimeSec FROM mod_everquest_creature_kill_spawn;");
     if (queryResult)
@@ -832,24 +1152,24 @@ void EverQuestMod::LoadCreatureKillSpawnData()
             killSpawn.TriggerMaxLevel = fields[22].Get<uint32>();
             killSpawn.RespawnTimeSec = fields[23].Get<uint32>();
             if (killSpawn.TriggerTypeID == EQ_KILLSPAWN_TRIGGER_EVADE)
-                EvadeKillSpawnTriggerCreatureTemplateIDs.insert(killSpawn.TriggerCreatureTemplateID);
+                worldData.EvadeKillSpawnTriggerCreatureTemplateIDs.insert(killSpawn.TriggerCreatureTemplateID);
             else if (killSpawn.TriggerTypeID == EQ_KILLSPAWN_TRIGGER_OOCTIMER)
             {
                 // This delay is the out-of-combat (ooc) countdouwn duration and the creature's countdown uses the longest duration
                 if (killSpawn.DelayMinMS == 0)
                     LOG_ERROR("module.EverQuest", "EverQuestMod::LoadCreatureKillSpawnData kill spawn ID {} has an ooctimer trigger with no delay duration, so it will never fire", killSpawn.ID);
-                else if (killSpawn.DelayMinMS > OocTimerKillSpawnDurationMSByCreatureTemplateID[killSpawn.TriggerCreatureTemplateID])
-                    OocTimerKillSpawnDurationMSByCreatureTemplateID[killSpawn.TriggerCreatureTemplateID] = killSpawn.DelayMinMS;
+                else if (killSpawn.DelayMinMS > worldData.OocTimerKillSpawnDurationMSByCreatureTemplateID[killSpawn.TriggerCreatureTemplateID])
+                    worldData.OocTimerKillSpawnDurationMSByCreatureTemplateID[killSpawn.TriggerCreatureTemplateID] = killSpawn.DelayMinMS;
             }
-            CreatureKillSpawnsByTriggerCreatureTemplateID[killSpawn.TriggerCreatureTemplateID].push_back(killSpawn);
+            worldData.CreatureKillSpawnsByTriggerCreatureTemplateID[killSpawn.TriggerCreatureTemplateID].push_back(killSpawn);
         } while (queryResult->NextRow());
     }
 }
 
 // Note: runs at world startup (OnStartup) which runs before sObjectMgr has any creature spawns
-void EverQuestMod::ResolveKillSpawnRespawnTargetSpawnPoints()
+void EverQuestMod::ResolveKillSpawnRespawnTargetSpawnPoints(EverQuestWorldData& worldData)
 {
-    for (auto& killSpawnPair : CreatureKillSpawnsByTriggerCreatureTemplateID)
+    for (auto& killSpawnPair : worldData.CreatureKillSpawnsByTriggerCreatureTemplateID)
     {
         for (EverQuestCreatureKillSpawn& killSpawn : killSpawnPair.second)
         {
@@ -857,7 +1177,10 @@ void EverQuestMod::ResolveKillSpawnRespawnTargetSpawnPoints()
                 continue;
 
             // The raid instance copy of the zone has its own static spawn rows, so targets resolve for that map too when one exists
-            uint32 instanceRaidLowMapID = GetInstanceRaidLowMapIDForMap(killSpawn.MapID);
+            uint32 instanceRaidLowMapID = 0;
+            auto zoneIt = worldData.ZoneByMapID.find(killSpawn.MapID);
+            if (zoneIt != worldData.ZoneByMapID.end())
+                instanceRaidLowMapID = zoneIt->second.InstanceRaidLowMapID;
             for (auto const& creatureDataPair : sObjectMgr->GetAllCreatureData())
             {
                 CreatureData const& creatureData = creatureDataPair.second;
@@ -977,9 +1300,9 @@ void EverQuestMod::RemoveVulakLockState(Creature* creature)
     creature->CustomData.Erase(EQ_CREATURE_CUSTOMDATA_VULAKLOCK);
 }
 
-void EverQuestMod::LoadCreatureEmoteData()
+void EverQuestMod::LoadCreatureEmoteData(EverQuestWorldData& worldData)
 {
-    CreatureEmotesByCreatureTemplateID.clear();
+    worldData.CreatureEmotesByCreatureTemplateID.clear();
 
     QueryResult queryResult = WorldDatabase.Query("SELECT CreatureTemplateID, EventType, EmoteType, ChancePct, Param1, Param2, EmoteText FROM mod_everquest_creature_emote ORDER BY CreatureTemplateID, ID;");
     if (queryResult)
@@ -995,14 +1318,14 @@ void EverQuestMod::LoadCreatureEmoteData()
             emote.Param1 = fields[4].Get<int32>();
             emote.Param2 = fields[5].Get<int32>();
             emote.EmoteText = fields[6].Get<string>();
-            CreatureEmotesByCreatureTemplateID[creatureTemplateID].push_back(emote);
+            worldData.CreatureEmotesByCreatureTemplateID[creatureTemplateID].push_back(emote);
         } while (queryResult->NextRow());
     }
 }
 
-void EverQuestMod::LoadCreatureMovementSoundData()
+void EverQuestMod::LoadCreatureMovementSoundData(EverQuestWorldData& worldData)
 {
-    CreatureMovementSoundsByDisplayID.clear();
+    worldData.CreatureMovementSoundsByDisplayID.clear();
 
     QueryResult queryResult = WorldDatabase.Query("SELECT DisplayID, WalkSoundEntryIDs, WalkSoundDurationsMS, RunSoundEntryIDs, RunSoundDurationsMS, MaxHearingDistance FROM mod_everquest_creature_movement_sound;");
     if (queryResult)
@@ -1031,7 +1354,7 @@ void EverQuestMod::LoadCreatureMovementSoundData()
                 LOG_ERROR("module.EverQuest", "EverQuestMod::LoadCreatureMovementSoundData skipped display ID {} as the piece sound and duration list lengths do not match", displayID);
                 continue;
             }
-            CreatureMovementSoundsByDisplayID[displayID] = movementSound;
+            worldData.CreatureMovementSoundsByDisplayID[displayID] = movementSound;
         } while (queryResult->NextRow());
     }
 }
@@ -1152,12 +1475,13 @@ void EverQuestMod::EmitCreatureEmote(Creature* creature, const EverQuestCreature
 // This is like TAKP's NPC::GetNPCEmote
 bool EverQuestMod::DoCreatureEmoteEvent(Creature* creature, uint8 emoteEventType, Unit* target)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
     if (ConfigCreatureEmotesEnabled == false)
         return false;
     if (creature == nullptr)
         return false;
-    unordered_map<uint32, vector<EverQuestCreatureEmote>>::const_iterator emoteIter = CreatureEmotesByCreatureTemplateID.find(creature->GetEntry());
-    if (emoteIter == CreatureEmotesByCreatureTemplateID.end())
+    unordered_map<uint32, vector<EverQuestCreatureEmote>>::const_iterator emoteIter = worldData.CreatureEmotesByCreatureTemplateID.find(creature->GetEntry());
+    if (emoteIter == worldData.CreatureEmotesByCreatureTemplateID.end())
         return false;
 
     vector<const EverQuestCreatureEmote*> matchingEmotes;
@@ -1177,10 +1501,11 @@ bool EverQuestMod::DoCreatureEmoteEvent(Creature* creature, uint8 emoteEventType
 // Only creatures with spawn, timer, or proximity emote lines get tick state
 void EverQuestMod::SetupCreatureEmoteState(Creature* creature)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
     if (ConfigCreatureEmotesEnabled == false)
         return;
-    unordered_map<uint32, vector<EverQuestCreatureEmote>>::const_iterator emoteIter = CreatureEmotesByCreatureTemplateID.find(creature->GetEntry());
-    if (emoteIter == CreatureEmotesByCreatureTemplateID.end())
+    unordered_map<uint32, vector<EverQuestCreatureEmote>>::const_iterator emoteIter = worldData.CreatureEmotesByCreatureTemplateID.find(creature->GetEntry());
+    if (emoteIter == worldData.CreatureEmotesByCreatureTemplateID.end())
         return;
 
     bool hasOnSpawnEmote = false;
@@ -1228,6 +1553,7 @@ void EverQuestMod::RemoveCreatureEmoteState(Creature* creature)
 
 void EverQuestMod::UpdateCreatureEmotes(Creature* creature, uint32 diff)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
     if (creature == nullptr)
         return;
     if (ConfigCreatureEmotesEnabled == false)
@@ -1257,8 +1583,8 @@ void EverQuestMod::UpdateCreatureEmotes(Creature* creature, uint32 diff)
         {
             uint32 nextTimerMinMS = 0;
             uint32 nextTimerMaxMS = 0;
-            unordered_map<uint32, vector<EverQuestCreatureEmote>>::const_iterator emoteIter = CreatureEmotesByCreatureTemplateID.find(creature->GetEntry());
-            if (emoteIter != CreatureEmotesByCreatureTemplateID.end())
+            unordered_map<uint32, vector<EverQuestCreatureEmote>>::const_iterator emoteIter = worldData.CreatureEmotesByCreatureTemplateID.find(creature->GetEntry());
+            if (emoteIter != worldData.CreatureEmotesByCreatureTemplateID.end())
             {
                 vector<const EverQuestCreatureEmote*> timerEmotes;
                 for (const EverQuestCreatureEmote& emote : emoteIter->second)
@@ -1298,8 +1624,8 @@ void EverQuestMod::UpdateCreatureEmotes(Creature* creature, uint32 diff)
             state->ProximityCheckRemainingMS = EQ_CREATURE_EMOTE_PROXIMITY_CHECK_MS;
             if (state->ProximityCooldownRemainingMS == 0)
             {
-                unordered_map<uint32, vector<EverQuestCreatureEmote>>::const_iterator emoteIter = CreatureEmotesByCreatureTemplateID.find(creature->GetEntry());
-                if (emoteIter != CreatureEmotesByCreatureTemplateID.end())
+                unordered_map<uint32, vector<EverQuestCreatureEmote>>::const_iterator emoteIter = worldData.CreatureEmotesByCreatureTemplateID.find(creature->GetEntry());
+                if (emoteIter != worldData.CreatureEmotesByCreatureTemplateID.end())
                 {
                     vector<const EverQuestCreatureEmote*> proximityEmotes;
                     for (const EverQuestCreatureEmote& emote : emoteIter->second)
@@ -1334,6 +1660,8 @@ void EverQuestMod::RemoveCreatureMovementSoundState(Creature* creature)
 
 void EverQuestMod::UpdateCreatureMovementSound(Creature* creature, uint32 diff)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
+
     // In EQ, movement sounds are repeating loops which isn't how WoW works.  So this is a 'hack' to make sounds
     // play in parts emitted from the server instead of relying on EQ creature event attachments
     if (creature == nullptr)
@@ -1370,8 +1698,8 @@ void EverQuestMod::UpdateCreatureMovementSound(Creature* creature, uint32 diff)
         return;
     }
 
-    unordered_map<uint32, EverQuestCreatureMovementSound>::const_iterator soundIter = CreatureMovementSoundsByDisplayID.find(creature->GetDisplayId());
-    if (soundIter == CreatureMovementSoundsByDisplayID.end())
+    unordered_map<uint32, EverQuestCreatureMovementSound>::const_iterator soundIter = worldData.CreatureMovementSoundsByDisplayID.find(creature->GetDisplayId());
+    if (soundIter == worldData.CreatureMovementSoundsByDisplayID.end())
         return;
     const vector<uint32>& pieceSoundEntryIDs = curGait == EQ_CREATURE_MOVEMENT_GAIT_WALK ? soundIter->second.WalkPieceSoundEntryIDs : soundIter->second.RunPieceSoundEntryIDs;
     const vector<uint32>& pieceDurationsMS = curGait == EQ_CREATURE_MOVEMENT_GAIT_WALK ? soundIter->second.WalkPieceDurationsMS : soundIter->second.RunPieceDurationsMS;
@@ -1468,8 +1796,9 @@ bool EverQuestMod::HasAliveCreatureWithEntryInMap(Map* map, uint32 creatureTempl
 
 void EverQuestMod::ProcessKillSpawnsForCreatureEvent(Creature* eventCreature, Unit* otherUnit, uint8 triggerTypeID)
 {
-    auto killSpawnIter = CreatureKillSpawnsByTriggerCreatureTemplateID.find(eventCreature->GetEntry());
-    if (killSpawnIter == CreatureKillSpawnsByTriggerCreatureTemplateID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    auto killSpawnIter = worldData.CreatureKillSpawnsByTriggerCreatureTemplateID.find(eventCreature->GetEntry());
+    if (killSpawnIter == worldData.CreatureKillSpawnsByTriggerCreatureTemplateID.end())
         return;
     Map* map = eventCreature->GetMap();
 
@@ -1720,9 +2049,10 @@ void EverQuestMod::RemoveCreatureKillSpawnCombatWatchState(Creature* creature)
 
 void EverQuestMod::UpdateCreatureKillSpawnCombatWatch(Creature* creature, uint32 diff)
 {
-    bool hasEvadeRows = EvadeKillSpawnTriggerCreatureTemplateIDs.find(creature->GetEntry()) != EvadeKillSpawnTriggerCreatureTemplateIDs.end();
-    auto oocTimerIter = OocTimerKillSpawnDurationMSByCreatureTemplateID.find(creature->GetEntry());
-    bool hasOocTimerRows = oocTimerIter != OocTimerKillSpawnDurationMSByCreatureTemplateID.end();
+    const EverQuestWorldData& worldData = GetWorldData();
+    bool hasEvadeRows = worldData.EvadeKillSpawnTriggerCreatureTemplateIDs.find(creature->GetEntry()) != worldData.EvadeKillSpawnTriggerCreatureTemplateIDs.end();
+    auto oocTimerIter = worldData.OocTimerKillSpawnDurationMSByCreatureTemplateID.find(creature->GetEntry());
+    bool hasOocTimerRows = oocTimerIter != worldData.OocTimerKillSpawnDurationMSByCreatureTemplateID.end();
     if (hasEvadeRows == false && hasOocTimerRows == false)
         return;
     if (creature->IsPet() == true || creature->IsControlledByPlayer() == true)
@@ -1846,9 +2176,9 @@ void EverQuestMod::EnqueuePendingKillSpawnAction(Map* map, EverQuestPendingKillS
     PendingKillSpawnActionsByMapInstanceKey[GetMapInstanceKey(map)].push_back(action);
 }
 
-void EverQuestMod::LoadCreatureOnkillReputations()
+void EverQuestMod::LoadCreatureOnkillReputations(EverQuestWorldData& worldData)
 {
-    CreatureOnkillReputationsByCreatureTemplateID.clear();
+    worldData.CreatureOnkillReputationsByCreatureTemplateID.clear();
 
     // Pulls in all the kill faction rewards
     QueryResult queryResult = WorldDatabase.Query("SELECT CreatureTemplateID, SortOrder, FactionID, KillRewardValue FROM mod_everquest_creature_onkill_reputation ORDER BY CreatureTemplateID, SortOrder;");
@@ -1863,16 +2193,17 @@ void EverQuestMod::LoadCreatureOnkillReputations()
             creatureOnkillReputation.SortOrder = fields[1].Get<uint8>();
             creatureOnkillReputation.FactionID = fields[2].Get<uint32>();
             creatureOnkillReputation.KillRewardValue = fields[3].Get<int32>();
-            CreatureOnkillReputationsByCreatureTemplateID[creatureOnkillReputation.CreatureTemplateID].push_back(creatureOnkillReputation);
+            worldData.CreatureOnkillReputationsByCreatureTemplateID[creatureOnkillReputation.CreatureTemplateID].push_back(creatureOnkillReputation);
         } while (queryResult->NextRow());
     }
 }
 
 const list<EverQuestCreatureOnkillReputation>& EverQuestMod::GetOnkillReputationsForCreatureTemplate(uint32 creatureTemplateID)
 {
-    if (CreatureOnkillReputationsByCreatureTemplateID.find(creatureTemplateID) != CreatureOnkillReputationsByCreatureTemplateID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.CreatureOnkillReputationsByCreatureTemplateID.find(creatureTemplateID) != worldData.CreatureOnkillReputationsByCreatureTemplateID.end())
     {
-        return CreatureOnkillReputationsByCreatureTemplateID[creatureTemplateID];
+        return worldData.CreatureOnkillReputationsByCreatureTemplateID.at(creatureTemplateID);
     }
     else
     {
@@ -1881,10 +2212,12 @@ const list<EverQuestCreatureOnkillReputation>& EverQuestMod::GetOnkillReputation
     }
 }
 
-void EverQuestMod::LoadItemTemplateData()
+void EverQuestMod::LoadItemTemplateData(EverQuestWorldData& worldData)
 {
-    ItemTemplatesByEntryID.clear();
-    WornEffectSpellIDs.clear();
+    worldData.ItemTemplatesByEntryID.clear();
+    worldData.WornEffectSpellIDs.clear();
+    worldData.ItemEQClassMaskBaseItemTemplateID = 0;
+    worldData.ItemEQClassMasksByItemTemplateIDOffset.clear();
     QueryResult queryResult = WorldDatabase.Query("SELECT ItemTemplateID, NPCEquipItemTemplateID, WornEffectSpellID, AllowedEQClassMask, EQArmorMaterial, IllusionTintID FROM mod_everquest_item_template ORDER BY ItemTemplateID;");
     if (queryResult)
     {
@@ -1899,16 +2232,34 @@ void EverQuestMod::LoadItemTemplateData()
             everQuestItemTemplate.AllowedEQClassMask = fields[3].Get<uint32>();
             everQuestItemTemplate.EQArmorMaterial = (uint32)std::max(0, fields[4].Get<int32>());
             everQuestItemTemplate.IllusionTintID = (uint32)std::max(0, fields[5].Get<int32>());
-            ItemTemplatesByEntryID[everQuestItemTemplate.ItemTemplateEntryID] = everQuestItemTemplate;
+            worldData.ItemTemplatesByEntryID[everQuestItemTemplate.ItemTemplateEntryID] = everQuestItemTemplate;
             if (everQuestItemTemplate.WornEffectSpellID != 0)
-                WornEffectSpellIDs.insert(everQuestItemTemplate.WornEffectSpellID);
+                worldData.WornEffectSpellIDs.insert(everQuestItemTemplate.WornEffectSpellID);
         } while (queryResult->NextRow());
     }
+
+    // Flatten the class masks into a dense array over the template ID span so class checks are one index and one AND
+    if (worldData.ItemTemplatesByEntryID.empty() == false)
+    {
+        uint32 minItemTemplateID = std::numeric_limits<uint32>::max();
+        uint32 maxItemTemplateID = 0;
+        for (auto& itemTemplateItr : worldData.ItemTemplatesByEntryID)
+        {
+            minItemTemplateID = std::min(minItemTemplateID, itemTemplateItr.first);
+            maxItemTemplateID = std::max(maxItemTemplateID, itemTemplateItr.first);
+        }
+        worldData.ItemEQClassMaskBaseItemTemplateID = minItemTemplateID;
+        worldData.ItemEQClassMasksByItemTemplateIDOffset.assign((size_t)(maxItemTemplateID - minItemTemplateID) + 1, EQ_EQCLASS_MASK_ALL);
+        for (auto& itemTemplateItr : worldData.ItemTemplatesByEntryID)
+            if (itemTemplateItr.second.AllowedEQClassMask != 0)
+                worldData.ItemEQClassMasksByItemTemplateIDOffset[itemTemplateItr.first - minItemTemplateID] = itemTemplateItr.second.AllowedEQClassMask;
+    }
 }
 
 bool EverQuestMod::IsWornEffectSpell(uint32 spellID)
 {
-    return WornEffectSpellIDs.find(spellID) != WornEffectSpellIDs.end();
+    const EverQuestWorldData& worldData = GetWorldData();
+    return worldData.WornEffectSpellIDs.find(spellID) != worldData.WornEffectSpellIDs.end();
 }
 
 bool EverQuestMod::IsItemTemplateIDAnEQItemTemplateID(uint32 itemTemplateID)
@@ -1959,9 +2310,9 @@ static bool IsGearSwapRenderedEquipSlot(uint8 equipSlot)
     }
 }
 
-void EverQuestMod::LoadItemWoWToEQSwapData()
+void EverQuestMod::LoadItemWoWToEQSwapData(EverQuestWorldData& worldData)
 {
-    GearSwapCandidatesByLookupKey.clear();
+    worldData.GearSwapCandidatesByLookupKey.clear();
 
     QueryResult queryResult = WorldDatabase.Query("SELECT InventoryType, ItemClassID, ItemSubClassID, EQClassID, ItemTemplateID, ItemDisplayID FROM mod_everquest_item_wow_to_eq_swap;");
     if (!queryResult)
@@ -1980,10 +2331,10 @@ void EverQuestMod::LoadItemWoWToEQSwapData()
         EverQuestGearSwapCandidate swapCandidate;
         swapCandidate.ItemTemplateID = fields[4].Get<uint32>();
         swapCandidate.ItemDisplayID = fields[5].Get<uint32>();
-        GearSwapCandidatesByLookupKey[GetGearSwapLookupKey(inventoryType, itemClassID, itemSubClassID, eqClassID)].push_back(swapCandidate);
+        worldData.GearSwapCandidatesByLookupKey[GetGearSwapLookupKey(inventoryType, itemClassID, itemSubClassID, eqClassID)].push_back(swapCandidate);
         ++candidateCount;
     } while (queryResult->NextRow());
-    LOG_INFO("module.EverQuest", "EverQuestMod::LoadItemWoWToEQSwapData loaded {} gear swap candidates across {} pools", candidateCount, (uint32)GearSwapCandidatesByLookupKey.size());
+    LOG_INFO("module.EverQuest", "EverQuestMod::LoadItemWoWToEQSwapData loaded {} gear swap candidates across {} pools", candidateCount, (uint32)worldData.GearSwapCandidatesByLookupKey.size());
 }
 
 bool EverQuestMod::TryGetGearSwapPlayerState(Player* player, bool& hideWoWGear, uint8& secondEQClassID)
@@ -1999,19 +2350,20 @@ bool EverQuestMod::TryGetGearSwapPlayerState(Player* player, bool& hideWoWGear,
 
 uint32 EverQuestMod::GetGearSwapItemTemplateIDForWornItem(uint32 wearingPlayerGUIDCounter, uint8 rolledEQClassID, uint8 fallbackEQClassID, uint8 equipSlot, uint32 itemTemplateID)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
     ItemTemplate const* itemProto = sObjectMgr->GetItemTemplate(itemTemplateID);
     if (itemProto == nullptr)
         return 0;
 
     // The rolled class is used when it has a pool for this item, and otherwise the other class fills in
     const vector<EverQuestGearSwapCandidate>* swapCandidates = nullptr;
-    auto swapCandidatesItr = GearSwapCandidatesByLookupKey.find(GetGearSwapLookupKey(itemProto->InventoryType, itemProto->Class, itemProto->SubClass, rolledEQClassID));
-    if (swapCandidatesItr != GearSwapCandidatesByLookupKey.end())
+    auto swapCandidatesItr = worldData.GearSwapCandidatesByLookupKey.find(GetGearSwapLookupKey(itemProto->InventoryType, itemProto->Class, itemProto->SubClass, rolledEQClassID));
+    if (swapCandidatesItr != worldData.GearSwapCandidatesByLookupKey.end())
         swapCandidates = &swapCandidatesItr->second;
     else if (fallbackEQClassID != EQ_EQCLASS_NONE && fallbackEQClassID != rolledEQClassID)
     {
-        swapCandidatesItr = GearSwapCandidatesByLookupKey.find(GetGearSwapLookupKey(itemProto->InventoryType, itemProto->Class, itemProto->SubClass, fallbackEQClassID));
-        if (swapCandidatesItr != GearSwapCandidatesByLookupKey.end())
+        swapCandidatesItr = worldData.GearSwapCandidatesByLookupKey.find(GetGearSwapLookupKey(itemProto->InventoryType, itemProto->Class, itemProto->SubClass, fallbackEQClassID));
+        if (swapCandidatesItr != worldData.GearSwapCandidatesByLookupKey.end())
             swapCandidates = &swapCandidatesItr->second;
     }
 
@@ -2064,49 +2416,55 @@ void EverQuestMod::PatchVisibleGearFieldsInValuesUpdate(Player* wearingPlayer, B
 
 uint32 EverQuestMod::GetNPCEquipItemTemplateIDForItemTemplate(uint32 itemTemplateID)
 {
-    if (ItemTemplatesByEntryID.find(itemTemplateID) == ItemTemplatesByEntryID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.ItemTemplatesByEntryID.find(itemTemplateID) == worldData.ItemTemplatesByEntryID.end())
         return itemTemplateID;
     else
-        return ItemTemplatesByEntryID[itemTemplateID].ItemTemplateEntryIDForNPCEquip;
+        return worldData.ItemTemplatesByEntryID.at(itemTemplateID).ItemTemplateEntryIDForNPCEquip;
 }
 
 uint32 EverQuestMod::GetWornEffectSpellIDForItemTemplate(uint32 itemTemplateID)
 {
-    if (ItemTemplatesByEntryID.find(itemTemplateID) == ItemTemplatesByEntryID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.ItemTemplatesByEntryID.find(itemTemplateID) == worldData.ItemTemplatesByEntryID.end())
         return 0;
     else
-        return ItemTemplatesByEntryID[itemTemplateID].WornEffectSpellID;
+        return worldData.ItemTemplatesByEntryID.at(itemTemplateID).WornEffectSpellID;
 }
 
 bool EverQuestMod::IsItemEQClassAllowedForPlayer(Player* player, uint32 itemTemplateID)
 {
-    // No EQ template data = allowed
-    auto itemTemplateItr = ItemTemplatesByEntryID.find(itemTemplateID);
-    if (itemTemplateItr == ItemTemplatesByEntryID.end())
+    // No EQ template data or a zero mask = allowed (both come back as the all mask)
+    uint32 allowedEQClassMask = GetEQClassMaskForItemTemplate(itemTemplateID);
+    if (allowedEQClassMask == EQ_EQCLASS_MASK_ALL)
         return true;
+    return (allowedEQClassMask & GetEQClassMaskForPlayer(player)) != 0;
+}
 
-    // Zero mask = all
-    uint32 allowedEQClassMask = itemTemplateItr->second.AllowedEQClassMask;
-    if (allowedEQClassMask == 0)
-        return true;
+uint32 EverQuestMod::GetEQClassMaskForItemTemplate(uint32 itemTemplateID)
+{
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (itemTemplateID < worldData.ItemEQClassMaskBaseItemTemplateID)
+        return EQ_EQCLASS_MASK_ALL;
+    uint32 itemTemplateIDOffset = itemTemplateID - worldData.ItemEQClassMaskBaseItemTemplateID;
+    if (itemTemplateIDOffset >= worldData.ItemEQClassMasksByItemTemplateIDOffset.size())
+        return EQ_EQCLASS_MASK_ALL;
+    return worldData.ItemEQClassMasksByItemTemplateIDOffset[itemTemplateIDOffset];
+}
 
-    // Compare base class (no class map row means the shift below would be undefined, so allow the item)
+uint32 EverQuestMod::GetEQClassMaskForPlayer(Player* player)
+{
+    // No class map row means there's no EQ class to restrict on, so the player can use everything
     const EverQuestClassMap classMap = GetClassMapForWOWClassID(player->getClass());
     if (classMap.EQClassIDBase == 0)
-        return true;
-    uint32 baseEQClassBit = 1u << (classMap.EQClassIDBase - 1);
-    if ((allowedEQClassMask & baseEQClassBit) != 0)
-        return true;
+        return EQ_EQCLASS_MASK_ALL;
+    uint32 eqClassMask = 1u << (classMap.EQClassIDBase - 1);
 
     // Second class
     uint8 secondEQClass = GetCurrentSecondEQClassForPlayer(player);
-    if (secondEQClass == EQ_EQCLASS_NONE)
-        return false;
-    uint32 secondEQClassBit = 1u << (secondEQClass - 1);
-    if ((allowedEQClassMask & secondEQClassBit) != 0)
-        return true;
-
-    return false;
+    if (secondEQClass != EQ_EQCLASS_NONE)
+        eqClassMask |= 1u << (secondEQClass - 1);
+    return eqClassMask;
 }
 
 void EverQuestMod::SetAuctionUsableFilterActiveForPlayer(ObjectGuid playerGUID, bool active)
@@ -2130,48 +2488,51 @@ bool EverQuestMod::BuildEQClassFilteredAuctionListPacket(Player* player, WorldPa
     // Fixed byte size of one auction entry as written by SearchableAuctionEntry::BuildAuctionInfo (auction ID, item, entry ID, inspected enchants, random property, suffix factor, stack count, spell charges, flags, owner guid,
     // start bid, min outbid, buyout, time left, bidder guid, current bid)
     static const size_t auctionEntrySizeInBytes = 4 + 4 + (MAX_INSPECTED_ENCHANTMENT_SLOT * 12) + 4 + 4 + 4 + 4 + 4 + 8 + 4 + 4 + 4 + 4 + 8 + 4;
+    static const size_t auctionEntryItemTemplateIDOffset = 4;
+
+    // A player without EQ class restrictions keeps everything
+    uint32 playerEQClassMask = GetEQClassMaskForPlayer(player);
+    if (playerEQClassMask == EQ_EQCLASS_MASK_ALL)
+        return false;
 
-    WorldPacket packetCopy(packet);
-    packetCopy.rpos(0);
     try
     {
-        uint32 entryCount;
-        packetCopy >> entryCount;
-
         // Skip anything not "shaped" like the searcher's output (entry count + entries + total count + search delay)
-        if (packetCopy.size() != 4 + (entryCount * auctionEntrySizeInBytes) + 4 + 4)
+        uint32 entryCount = packet.read<uint32>(0);
+        if (packet.size() != 4 + ((size_t)entryCount * auctionEntrySizeInBytes) + 4 + 4)
             return false;
 
+        // Single compaction pass over the source buffer: runs of kept entries are appended as one block, and nothing is written
+        // at all until the first entry gets dropped
+        uint8 const* packetContents = packet.contents();
+        bool isFiltering = false;
         uint32 keptEntryCount = 0;
-        ByteBuffer keptEntryData;
-        for (uint32 i = 0; i < entryCount; ++i)
-        {
-            size_t entryStartPos = packetCopy.rpos();
-            uint32 auctionID;
-            uint32 itemTemplateID;
-            packetCopy >> auctionID;
-            packetCopy >> itemTemplateID;
-            packetCopy.rpos(entryStartPos + auctionEntrySizeInBytes);
-            if (IsItemEQClassAllowedForPlayer(player, itemTemplateID) == true)
+        size_t keptRunStartPos = 4;
+        size_t entryPos = 4;
+        for (uint32 i = 0; i < entryCount; ++i, entryPos += auctionEntrySizeInBytes)
+        {
+            uint32 itemTemplateID = packet.read<uint32>(entryPos + auctionEntryItemTemplateIDOffset);
+            if ((GetEQClassMaskForItemTemplate(itemTemplateID) & playerEQClassMask) != 0)
             {
-                keptEntryData.append(packetCopy.contents() + entryStartPos, auctionEntrySizeInBytes);
                 keptEntryCount++;
+                continue;
+            }
+            if (isFiltering == false)
+            {
+                filteredPacket.Initialize(SMSG_AUCTION_LIST_RESULT, packet.size() - auctionEntrySizeInBytes);
+                filteredPacket << uint32(0);
+                isFiltering = true;
             }
+            if (entryPos > keptRunStartPos)
+                filteredPacket.append(packetContents + keptRunStartPos, entryPos - keptRunStartPos);
+            keptRunStartPos = entryPos + auctionEntrySizeInBytes;
         }
-        if (keptEntryCount == entryCount)
+        if (isFiltering == false)
             return false;
 
-        uint32 totalCount;
-        uint32 searchDelay;
-        packetCopy >> totalCount;
-        packetCopy >> searchDelay;
-
-        filteredPacket.Initialize(SMSG_AUCTION_LIST_RESULT, 4 + (keptEntryCount * auctionEntrySizeInBytes) + 4 + 4);
-        filteredPacket << uint32(keptEntryCount);
-        if (keptEntryCount > 0)
-            filteredPacket.append(keptEntryData);
-        filteredPacket << uint32(totalCount);
-        filteredPacket << uint32(searchDelay);
+        // Last kept run plus the total count and search delay trailer, then patch the entry count
+        filteredPacket.append(packetContents + keptRunStartPos, packet.size() - keptRunStartPos);
+        filteredPacket.put<uint32>(0, keptEntryCount);
         return true;
     }
     catch (ByteBufferException const&)
@@ -2180,10 +2541,10 @@ bool EverQuestMod::BuildEQClassFilteredAuctionListPacket(Player* player, WorldPa
     }
 }
 
-void EverQuestMod::LoadSpellData()
+void EverQuestMod::LoadSpellData(EverQuestWorldData& worldData)
 {
-    SpellDataBySpellID.clear();
-    BardSongTickSpellIDs.clear();
+    worldData.SpellDataBySpellID.clear();
+    worldData.BardSongTickSpellIDs.clear();
     QueryResult queryResult = WorldDatabase.Query("SELECT SpellID, AuraDurationBaseInMS, AuraDurationAddPerLevelInMS, AuraDurationMaxInMS, AuraDurationCalcMinLevel, AuraDurationCalcMaxLevel, RecourseSpellID, SpellIDCastOnMeleeAttacker, FocusBoostType, PeriodicAuraSpellID, PeriodicAuraSpellRadius, MaleFormSpellID, FemaleFormSpellID, EffectFailChancePercent, EffectFailableType, StunUsesBashKickChance, SpellIDCastOnTargetWhenStunLands, AuraStaysOnSecondaryClassSwitch, MinTargetLevel, MaxCreatureTargetLevel, ResistDiff, HasteType, ModFactionRepValue, IllusionFormAlignment, IllusionFormEQRaceID, PersistOnClassChange FROM mod_everquest_spell ORDER BY SpellID;");
     if (queryResult)
     {
@@ -2218,18 +2579,19 @@ void EverQuestMod::LoadSpellData()
             everQuestSpell.IllusionFormAlignment = fields[23].Get<uint8>();
             everQuestSpell.IllusionFormEQRaceID = fields[24].Get<uint32>();
             everQuestSpell.PersistOnClassChange = fields[25].Get<bool>();
-            SpellDataBySpellID[everQuestSpell.SpellID] = everQuestSpell;
+            worldData.SpellDataBySpellID[everQuestSpell.SpellID] = everQuestSpell;
             if (everQuestSpell.PeriodicAuraSpellID != 0)
-                BardSongTickSpellIDs.insert(everQuestSpell.PeriodicAuraSpellID);
+                worldData.BardSongTickSpellIDs.insert(everQuestSpell.PeriodicAuraSpellID);
         } while (queryResult->NextRow());
     }
 }
 
 const EverQuestSpell& EverQuestMod::GetSpellDataForSpellID(uint32 spellID)
 {
-    if (SpellDataBySpellID.find(spellID) != SpellDataBySpellID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.SpellDataBySpellID.find(spellID) != worldData.SpellDataBySpellID.end())
     {
-        return SpellDataBySpellID[spellID];
+        return worldData.SpellDataBySpellID.at(spellID);
     }
     else
     {
@@ -2238,10 +2600,10 @@ const EverQuestSpell& EverQuestMod::GetSpellDataForSpellID(uint32 spellID)
     }
 }
 
-void EverQuestMod::LoadIllusionDisplayData()
+void EverQuestMod::LoadIllusionDisplayData(EverQuestWorldData& worldData)
 {
-    IllusionDisplayIDsByLookupKey.clear();
-    IllusionFormSpellIDs.clear();
+    worldData.IllusionDisplayIDsByLookupKey.clear();
+    worldData.IllusionFormSpellIDs.clear();
 
     QueryResult queryResult = WorldDatabase.Query("SELECT FormSpellID, BodySet, TintID, HelmOn, DisplayID FROM mod_everquest_illusion_display;");
     if (!queryResult)
@@ -2258,14 +2620,15 @@ void EverQuestMod::LoadIllusionDisplayData()
         uint32 tintID = (uint32)std::max(0, fields[2].Get<int32>());
         bool helmOn = fields[3].Get<bool>();
         uint32 displayID = fields[4].Get<uint32>();
-        IllusionDisplayIDsByLookupKey[GetIllusionDisplayLookupKey(formSpellID, bodySet, tintID, helmOn)] = displayID;
-        IllusionFormSpellIDs.insert(formSpellID);
+        worldData.IllusionDisplayIDsByLookupKey[GetIllusionDisplayLookupKey(formSpellID, bodySet, tintID, helmOn)] = displayID;
+        worldData.IllusionFormSpellIDs.insert(formSpellID);
     } while (queryResult->NextRow());
 }
 
 bool EverQuestMod::IsIllusionFormSpell(uint32 spellID)
 {
-    return IllusionFormSpellIDs.find(spellID) != IllusionFormSpellIDs.end();
+    const EverQuestWorldData& worldData = GetWorldData();
+    return worldData.IllusionFormSpellIDs.find(spellID) != worldData.IllusionFormSpellIDs.end();
 }
 
 uint64 EverQuestMod::GetIllusionDisplayLookupKey(uint32 formSpellID, uint32 bodySet, uint32 tintID, bool helmOn)
@@ -2276,8 +2639,9 @@ uint64 EverQuestMod::GetIllusionDisplayLookupKey(uint32 formSpellID, uint32 body
 
 bool EverQuestMod::TryGetIllusionDisplayID(uint32 formSpellID, uint32 bodySet, uint32 tintID, bool helmOn, uint32& displayIDOut)
 {
-    auto displayItr = IllusionDisplayIDsByLookupKey.find(GetIllusionDisplayLookupKey(formSpellID, bodySet, tintID, helmOn));
-    if (displayItr == IllusionDisplayIDsByLookupKey.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    auto displayItr = worldData.IllusionDisplayIDsByLookupKey.find(GetIllusionDisplayLookupKey(formSpellID, bodySet, tintID, helmOn));
+    if (displayItr == worldData.IllusionDisplayIDsByLookupKey.end())
         return false;
     displayIDOut = displayItr->second;
     return true;
@@ -2314,10 +2678,10 @@ uint32 EverQuestMod::GetIllusionBodySetForEQArmorMaterial(uint32 eqArmorMaterial
     return 0;
 }
 
-void EverQuestMod::LoadIllusionFaceData()
+void EverQuestMod::LoadIllusionFaceData(EverQuestWorldData& worldData)
 {
-    IllusionFaceDisplayIDsByLookupKey.clear();
-    IllusionMaxFaceIndex = 0;
+    worldData.IllusionFaceDisplayIDsByLookupKey.clear();
+    worldData.IllusionMaxFaceIndex = 0;
 
     // Rows only exist for face indexes of 1 and up, as face 0 is the base display itself
     QueryResult queryResult = WorldDatabase.Query("SELECT BaseDisplayID, FaceIndex, DisplayID FROM mod_everquest_illusion_face;");
@@ -2333,9 +2697,9 @@ void EverQuestMod::LoadIllusionFaceData()
         uint32 baseDisplayID = fields[0].Get<uint32>();
         uint32 faceIndex = (uint32)std::max(0, fields[1].Get<int32>());
         uint32 displayID = fields[2].Get<uint32>();
-        IllusionFaceDisplayIDsByLookupKey[GetIllusionFaceLookupKey(baseDisplayID, faceIndex)] = displayID;
-        if (faceIndex > IllusionMaxFaceIndex)
-            IllusionMaxFaceIndex = faceIndex;
+        worldData.IllusionFaceDisplayIDsByLookupKey[GetIllusionFaceLookupKey(baseDisplayID, faceIndex)] = displayID;
+        if (faceIndex > worldData.IllusionMaxFaceIndex)
+            worldData.IllusionMaxFaceIndex = faceIndex;
     } while (queryResult->NextRow());
 }
 
@@ -2347,26 +2711,30 @@ uint64 EverQuestMod::GetIllusionFaceLookupKey(uint32 baseDisplayID, uint32 faceI
 
 uint32 EverQuestMod::GetIllusionFaceDisplayIDForPlayer(Player* player, uint32 baseDisplayID)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
+
     // Face 0 is the base display itself, and any (base display, face) pair without a row falls back to the base display, which also covers players whose selected face is out of range for the current form's race
     uint32 playerFaceID = GetIllusionFaceIDForPlayer(player);
     if (playerFaceID == 0)
         return baseDisplayID;
-    auto faceItr = IllusionFaceDisplayIDsByLookupKey.find(GetIllusionFaceLookupKey(baseDisplayID, playerFaceID));
-    if (faceItr == IllusionFaceDisplayIDsByLookupKey.end())
+    auto faceItr = worldData.IllusionFaceDisplayIDsByLookupKey.find(GetIllusionFaceLookupKey(baseDisplayID, playerFaceID));
+    if (faceItr == worldData.IllusionFaceDisplayIDsByLookupKey.end())
         return baseDisplayID;
     return faceItr->second;
 }
 
 uint32 EverQuestMod::GetIllusionGearDisplayIDForPlayer(Player* player, uint32 formSpellID)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
+
     // Just use the chest to drive the outfit
     uint32 bodySet = 0;
     uint32 tintID = 0;
     Item* chestItem = player->GetItemByPos(INVENTORY_SLOT_BAG_0, EQUIPMENT_SLOT_CHEST);
     if (chestItem != nullptr)
     {
-        auto itemTemplateItr = ItemTemplatesByEntryID.find(chestItem->GetEntry());
-        if (itemTemplateItr != ItemTemplatesByEntryID.end())
+        auto itemTemplateItr = worldData.ItemTemplatesByEntryID.find(chestItem->GetEntry());
+        if (itemTemplateItr != worldData.ItemTemplatesByEntryID.end())
         {
             bodySet = GetIllusionBodySetForEQArmorMaterial(itemTemplateItr->second.EQArmorMaterial);
             tintID = itemTemplateItr->second.IllusionTintID;
@@ -2597,6 +2965,8 @@ bool EverQuestMod::IsCreatureCharmBlockedByCharmLimits(uint32 spellID, Unit* tar
 
 bool EverQuestMod::ApplyBardSongFearDiminishingReturnsOnAuraApply(Unit* target, Aura* aura)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
+
     // Diminishing returns will be 100% / 50% / 25% / immune chain for creature targets here, and returns true when shouldn't fear at all
     if (ConfigSpellBardFearDiminishingReturnsEnabled == false)
         return false;
@@ -2605,7 +2975,7 @@ bool EverQuestMod::ApplyBardSongFearDiminishingReturnsOnAuraApply(Unit* target,
     Creature* creature = target->ToCreature();
     if (creature == nullptr)
         return false;
-    if (BardSongTickSpellIDs.find(aura->GetId()) == BardSongTickSpellIDs.end())
+    if (worldData.BardSongTickSpellIDs.find(aura->GetId()) == worldData.BardSongTickSpellIDs.end())
         return false;
     SpellInfo const* spellInfo = aura->GetSpellInfo();
     if (spellInfo == nullptr || spellInfo->HasAura(SPELL_AURA_MOD_FEAR) == false)
@@ -2656,11 +3026,52 @@ void EverQuestMod::RemoveCreatureFearDiminishingReturnState(Creature* creature)
     creature->CustomData.Erase(EQ_CREATURE_CUSTOMDATA_FEARDIMINISH);
 }
 
-uint64 EverQuestMod::GetHasteTrackingKeyForUnit(Unit* unit)
+static uint8 GetHasteLedgerAuraTypeSlot(uint32 auraType)
 {
-    if (unit->IsPlayer() == true)
-        return 0;
-    return GetMapInstanceKey(unit->GetMap());
+    return auraType == SPELL_AURA_MOD_RANGED_HASTE ? 1 : 0;
+}
+
+static uint32 GetHasteLedgerHasteType(EverQuestUnitHasteAuraEffect const& hasteAuraEffect)
+{
+    if (hasteAuraEffect.HasteType < EQ_HASTE_TYPE_WORNITEM || hasteAuraEffect.HasteType > EQ_HASTE_TYPE_SPELL_V2)
+        return EQ_HASTE_TYPE_SPELL_V1;
+    return hasteAuraEffect.HasteType;
+}
+
+// Adds the effect, or updates its natural amount in place if it's already tracked (a refresh keeps its original apply position)
+static void AddOrRefreshHasteLedgerEffect(EverQuestUnitHasteLedgerState& hasteLedger, EverQuestUnitHasteAuraEffect const& hasteAuraEffect)
+{
+    uint8 auraTypeSlot = GetHasteLedgerAuraTypeSlot(hasteAuraEffect.AuraType);
+    uint32 hasteType = GetHasteLedgerHasteType(hasteAuraEffect);
+    auto effectKey = std::make_tuple(hasteAuraEffect.SpellID, hasteAuraEffect.CasterGUID, hasteAuraEffect.EffectIndex);
+    auto applySequenceItr = hasteLedger.ApplySequencesByEffect.find(effectKey);
+    if (applySequenceItr != hasteLedger.ApplySequencesByEffect.end())
+    {
+        EverQuestUnitHasteAuraEffect& trackedHasteAuraEffect = hasteLedger.EffectsByApplySequence[applySequenceItr->second];
+        set<pair<int32, uint32>>& rankedEffects = hasteLedger.RankedEffectsByAuraTypeSlotThenHasteType[auraTypeSlot][GetHasteLedgerHasteType(trackedHasteAuraEffect)];
+        rankedEffects.erase(std::make_pair(-trackedHasteAuraEffect.NaturalAmount, applySequenceItr->second));
+        trackedHasteAuraEffect.NaturalAmount = hasteAuraEffect.NaturalAmount;
+        hasteLedger.RankedEffectsByAuraTypeSlotThenHasteType[auraTypeSlot][GetHasteLedgerHasteType(trackedHasteAuraEffect)].insert(std::make_pair(-trackedHasteAuraEffect.NaturalAmount, applySequenceItr->second));
+        return;
+    }
+
+    uint32 applySequence = hasteLedger.NextApplySequence++;
+    hasteLedger.ApplySequencesByEffect[effectKey] = applySequence;
+    hasteLedger.EffectsByApplySequence[applySequence] = hasteAuraEffect;
+    hasteLedger.RankedEffectsByAuraTypeSlotThenHasteType[auraTypeSlot][hasteType].insert(std::make_pair(-hasteAuraEffect.NaturalAmount, applySequence));
+}
+
+static bool RemoveHasteLedgerEffect(EverQuestUnitHasteLedgerState& hasteLedger, uint32 applySequence)
+{
+    auto effectItr = hasteLedger.EffectsByApplySequence.find(applySequence);
+    if (effectItr == hasteLedger.EffectsByApplySequence.end())
+        return false;
+    EverQuestUnitHasteAuraEffect const& hasteAuraEffect = effectItr->second;
+    uint8 auraTypeSlot = GetHasteLedgerAuraTypeSlot(hasteAuraEffect.AuraType);
+    hasteLedger.RankedEffectsByAuraTypeSlotThenHasteType[auraTypeSlot][GetHasteLedgerHasteType(hasteAuraEffect)].erase(std::make_pair(-hasteAuraEffect.NaturalAmount, applySequence));
+    hasteLedger.ApplySequencesByEffect.erase(std::make_tuple(hasteAuraEffect.SpellID, hasteAuraEffect.CasterGUID, hasteAuraEffect.EffectIndex));
+    hasteLedger.EffectsByApplySequence.erase(effectItr);
+    return true;
 }
 
 void EverQuestMod::TrackEQHasteAurasAndEnforceCapOnAuraApply(Unit* unit, Aura* aura)
@@ -2691,12 +3102,7 @@ void EverQuestMod::TrackEQHasteAurasAndEnforceCapOnAuraApply(Unit* unit, Aura* a
     if (hasPositiveHasteEffect == false)
         return;
 
-    // Only the lookup needs the lock (the vector itself is only touched by the unit's own map thread)
-    vector<EverQuestUnitHasteAuraEffect>* trackedHasteAuraEffects = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(RuntimeStateMutex);
-        trackedHasteAuraEffects = &EQHasteAuraEffectsByMapInstanceKeyThenUnitGUID[GetHasteTrackingKeyForUnit(unit)][unit->GetGUID()];
-    }
+    EverQuestUnitHasteLedgerState* hasteLedger = unit->CustomData.GetDefault<EverQuestUnitHasteLedgerState>(EQ_UNIT_CUSTOMDATA_HASTELEDGER);
 
     // EQ haste category comes from the spell row, falling back to worn-spell lookup then the spell/song for safety
     uint32 hasteType = GetSpellDataForSpellID(spellID).HasteType;
@@ -2704,6 +3110,7 @@ void EverQuestMod::TrackEQHasteAurasAndEnforceCapOnAuraApply(Unit* unit, Aura* a
         hasteType = IsWornEffectSpell(spellID) == true ? EQ_HASTE_TYPE_WORNITEM : EQ_HASTE_TYPE_SPELL_V1;
 
     // Capture the natural (pre-cap) amounts.  Buff refreshes reset effect amounts to their recalculated natural values before this hook fires, so the current amount is always the natural amount here
+    vector<AuraEffect*> touchedAuraEffectsByAuraTypeSlot[2];
     for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
     {
         AuraEffect* auraEffect = aura->GetEffect(i);
@@ -2715,30 +3122,20 @@ void EverQuestMod::TrackEQHasteAurasAndEnforceCapOnAuraApply(Unit* unit, Aura* a
         if (auraEffect->GetAmount() <= 0)
             continue;
 
-        bool foundExisting = false;
-        for (EverQuestUnitHasteAuraEffect& trackedHasteAuraEffect : *trackedHasteAuraEffects)
-        {
-            if (trackedHasteAuraEffect.SpellID == spellID && trackedHasteAuraEffect.CasterGUID == aura->GetCasterGUID() && trackedHasteAuraEffect.EffectIndex == i)
-            {
-                trackedHasteAuraEffect.NaturalAmount = auraEffect->GetAmount();
-                foundExisting = true;
-                break;
-            }
-        }
-        if (foundExisting == false)
-        {
-            EverQuestUnitHasteAuraEffect trackedHasteAuraEffect;
-            trackedHasteAuraEffect.SpellID = spellID;
-            trackedHasteAuraEffect.CasterGUID = aura->GetCasterGUID();
-            trackedHasteAuraEffect.EffectIndex = i;
-            trackedHasteAuraEffect.AuraType = (uint32)auraType;
-            trackedHasteAuraEffect.NaturalAmount = auraEffect->GetAmount();
-            trackedHasteAuraEffect.HasteType = hasteType;
-            trackedHasteAuraEffects->push_back(trackedHasteAuraEffect);
-        }
+        EverQuestUnitHasteAuraEffect trackedHasteAuraEffect;
+        trackedHasteAuraEffect.SpellID = spellID;
+        trackedHasteAuraEffect.CasterGUID = aura->GetCasterGUID();
+        trackedHasteAuraEffect.EffectIndex = i;
+        trackedHasteAuraEffect.AuraType = (uint32)auraType;
+        trackedHasteAuraEffect.NaturalAmount = auraEffect->GetAmount();
+        trackedHasteAuraEffect.HasteType = hasteType;
+        AddOrRefreshHasteLedgerEffect(*hasteLedger, trackedHasteAuraEffect);
+        touchedAuraEffectsByAuraTypeSlot[GetHasteLedgerAuraTypeSlot(auraType)].push_back(auraEffect);
     }
 
-    EnforceEQHastePercentCapOnUnit(unit, *trackedHasteAuraEffects);
+    for (uint8 auraTypeSlot = 0; auraTypeSlot < 2; ++auraTypeSlot)
+        if (touchedAuraEffectsByAuraTypeSlot[auraTypeSlot].empty() == false)
+            EnforceEQHastePercentCapOnUnit(unit, *hasteLedger, auraTypeSlot, touchedAuraEffectsByAuraTypeSlot[auraTypeSlot]);
 }
 
 void EverQuestMod::UntrackEQHasteAurasAndEnforceCapOnAuraRemove(Unit* unit, Aura* aura)
@@ -2748,113 +3145,118 @@ void EverQuestMod::UntrackEQHasteAurasAndEnforceCapOnAuraRemove(Unit* unit, Aura
     uint32 spellID = aura->GetId();
     if (spellID < ConfigSystemSpellDBCIDMin || spellID > ConfigSystemSpellDBCIDMax)
         return;
+    EverQuestUnitHasteLedgerState* hasteLedger = unit->CustomData.Get<EverQuestUnitHasteLedgerState>(EQ_UNIT_CUSTOMDATA_HASTELEDGER);
+    if (hasteLedger == nullptr)
+        return;
 
-    // Only the lookup needs the lock (the vector itself is only touched by the unit's own map thread)
-    vector<EverQuestUnitHasteAuraEffect>* trackedHasteAuraEffects = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(RuntimeStateMutex);
-        auto trackedMapIter = EQHasteAuraEffectsByMapInstanceKeyThenUnitGUID.find(GetHasteTrackingKeyForUnit(unit));
-        if (trackedMapIter == EQHasteAuraEffectsByMapInstanceKeyThenUnitGUID.end())
-            return;
-        auto trackedIter = trackedMapIter->second.find(unit->GetGUID());
-        if (trackedIter == trackedMapIter->second.end())
-            return;
-        trackedHasteAuraEffects = &trackedIter->second;
-    }
-
-    bool removedAny = false;
-    for (vector<EverQuestUnitHasteAuraEffect>::iterator effectIter = trackedHasteAuraEffects->begin(); effectIter != trackedHasteAuraEffects->end();)
+    bool removedFromAuraTypeSlot[2] = { false, false };
+    for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
     {
-        if (effectIter->SpellID == spellID && effectIter->CasterGUID == aura->GetCasterGUID())
-        {
-            effectIter = trackedHasteAuraEffects->erase(effectIter);
-            removedAny = true;
-        }
-        else
-            ++effectIter;
+        auto applySequenceItr = hasteLedger->ApplySequencesByEffect.find(std::make_tuple(spellID, aura->GetCasterGUID(), i));
+        if (applySequenceItr == hasteLedger->ApplySequencesByEffect.end())
+            continue;
+        uint8 auraTypeSlot = GetHasteLedgerAuraTypeSlot(hasteLedger->EffectsByApplySequence[applySequenceItr->second].AuraType);
+        if (RemoveHasteLedgerEffect(*hasteLedger, applySequenceItr->second) == true)
+            removedFromAuraTypeSlot[auraTypeSlot] = true;
     }
-    if (removedAny == false)
-        return;
-
-    if (trackedHasteAuraEffects->empty() == true)
+    if (hasteLedger->EffectsByApplySequence.empty() == true)
     {
-        std::lock_guard<std::mutex> lock(RuntimeStateMutex);
-        auto trackedMapIter = EQHasteAuraEffectsByMapInstanceKeyThenUnitGUID.find(GetHasteTrackingKeyForUnit(unit));
-        if (trackedMapIter != EQHasteAuraEffectsByMapInstanceKeyThenUnitGUID.end())
-        {
-            trackedMapIter->second.erase(unit->GetGUID());
-            if (trackedMapIter->second.empty())
-                EQHasteAuraEffectsByMapInstanceKeyThenUnitGUID.erase(trackedMapIter);
-        }
+        unit->CustomData.Erase(EQ_UNIT_CUSTOMDATA_HASTELEDGER);
         return;
     }
 
-    EnforceEQHastePercentCapOnUnit(unit, *trackedHasteAuraEffects);
+    static const vector<AuraEffect*> noTouchedAuraEffects;
+    for (uint8 auraTypeSlot = 0; auraTypeSlot < 2; ++auraTypeSlot)
+        if (removedFromAuraTypeSlot[auraTypeSlot] == true)
+            EnforceEQHastePercentCapOnUnit(unit, *hasteLedger, auraTypeSlot, noTouchedAuraEffects);
 }
 
-void EverQuestMod::EnforceEQHastePercentCapOnUnit(Unit* unit, vector<EverQuestUnitHasteAuraEffect>& trackedHasteAuraEffects)
+void EverQuestMod::EnforceEQHastePercentCapOnUnit(Unit* unit, EverQuestUnitHasteLedgerState& hasteLedger, uint8 auraTypeSlot, vector<AuraEffect*> const& touchedAuraEffects)
 {
     float capPercent = GetEQHasteCapPercentForUnit(unit);
     uint8 unitLevel = unit->GetLevel();
 
     // EQ haste never stacks within a category (worn/item, spell/song/clicky, v2) - only the strongest effect of each category applies and
-    // the categories then add together additively, matching TAKP Mob::GetHaste.  WoW stacks haste auras multiplicatively, so walk the effects
-    // in apply order and clamp each applied amount such that the combined multiplier equals what the capped additive total of the category
+    // the categories then add together additively, matching TAKP Mob::GetHaste.  WoW stacks haste auras multiplicatively, so walk the category
+    // winners in apply order and clamp each applied amount such that the combined multiplier equals what the capped additive total of the
     // winners would give.  Losing effects stay on the unit as visible buffs but get clamped to zero, and get restored if their category winner
-    // is removed.  Melee and ranged process independently
-    uint32 auraTypesToProcess[2] = { SPELL_AURA_MOD_MELEE_HASTE, SPELL_AURA_MOD_RANGED_HASTE };
-    for (uint32 auraType : auraTypesToProcess)
+    // is removed.  Melee and ranged process independently, and only the winners and the effects that just changed are touched
+
+    // The strongest (then oldest) effect per category (haste types 1 = worn, 2 = spell/song/clicky, 3 = v2) heads its ranked set.  An effect
+    // whose aura went away without a remove hook is dropped from the ledger here
+    AuraEffect* winnerAuraEffectByHasteType[4] = { nullptr, nullptr, nullptr, nullptr };
+    uint32 winnerApplySequenceByHasteType[4] = { 0, 0, 0, 0 };
+    for (uint32 hasteType = EQ_HASTE_TYPE_WORNITEM; hasteType <= EQ_HASTE_TYPE_SPELL_V2; ++hasteType)
     {
-        // Find the strongest active effect per category (haste types 1 = worn, 2 = spell/song/clicky, 3 = v2)
-        int winnerIndexByHasteType[4] = { -1, -1, -1, -1 };
-        for (size_t i = 0; i < trackedHasteAuraEffects.size(); ++i)
+        set<pair<int32, uint32>>& rankedEffects = hasteLedger.RankedEffectsByAuraTypeSlotThenHasteType[auraTypeSlot][hasteType];
+        while (rankedEffects.empty() == false)
         {
-            EverQuestUnitHasteAuraEffect& trackedHasteAuraEffect = trackedHasteAuraEffects[i];
-            if (trackedHasteAuraEffect.AuraType != auraType)
-                continue;
-            if (unit->GetAuraEffect(trackedHasteAuraEffect.SpellID, trackedHasteAuraEffect.EffectIndex, trackedHasteAuraEffect.CasterGUID) == nullptr)
-                continue;
-            uint32 hasteType = trackedHasteAuraEffect.HasteType;
-            if (hasteType < EQ_HASTE_TYPE_WORNITEM || hasteType > EQ_HASTE_TYPE_SPELL_V2)
-                hasteType = EQ_HASTE_TYPE_SPELL_V1;
-            int winnerIndex = winnerIndexByHasteType[hasteType];
-            if (winnerIndex == -1 || trackedHasteAuraEffect.NaturalAmount > trackedHasteAuraEffects[winnerIndex].NaturalAmount)
-                winnerIndexByHasteType[hasteType] = (int)i;
+            uint32 applySequence = rankedEffects.begin()->second;
+            EverQuestUnitHasteAuraEffect const& hasteAuraEffect = hasteLedger.EffectsByApplySequence[applySequence];
+            AuraEffect* auraEffect = unit->GetAuraEffect(hasteAuraEffect.SpellID, hasteAuraEffect.EffectIndex, hasteAuraEffect.CasterGUID);
+            if (auraEffect != nullptr)
+            {
+                winnerAuraEffectByHasteType[hasteType] = auraEffect;
+                winnerApplySequenceByHasteType[hasteType] = applySequence;
+                break;
+            }
+            RemoveHasteLedgerEffect(hasteLedger, applySequence);
         }
+    }
 
-        // In TAKP worn haste is capped at 10 until level 26, v2 haste only works at level 50+ and adds at most 10
-        float contributionsByHasteType[4] = { 0, 0, 0, 0 };
-        if (winnerIndexByHasteType[1] >= 0)
-        {
-            float wornAmount = (float)trackedHasteAuraEffects[winnerIndexByHasteType[1]].NaturalAmount;
-            contributionsByHasteType[1] = unitLevel > 25 ? wornAmount : std::min(wornAmount, 10.0f);
-        }
-        if (winnerIndexByHasteType[2] >= 0)
-            contributionsByHasteType[2] = (float)trackedHasteAuraEffects[winnerIndexByHasteType[2]].NaturalAmount;
-        if (winnerIndexByHasteType[3] >= 0 && unitLevel > 49)
-            contributionsByHasteType[3] = std::min((float)trackedHasteAuraEffects[winnerIndexByHasteType[3]].NaturalAmount, 10.0f);
+    // In TAKP worn haste is capped at 10 until level 26, v2 haste only works at level 50+ and adds at most 10
+    float contributionsByHasteType[4] = { 0, 0, 0, 0 };
+    if (winnerApplySequenceByHasteType[1] != 0)
+    {
+        float wornAmount = (float)hasteLedger.EffectsByApplySequence[winnerApplySequenceByHasteType[1]].NaturalAmount;
+        contributionsByHasteType[1] = unitLevel > 25 ? wornAmount : std::min(wornAmount, 10.0f);
+    }
+    if (winnerApplySequenceByHasteType[2] != 0)
+        contributionsByHasteType[2] = (float)hasteLedger.EffectsByApplySequence[winnerApplySequenceByHasteType[2]].NaturalAmount;
+    if (winnerApplySequenceByHasteType[3] != 0 && unitLevel > 49)
+        contributionsByHasteType[3] = std::min((float)hasteLedger.EffectsByApplySequence[winnerApplySequenceByHasteType[3]].NaturalAmount, 10.0f);
 
-        float runningTotalPercent = 0;
-        float previousCappedTotalPercent = 0;
-        for (size_t i = 0; i < trackedHasteAuraEffects.size(); ++i)
+    // Winners in apply order
+    uint32 orderedHasteTypes[3] = { EQ_HASTE_TYPE_WORNITEM, EQ_HASTE_TYPE_SPELL_V1, EQ_HASTE_TYPE_SPELL_V2 };
+    std::sort(std::begin(orderedHasteTypes), std::end(orderedHasteTypes), [&winnerApplySequenceByHasteType](uint32 left, uint32 right)
         {
-            EverQuestUnitHasteAuraEffect& trackedHasteAuraEffect = trackedHasteAuraEffects[i];
-            if (trackedHasteAuraEffect.AuraType != auraType)
-                continue;
-            AuraEffect* auraEffect = unit->GetAuraEffect(trackedHasteAuraEffect.SpellID, trackedHasteAuraEffect.EffectIndex, trackedHasteAuraEffect.CasterGUID);
-            if (auraEffect == nullptr)
-                continue;
-            uint32 hasteType = trackedHasteAuraEffect.HasteType;
-            if (hasteType < EQ_HASTE_TYPE_WORNITEM || hasteType > EQ_HASTE_TYPE_SPELL_V2)
-                hasteType = EQ_HASTE_TYPE_SPELL_V1;
-            if (winnerIndexByHasteType[hasteType] == (int)i)
-                runningTotalPercent += contributionsByHasteType[hasteType];
-            float cappedTotalPercent = std::min(runningTotalPercent, capPercent);
-            int32 newAmount = (int32)std::lround(100.0f * ((100.0f + cappedTotalPercent) / (100.0f + previousCappedTotalPercent)) - 100.0f);
-            previousCappedTotalPercent = cappedTotalPercent;
-            if (auraEffect->GetAmount() != newAmount)
-                auraEffect->ChangeAmount(newAmount);
-        }
+            return winnerApplySequenceByHasteType[left] < winnerApplySequenceByHasteType[right];
+        });
+    float runningTotalPercent = 0;
+    float previousCappedTotalPercent = 0;
+    for (uint32 hasteType : orderedHasteTypes)
+    {
+        AuraEffect* auraEffect = winnerAuraEffectByHasteType[hasteType];
+        if (auraEffect == nullptr)
+            continue;
+        runningTotalPercent += contributionsByHasteType[hasteType];
+        float cappedTotalPercent = std::min(runningTotalPercent, capPercent);
+        int32 newAmount = (int32)std::lround(100.0f * ((100.0f + cappedTotalPercent) / (100.0f + previousCappedTotalPercent)) - 100.0f);
+        previousCappedTotalPercent = cappedTotalPercent;
+        if (auraEffect->GetAmount() != newAmount)
+            auraEffect->ChangeAmount(newAmount);
+    }
+
+    // Anything that just lost its category, and any touched effect that isn't a winner, applies nothing
+    for (uint32 hasteType = EQ_HASTE_TYPE_WORNITEM; hasteType <= EQ_HASTE_TYPE_SPELL_V2; ++hasteType)
+    {
+        uint32 previousWinnerApplySequence = hasteLedger.WinnerApplySequenceByAuraTypeSlotThenHasteType[auraTypeSlot][hasteType];
+        hasteLedger.WinnerApplySequenceByAuraTypeSlotThenHasteType[auraTypeSlot][hasteType] = winnerApplySequenceByHasteType[hasteType];
+        if (previousWinnerApplySequence == 0 || previousWinnerApplySequence == winnerApplySequenceByHasteType[hasteType])
+            continue;
+        auto previousWinnerItr = hasteLedger.EffectsByApplySequence.find(previousWinnerApplySequence);
+        if (previousWinnerItr == hasteLedger.EffectsByApplySequence.end())
+            continue;
+        AuraEffect* auraEffect = unit->GetAuraEffect(previousWinnerItr->second.SpellID, previousWinnerItr->second.EffectIndex, previousWinnerItr->second.CasterGUID);
+        if (auraEffect != nullptr && auraEffect->GetAmount() != 0)
+            auraEffect->ChangeAmount(0);
+    }
+    for (AuraEffect* touchedAuraEffect : touchedAuraEffects)
+    {
+        if (std::find(std::begin(winnerAuraEffectByHasteType), std::end(winnerAuraEffectByHasteType), touchedAuraEffect) != std::end(winnerAuraEffectByHasteType))
+            continue;
+        if (touchedAuraEffect->GetAmount() != 0)
+            touchedAuraEffect->ChangeAmount(0);
     }
 }
 
@@ -3072,9 +3474,9 @@ void EverQuestMod::ClearAgileFighterTrackingForPlayer(ObjectGuid playerGUID)
     AgileFighterRefreshTimerMSByPlayerGUID.erase(playerGUID);
 }
 
-void EverQuestMod::LoadQuestCompletionReputations()
+void EverQuestMod::LoadQuestCompletionReputations(EverQuestWorldData& worldData)
 {
-    QuestCompletionReputationsByQuestTemplateID.clear();
+    worldData.QuestCompletionReputationsByQuestTemplateID.clear();
     QueryResult queryResult = WorldDatabase.Query("SELECT QuestTemplateID, SortOrder, FactionID, CompletionRewardValue FROM mod_everquest_quest_complete_reputation ORDER BY QuestTemplateID, SortOrder;");
     if (queryResult)
     {
@@ -3087,16 +3489,17 @@ void EverQuestMod::LoadQuestCompletionReputations()
             questCompletionReputation.SortOrder = fields[1].Get<uint8>();
             questCompletionReputation.FactionID = fields[2].Get<uint32>();
             questCompletionReputation.CompletionRewardValue = fields[3].Get<int32>();
-            QuestCompletionReputationsByQuestTemplateID[questCompletionReputation.QuestTemplateID].push_back(questCompletionReputation);
+            worldData.QuestCompletionReputationsByQuestTemplateID[questCompletionReputation.QuestTemplateID].push_back(questCompletionReputation);
         } while (queryResult->NextRow());
     }
 }
 
 const list<EverQuestQuestCompletionReputation>& EverQuestMod::GetQuestCompletionReputationsForQuestTemplate(uint32 questTemplateID)
 {
-    if (QuestCompletionReputationsByQuestTemplateID.find(questTemplateID) != QuestCompletionReputationsByQuestTemplateID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.QuestCompletionReputationsByQuestTemplateID.find(questTemplateID) != worldData.QuestCompletionReputationsByQuestTemplateID.end())
     {
-        return QuestCompletionReputationsByQuestTemplateID[questTemplateID];
+        return worldData.QuestCompletionReputationsByQuestTemplateID.at(questTemplateID);
     }
     else
     {
@@ -3105,9 +3508,9 @@ const list<EverQuestQuestCompletionReputation>& EverQuestMod::GetQuestCompletion
     }
 }
 
-void EverQuestMod::LoadQuestReactions()
+void EverQuestMod::LoadQuestReactions(EverQuestWorldData& worldData)
 {
-    QuestReactionListByQuestTemplateID.clear();
+    worldData.QuestReactionListByQuestTemplateID.clear();
     QueryResult queryResult = WorldDatabase.Query("SELECT QuestTemplateID, ReactionType, UsePlayerX, UsePlayerY, UsePlayerZ, AddedPlayerX, AddedPlayerY, UsePlayerOrientation, PositionX, PositionY, PositionZ, Orientation, CreatureTemplateID, QuestgiverCreatureTemplateID, DelayInMS FROM mod_everquest_quest_reaction;");
     if (queryResult)
     {
@@ -3131,16 +3534,17 @@ void EverQuestMod::LoadQuestReactions()
             everQuestQuestReaction.CreatureTemplateID = fields[12].Get<uint32>();
             everQuestQuestReaction.QuestgiverCreatureTemplateID = fields[13].Get<uint32>();
             everQuestQuestReaction.DelayInMS = fields[14].Get<uint32>();
-            QuestReactionListByQuestTemplateID[everQuestQuestReaction.QuestTemplateID].push_back(everQuestQuestReaction);
+            worldData.QuestReactionListByQuestTemplateID[everQuestQuestReaction.QuestTemplateID].push_back(everQuestQuestReaction);
         } while (queryResult->NextRow());
     }
 }
 
 const list<EverQuestQuestReaction>& EverQuestMod::GetQuestReactions(uint32 questTemplateID)
 {
-    if (QuestReactionListByQuestTemplateID.find(questTemplateID) != QuestReactionListByQuestTemplateID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.QuestReactionListByQuestTemplateID.find(questTemplateID) != worldData.QuestReactionListByQuestTemplateID.end())
     {
-        return QuestReactionListByQuestTemplateID[questTemplateID];
+        return worldData.QuestReactionListByQuestTemplateID.at(questTemplateID);
     }
     else
     {
@@ -3149,9 +3553,9 @@ const list<EverQuestQuestReaction>& EverQuestMod::GetQuestReactions(uint32 quest
     }
 }
 
-void EverQuestMod::LoadGossipReactions()
+void EverQuestMod::LoadGossipReactions(EverQuestWorldData& worldData)
 {
-    GossipReactionsByGossipCreatureTemplateID.clear();
+    worldData.GossipReactionsByGossipCreatureTemplateID.clear();
     QueryResult queryResult = WorldDatabase.Query("SELECT GossipCreatureTemplateID, NpcTextID, OptionID, OptionText, ReactionType, SayText, TargetCreatureTemplateID, UsePlayerX, UsePlayerY, UsePlayerZ, AddedPlayerX, AddedPlayerY, UsePlayerOrientation, UseNpcX, UseNpcY, UseNpcZ, UseNpcOrientation, PositionX, PositionY, PositionZ, Orientation, DelayInMS FROM mod_everquest_gossip_reaction ORDER BY GossipCreatureTemplateID, ID;");
     if (queryResult)
     {
@@ -3182,21 +3586,22 @@ void EverQuestMod::LoadGossipReactions()
             gossipReaction.PositionZ = fields[19].Get<float>();
             gossipReaction.Orientation = fields[20].Get<float>();
             gossipReaction.DelayInMS = fields[21].Get<uint32>();
-            GossipReactionsByGossipCreatureTemplateID[gossipReaction.GossipCreatureTemplateID].push_back(gossipReaction);
+            worldData.GossipReactionsByGossipCreatureTemplateID[gossipReaction.GossipCreatureTemplateID].push_back(gossipReaction);
         } while (queryResult->NextRow());
     }
 }
 
 bool EverQuestMod::HandleGossipHello(Player* player, Creature* creature)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
     if (IsEnabled == false)
         return false;
 
     // Talking to the creature is the closest analog to saying 'Hail' in EQ
     bool firedHailedEmote = DoCreatureEmoteEvent(creature, EQ_CREATURE_EMOTE_EVENT_HAILED, player);
 
-    unordered_map<uint32, vector<EverQuestGossipReaction>>::const_iterator gossipReactionsIterator = GossipReactionsByGossipCreatureTemplateID.find(creature->GetEntry());
-    if (gossipReactionsIterator == GossipReactionsByGossipCreatureTemplateID.end())
+    unordered_map<uint32, vector<EverQuestGossipReaction>>::const_iterator gossipReactionsIterator = worldData.GossipReactionsByGossipCreatureTemplateID.find(creature->GetEntry());
+    if (gossipReactionsIterator == worldData.GossipReactionsByGossipCreatureTemplateID.end())
     {
         // Creatures that only exist as gossip targets for a hailed emote shouldn't open an empty gossip window, but any creature with a real role should fall through to its normal handling
         if (firedHailedEmote == true && creature->IsQuestGiver() == false && creature->IsVendor() == false && creature->IsTrainer() == false
@@ -3229,10 +3634,11 @@ bool EverQuestMod::HandleGossipHello(Player* player, Creature* creature)
 
 bool EverQuestMod::HandleGossipSelect(Player* player, Creature* creature, uint32 /*sender*/, uint32 action)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
     if (IsEnabled == false)
         return false;
-    unordered_map<uint32, vector<EverQuestGossipReaction>>::const_iterator gossipReactionsIterator = GossipReactionsByGossipCreatureTemplateID.find(creature->GetEntry());
-    if (gossipReactionsIterator == GossipReactionsByGossipCreatureTemplateID.end())
+    unordered_map<uint32, vector<EverQuestGossipReaction>>::const_iterator gossipReactionsIterator = worldData.GossipReactionsByGossipCreatureTemplateID.find(creature->GetEntry());
+    if (gossipReactionsIterator == worldData.GossipReactionsByGossipCreatureTemplateID.end())
         return false;
 
     Map* map = creature->GetMap();
@@ -3351,9 +3757,9 @@ string EverQuestMod::FormatGossipTextForPlayer(Player* player, const string& tex
     return formattedText;
 }
 
-void EverQuestMod::LoadPetData()
+void EverQuestMod::LoadPetData(EverQuestWorldData& worldData)
 {
-    PetDataByCreatureTemplateID.clear();
+    worldData.PetDataByCreatureTemplateID.clear();
     QueryResult queryResult = WorldDatabase.Query("SELECT CreatingSpellID, NamingType, CreatureTemplateID, SummonPropertiesID, MainhandItemID, OffhandItemID FROM mod_everquest_pet ORDER BY CreatingSpellID;");
     if (queryResult)
     {
@@ -3368,14 +3774,14 @@ void EverQuestMod::LoadPetData()
             everQuestPet.SummonPropertiesID = fields[3].Get<int32>();
             everQuestPet.MainhandItemTemplateID = fields[4].Get<int32>();
             everQuestPet.OffhandItemTemplateID = fields[5].Get<int32>();
-            PetDataByCreatureTemplateID[everQuestPet.CreatureTemplateID] = everQuestPet;
+            worldData.PetDataByCreatureTemplateID[everQuestPet.CreatureTemplateID] = everQuestPet;
         } while (queryResult->NextRow());
     }
 }
 
-void EverQuestMod::LoadPetSilentDisplayData()
+void EverQuestMod::LoadPetSilentDisplayData(EverQuestWorldData& worldData)
 {
-    SilentFidgetDisplayIDsByDisplayID.clear();
+    worldData.SilentFidgetDisplayIDsByDisplayID.clear();
     QueryResult queryResult = WorldDatabase.Query("SELECT DisplayID, SilentDisplayID FROM mod_everquest_pet_silent_display;");
     if (queryResult)
     {
@@ -3384,20 +3790,20 @@ void EverQuestMod::LoadPetSilentDisplayData()
             Field* fields = queryResult->Fetch();
             uint32 displayID = fields[0].Get<uint32>();
             uint32 silentDisplayID = fields[1].Get<uint32>();
-            SilentFidgetDisplayIDsByDisplayID[displayID] = silentDisplayID;
+            worldData.SilentFidgetDisplayIDsByDisplayID[displayID] = silentDisplayID;
         } while (queryResult->NextRow());
     }
 }
 
-void EverQuestMod::RemoveInvalidPetSilentDisplays()
+void EverQuestMod::RemoveInvalidPetSilentDisplays(EverQuestWorldData& worldData)
 {
-    unordered_map<uint32, uint32>::iterator displayIter = SilentFidgetDisplayIDsByDisplayID.begin();
-    while (displayIter != SilentFidgetDisplayIDsByDisplayID.end())
+    unordered_map<uint32, uint32>::iterator displayIter = worldData.SilentFidgetDisplayIDsByDisplayID.begin();
+    while (displayIter != worldData.SilentFidgetDisplayIDsByDisplayID.end())
     {
         if (sCreatureDisplayInfoStore.LookupEntry(displayIter->second) == nullptr)
         {
             LOG_ERROR("module.EverQuest", "EverQuestMod::RemoveInvalidPetSilentDisplays dropped display ID {} as its silent display ID {} is missing from CreatureDisplayInfo.dbc.  Deploy the current DBC files.", displayIter->first, displayIter->second);
-            displayIter = SilentFidgetDisplayIDsByDisplayID.erase(displayIter);
+            displayIter = worldData.SilentFidgetDisplayIDsByDisplayID.erase(displayIter);
         }
         else
             ++displayIter;
@@ -3406,8 +3812,9 @@ void EverQuestMod::RemoveInvalidPetSilentDisplays()
 
 uint32 EverQuestMod::GetSilentFidgetDisplayIDForDisplayID(uint32 displayID) const
 {
-    unordered_map<uint32, uint32>::const_iterator displayIter = SilentFidgetDisplayIDsByDisplayID.find(displayID);
-    if (displayIter == SilentFidgetDisplayIDsByDisplayID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    unordered_map<uint32, uint32>::const_iterator displayIter = worldData.SilentFidgetDisplayIDsByDisplayID.find(displayID);
+    if (displayIter == worldData.SilentFidgetDisplayIDsByDisplayID.end())
         return 0;
     return displayIter->second;
 }
@@ -3465,7 +3872,8 @@ void EverQuestMod::FixInvalidCharacterPetModelIDs()
 
 bool EverQuestMod::HasPetDataForCreatureTemplateID(uint32 creatureTemplateID)
 {
-    if (PetDataByCreatureTemplateID.find(creatureTemplateID) != PetDataByCreatureTemplateID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.PetDataByCreatureTemplateID.find(creatureTemplateID) != worldData.PetDataByCreatureTemplateID.end())
         return true;
     else
         return false;
@@ -3473,9 +3881,10 @@ bool EverQuestMod::HasPetDataForCreatureTemplateID(uint32 creatureTemplateID)
 
 const EverQuestPet& EverQuestMod::GetPetDataForCreatureTemplateID(uint32 creatureTemplateID)
 {
-    if (PetDataByCreatureTemplateID.find(creatureTemplateID) != PetDataByCreatureTemplateID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.PetDataByCreatureTemplateID.find(creatureTemplateID) != worldData.PetDataByCreatureTemplateID.end())
     {
-        return PetDataByCreatureTemplateID[creatureTemplateID];
+        return worldData.PetDataByCreatureTemplateID.at(creatureTemplateID);
     }
     else
     {
@@ -3484,9 +3893,9 @@ const EverQuestPet& EverQuestMod::GetPetDataForCreatureTemplateID(uint32 creatur
     }
 }
 
-void EverQuestMod::LoadCreatePlayerData()
+void EverQuestMod::LoadCreatePlayerData(EverQuestWorldData& worldData)
 {
-    PlayerCreateInfoByRaceIDThenClassID.clear();
+    worldData.PlayerCreateInfoByRaceIDThenClassID.clear();
     QueryResult queryResult = WorldDatabase.Query("SELECT race, class, map, zone, position_x, position_y, position_z, orientation, illusionitem FROM mod_everquest_playercreateinfo;");
     if (queryResult)
     {
@@ -3504,14 +3913,14 @@ void EverQuestMod::LoadCreatePlayerData()
             everQuestPlayerCreateInfo.PositionZ = fields[6].Get<float>();
             everQuestPlayerCreateInfo.Orientation = fields[7].Get<float>();
             everQuestPlayerCreateInfo.IllusionItemID = fields[8].Get<uint32>();
-            PlayerCreateInfoByRaceIDThenClassID[everQuestPlayerCreateInfo.RaceID][everQuestPlayerCreateInfo.ClassID] = everQuestPlayerCreateInfo;
+            worldData.PlayerCreateInfoByRaceIDThenClassID[everQuestPlayerCreateInfo.RaceID][everQuestPlayerCreateInfo.ClassID] = everQuestPlayerCreateInfo;
         } while (queryResult->NextRow());
     }
 }
 
-void EverQuestMod::LoadAutoLearnSkillsData()
+void EverQuestMod::LoadAutoLearnSkillsData(EverQuestWorldData& worldData)
 {
-    PlayerAutoLearnSkillsByEQClassID.clear();
+    worldData.PlayerAutoLearnSkillsByEQClassID.clear();
     QueryResult queryResult = WorldDatabase.Query("SELECT eqclass, skill FROM mod_everquest_playerautolearnskills;");
     if (queryResult)
     {
@@ -3521,16 +3930,17 @@ void EverQuestMod::LoadAutoLearnSkillsData()
             Field* fields = queryResult->Fetch();
             uint8 classID = fields[0].Get<uint8>();
             uint32 skillID = fields[1].Get<uint32>();
-            PlayerAutoLearnSkillsByEQClassID[classID].push_back(skillID);
+            worldData.PlayerAutoLearnSkillsByEQClassID[classID].push_back(skillID);
         } while (queryResult->NextRow());
     }
 }
 
 const list<uint32>& EverQuestMod::GetAutoLearnSkillsForClass(uint8 classID)
 {
-    if (PlayerAutoLearnSkillsByEQClassID.find(classID) != PlayerAutoLearnSkillsByEQClassID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.PlayerAutoLearnSkillsByEQClassID.find(classID) != worldData.PlayerAutoLearnSkillsByEQClassID.end())
     {
-        return PlayerAutoLearnSkillsByEQClassID[classID];
+        return worldData.PlayerAutoLearnSkillsByEQClassID.at(classID);
     }
     else
     {
@@ -3539,9 +3949,9 @@ const list<uint32>& EverQuestMod::GetAutoLearnSkillsForClass(uint8 classID)
     }
 }
 
-void EverQuestMod::LoadAutoLearnSpellsData()
+void EverQuestMod::LoadAutoLearnSpellsData(EverQuestWorldData& worldData)
 {
-    PlayerAutoLearnSpellsByClassID.clear();
+    worldData.PlayerAutoLearnSpellsByClassID.clear();
     QueryResult queryResult = WorldDatabase.Query("SELECT eqclass, race, spell, level FROM mod_everquest_playerautolearnspells;");
     if (queryResult)
     {
@@ -3553,16 +3963,17 @@ void EverQuestMod::LoadAutoLearnSpellsData()
             autoLearnSpell.RaceID = fields[1].Get<uint8>();
             autoLearnSpell.SpellID = fields[2].Get<uint32>();
             autoLearnSpell.Level = fields[3].Get<uint8>();
-            PlayerAutoLearnSpellsByClassID[autoLearnSpell.EQClassID].push_back(autoLearnSpell);
+            worldData.PlayerAutoLearnSpellsByClassID[autoLearnSpell.EQClassID].push_back(autoLearnSpell);
         } while (queryResult->NextRow());
     }
 }
 
 const list<EverQuestAutoLearnSpell>& EverQuestMod::GetAutoLearnSpellsForClass(uint8 classID)
 {
-    if (PlayerAutoLearnSpellsByClassID.find(classID) != PlayerAutoLearnSpellsByClassID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.PlayerAutoLearnSpellsByClassID.find(classID) != worldData.PlayerAutoLearnSpellsByClassID.end())
     {
-        return PlayerAutoLearnSpellsByClassID[classID];
+        return worldData.PlayerAutoLearnSpellsByClassID.at(classID);
     }
     else
     {
@@ -3848,23 +4259,93 @@ uint8 EverQuestMod::GetPlayerLevelForExperienceGain(Player* player)
     return level;
 }
 
+void EverQuestMod::GetZoneWideGroupMembersInMap(Group* group, Map* map, vector<Player*>& membersOut)
+{
+    membersOut.clear();
+    uint64 mapInstanceKey = GetMapInstanceKey(map);
+    vector<ObjectGuid> memberGUIDs;
+    {
+        std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+        EverQuestZoneWideGroupMemberCache& memberCache = ZoneWideGroupMemberCachesByGroupGUID[group->GetGUID()];
+        if (memberCache.IsBuilt == false)
+        {
+            memberCache.MemberGUIDsByMapInstanceKey.clear();
+            for (GroupReference* itr = group->GetFirstMember(); itr != nullptr; itr = itr->next())
+            {
+                Player* member = itr->GetSource();
+                if (member == nullptr || member->IsInWorld() == false)
+                    continue;
+                memberCache.MemberGUIDsByMapInstanceKey[GetMapInstanceKey(member->GetMap())].push_back(member->GetGUID());
+            }
+            memberCache.IsBuilt = true;
+        }
+        auto membersIter = memberCache.MemberGUIDsByMapInstanceKey.find(mapInstanceKey);
+        if (membersIter != memberCache.MemberGUIDsByMapInstanceKey.end())
+            memberGUIDs = membersIter->second;
+    }
+
+    // Resolved on this map only, so a member who has left it since the cache was built is simply not found
+    membersOut.reserve(memberGUIDs.size());
+    for (ObjectGuid memberGUID : memberGUIDs)
+    {
+        Player* member = ObjectAccessor::GetPlayer(map, memberGUID);
+        if (member != nullptr)
+            membersOut.push_back(member);
+    }
+}
+
+void EverQuestMod::InvalidateZoneWideGroupMemberCache(Group* group)
+{
+    if (group == nullptr)
+        return;
+    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+    ZoneWideGroupMemberCachesByGroupGUID.erase(group->GetGUID());
+}
+
+void EverQuestMod::InvalidateZoneWideGroupMemberCacheForPlayer(Player* player)
+{
+    if (player == nullptr)
+        return;
+    InvalidateZoneWideGroupMemberCache(player->GetGroup());
+}
+
 // Rebuilds the totals KillRewarder::_InitGroupData produces, over every group member in the zone rather than only those within the core's group reward distance
-void EverQuestMod::BuildZoneWideKillReward(Group* group, Player* killer, Unit* victim, EverQuestZoneWideKillReward& outReward)
+void EverQuestMod::BuildZoneWideKillReward(Group* group, KillRewarder const* rewarder, Player* killer, Unit* victim, EverQuestZoneWideKillReward& outReward)
 {
-    if (group == nullptr || killer == nullptr || victim == nullptr)
+    if (group == nullptr || rewarder == nullptr || killer == nullptr || victim == nullptr)
         return;
     if (IsZoneWideGroupRewardEnabledForMap(victim->GetMapId()) == false)
         return;
 
-    for (GroupReference* itr = group->GetFirstMember(); itr != nullptr; itr = itr->next())
+    // The core asks once for every member it rewards through the same rewarder, so the same kill is only built the first time.  The death
+    // serial only moves once the kill's rewards are all paid, so no later kill can match what's cached here whoever landed the blow
+    ObjectGuid victimGUID = victim->GetGUID();
+    uint64 deathSerial = UnitDeathSerial.load(std::memory_order_acquire);
+    {
+        std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+        auto memberCacheIter = ZoneWideGroupMemberCachesByGroupGUID.find(group->GetGUID());
+        if (memberCacheIter != ZoneWideGroupMemberCachesByGroupGUID.end() && memberCacheIter->second.LastKillRewarder == rewarder && memberCacheIter->second.LastKillVictimGUID == victimGUID
+            && memberCacheIter->second.LastKillDeathSerial == deathSerial)
+        {
+            outReward = memberCacheIter->second.LastKillReward;
+            return;
+        }
+    }
+
+    vector<Player*> zoneMembers;
+    GetZoneWideGroupMembersInMap(group, victim->GetMap(), zoneMembers);
+    outReward.Members.reserve(zoneMembers.size());
+    Player* maxNotGrayMember = nullptr;
+    for (Player* member : zoneMembers)
     {
-        Player* member = itr->GetSource();
-        if (member == nullptr)
-            continue;
         if (member != killer && IsInZoneWideGroupRewardRange(member, victim) == false)
             continue;
 
         uint8 memberLevel = GetPlayerLevelForExperienceGain(member);
+        EverQuestZoneWideKillRewardMember rewardMember;
+        rewardMember.MemberGUID = member->GetGUID();
+        rewardMember.Level = memberLevel;
+        outReward.Members.push_back(rewardMember);
         if (member->IsAlive() == true)
         {
             outReward.AliveMemberCount++;
@@ -3873,9 +4354,10 @@ void EverQuestMod::BuildZoneWideKillReward(Group* group, Player* killer, Unit* v
                 outReward.MaxLevel = memberLevel;
 
             uint32 grayLevel = Acore::XP::GetGrayLevel(memberLevel);
-            if (victim->GetLevel() > grayLevel && (outReward.MaxNotGrayMember == nullptr || outReward.MaxNotGrayMemberLevel < memberLevel))
+            if (victim->GetLevel() > grayLevel && (maxNotGrayMember == nullptr || outReward.MaxNotGrayMemberLevel < memberLevel))
             {
-                outReward.MaxNotGrayMember = member;
+                maxNotGrayMember = member;
+                outReward.MaxNotGrayMemberGUID = member->GetGUID();
                 outReward.MaxNotGrayMemberLevel = memberLevel;
             }
         }
@@ -3885,12 +4367,12 @@ void EverQuestMod::BuildZoneWideKillReward(Group* group, Player* killer, Unit* v
     if (outReward.MaxLevel == 0 || outReward.AliveSumLevel == 0)
         return;
 
-    outReward.IsFullXP = outReward.MaxNotGrayMember != nullptr && (outReward.MaxLevel == outReward.MaxNotGrayMemberLevel);
+    outReward.IsFullXP = maxNotGrayMember != nullptr && (outReward.MaxLevel == outReward.MaxNotGrayMemberLevel);
 
     // Base experience comes from the highest level member the victim is not gray to, matching KillRewarder::_InitXP
-    if (outReward.MaxNotGrayMember != nullptr)
+    if (maxNotGrayMember != nullptr)
     {
-        outReward.BaseExperience = Acore::XP::Gain(outReward.MaxNotGrayMember, victim, false);
+        outReward.BaseExperience = Acore::XP::Gain(maxNotGrayMember, victim, false);
         if (outReward.BaseExperience > 0 && victim->IsCreature() == true)
         {
             CreatureTemplate const* creatureTemplate = victim->ToCreature()->GetCreatureTemplate();
@@ -3913,16 +4395,31 @@ void EverQuestMod::BuildZoneWideKillReward(Group* group, Player* killer, Unit* v
 
     outReward.GroupRate = Acore::XP::xp_in_group_rate(outReward.AliveMemberCount, isRaidKill);
     outReward.IsValid = true;
+    for (EverQuestZoneWideKillRewardMember& rewardMember : outReward.Members)
+        rewardMember.ExperienceRate = GetGroupExperienceRateForMemberLevel(rewardMember.Level, outReward);
+
+    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+    EverQuestZoneWideGroupMemberCache& memberCache = ZoneWideGroupMemberCachesByGroupGUID[group->GetGUID()];
+    memberCache.LastKillRewarder = rewarder;
+    memberCache.LastKillVictimGUID = victimGUID;
+    memberCache.LastKillDeathSerial = deathSerial;
+    memberCache.LastKillReward = outReward;
+}
+
+void EverQuestMod::AdvanceZoneWideKillRewardSerial()
+{
+    // Any death moves it, as the group that was paid is the rewarder's recipient and not necessarily the one of whoever landed the blow
+    UnitDeathSerial.fetch_add(1, std::memory_order_release);
 }
 
-float EverQuestMod::GetZoneWideGroupExperienceRate(Player* player, const EverQuestZoneWideKillReward& reward)
+float EverQuestMod::GetZoneWideGroupExperienceRate(uint8 memberLevel, const EverQuestZoneWideKillReward& reward)
 {
     if (reward.IsValid == false || reward.AliveSumLevel == 0)
         return 1.0f;
-    return reward.GroupRate * static_cast<float>(GetPlayerLevelForExperienceGain(player)) / static_cast<float>(reward.AliveSumLevel);
+    return reward.GroupRate * static_cast<float>(memberLevel) / static_cast<float>(reward.AliveSumLevel);
 }
 
-float EverQuestMod::GetGroupExperienceRateForMember(Player* member, const EverQuestZoneWideKillReward& reward)
+float EverQuestMod::GetGroupExperienceRateForMemberLevel(uint8 memberLevel, const EverQuestZoneWideKillReward& reward)
 {
     // The alternate formula is an even split plus a bonus per added member, and only covers party sized groups
     if (ConfigAlternateGroupExperienceFormulaEnabled == true && reward.AliveMemberCount >= 2 && reward.AliveMemberCount <= 5)
@@ -3932,7 +4429,15 @@ float EverQuestMod::GetGroupExperienceRateForMember(Player* member, const EverQu
         return splitBaseRate * (1.0f + bonusTotalRatePercent);
     }
 
-    return GetZoneWideGroupExperienceRate(member, reward);
+    return GetZoneWideGroupExperienceRate(memberLevel, reward);
+}
+
+float EverQuestMod::GetGroupExperienceRateForMember(Player* member, const EverQuestZoneWideKillReward& reward)
+{
+    for (const EverQuestZoneWideKillRewardMember& rewardMember : reward.Members)
+        if (rewardMember.MemberGUID == member->GetGUID())
+            return rewardMember.ExperienceRate;
+    return GetGroupExperienceRateForMemberLevel(GetPlayerLevelForExperienceGain(member), reward);
 }
 
 void EverQuestMod::ApplyEQOnkillReputationsForPlayer(Player* player, Unit* victim)
@@ -3961,21 +4466,16 @@ void EverQuestMod::GrantZoneWideGroupRewardsForKill(Player* killer, Unit* victim
     if (killer == nullptr || victim == nullptr)
         return;
 
-    Group* group = killer->GetGroup();
-    if (group == nullptr)
-        return;
-
-    for (GroupReference* itr = group->GetFirstMember(); itr != nullptr; itr = itr->next())
+    for (const EverQuestZoneWideKillRewardMember& rewardMember : reward.Members)
     {
-        Player* member = itr->GetSource();
+        // Looked up on the victim's map, so a member who left it between the build and now is skipped
+        Player* member = ObjectAccessor::GetPlayer(victim->GetMap(), rewardMember.MemberGUID);
         if (member == nullptr || member == killer)
             continue;
 
         // Anything the core already paid out is left alone
         if (member->IsAtGroupRewardDistance(victim) == true)
             continue;
-        if (IsInZoneWideGroupRewardRange(member, victim) == false)
-            continue;
 
         // The core rewards reputation off the back of the kill whether or not any experience came with it, and a dead member still earns it, so this runs ahead of the experience rules and outside of them
         member->RewardReputation(victim);
@@ -3986,13 +4486,12 @@ void EverQuestMod::GrantZoneWideGroupRewardsForKill(Player* killer, Unit* victim
 
         // Mirrors KillRewarder::_RewardXP: gray members earn nothing and a partly gray group is only worth half
         uint32 experience = 0;
-        if (member->IsAlive() == true && reward.MaxNotGrayMemberLevel >= GetPlayerLevelForExperienceGain(member))
+        if (member->IsAlive() == true && reward.MaxNotGrayMemberLevel >= rewardMember.Level)
         {
-            float memberRate = GetGroupExperienceRateForMember(member, reward);
             if (reward.IsFullXP == true)
-                experience = static_cast<uint32>(reward.BaseExperience * memberRate);
+                experience = static_cast<uint32>(reward.BaseExperience * rewardMember.ExperienceRate);
             else
-                experience = static_cast<uint32>(reward.BaseExperience * memberRate / 2) + 1;
+                experience = static_cast<uint32>(reward.BaseExperience * rewardMember.ExperienceRate / 2) + 1;
         }
         if (experience == 0)
             continue;
@@ -4033,10 +4532,11 @@ void EverQuestMod::ApplyZoneWideGroupLootAccess(Loot* loot, Player* lootOwner, b
     if (lootSource == nullptr)
         return;
 
-    for (GroupReference* itr = group->GetFirstMember(); itr != nullptr; itr = itr->next())
+    vector<Player*> zoneMembers;
+    GetZoneWideGroupMembersInMap(group, map, zoneMembers);
+    for (Player* member : zoneMembers)
     {
-        Player* member = itr->GetSource();
-        if (member == nullptr || member->GetSession() == nullptr)
+        if (member->GetSession() == nullptr)
             continue;
 
         // Creature::SetLootRecipient leaves these two off the list it builds for bosses, and converted content includes instanced maps where that list is already in play, so the same exclusion is kept here
@@ -4071,14 +4571,13 @@ void EverQuestMod::ApplyZoneWideGroupMoneyShare(Player* looter, Loot* loot)
     if (lootSource == nullptr || lootSource->IsAlive() == true)
         return;
 
+    // The core's near list only ever holds members on the looter's map, so the zone members cover both counts
+    vector<Player*> zoneMembers;
+    GetZoneWideGroupMembersInMap(group, map, zoneMembers);
     uint32 nearMemberCount = 0;
     uint32 totalMemberCount = 0;
-    for (GroupReference* itr = group->GetFirstMember(); itr != nullptr; itr = itr->next())
+    for (Player* member : zoneMembers)
     {
-        Player* member = itr->GetSource();
-        if (member == nullptr)
-            continue;
-
         // The same test the core uses to build its near list
         if (looter->IsAtLootRewardDistance(member) == true)
             nearMemberCount++;
@@ -4093,11 +4592,8 @@ void EverQuestMod::ApplyZoneWideGroupMoneyShare(Player* looter, Loot* loot)
     if (goldPerPlayer == 0)
         return;
 
-    for (GroupReference* itr = group->GetFirstMember(); itr != nullptr; itr = itr->next())
+    for (Player* member : zoneMembers)
     {
-        Player* member = itr->GetSource();
-        if (member == nullptr)
-            continue;
         if (looter->IsAtLootRewardDistance(member) == true)
             continue;
         if (IsInZoneWideGroupRewardRange(member, lootSource) == false)
@@ -4184,6 +4680,12 @@ void EverQuestMod::GrantAdventurerAchievementIfAccountEarned(Player* player)
     }
 
     // Only grant if a character on this account already earned it
+    if (std::shared_ptr<const EverQuestPlayerLoginData> loginData = GetReadyLoginDataForPlayer(player->GetGUID()))
+    {
+        if (loginData->AccountEarnedAdventurerAchievement == true)
+            player->CompletedAchievement(achievementEntry);
+        return;
+    }
     uint32 accountID = player->GetSession()->GetAccountId();
     QueryResult accountEarnedQueryResult = CharacterDatabase.Query("SELECT 1 FROM mod_everquest_account_settings WHERE accountid = {} AND earnedAdventurerAchievement = 1", accountID);
     if (!accountEarnedQueryResult)
@@ -4217,9 +4719,10 @@ void EverQuestMod::ProcessAdventurerStateOnLevelChange(Player* player)
 
 bool EverQuestMod::HasCreatePlayerData(uint8 raceID, uint8 classID)
 {
-    if (PlayerCreateInfoByRaceIDThenClassID.find(raceID) == PlayerCreateInfoByRaceIDThenClassID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.PlayerCreateInfoByRaceIDThenClassID.find(raceID) == worldData.PlayerCreateInfoByRaceIDThenClassID.end())
         return false;
-    else if (PlayerCreateInfoByRaceIDThenClassID[raceID].find(classID) == PlayerCreateInfoByRaceIDThenClassID[raceID].end())
+    else if (worldData.PlayerCreateInfoByRaceIDThenClassID.at(raceID).find(classID) == worldData.PlayerCreateInfoByRaceIDThenClassID.at(raceID).end())
         return false;
     else
         return true;
@@ -4227,19 +4730,20 @@ bool EverQuestMod::HasCreatePlayerData(uint8 raceID, uint8 classID)
 
 const EverQuestPlayerCreateInfo& EverQuestMod::GetPlayerCreateInfo(uint8 raceID, uint8 classID)
 {
-    if (PlayerCreateInfoByRaceIDThenClassID.find(raceID) != PlayerCreateInfoByRaceIDThenClassID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.PlayerCreateInfoByRaceIDThenClassID.find(raceID) != worldData.PlayerCreateInfoByRaceIDThenClassID.end())
     {
-        if (PlayerCreateInfoByRaceIDThenClassID[raceID].find(classID) != PlayerCreateInfoByRaceIDThenClassID[raceID].end())
-            return PlayerCreateInfoByRaceIDThenClassID[raceID][classID];
+        if (worldData.PlayerCreateInfoByRaceIDThenClassID.at(raceID).find(classID) != worldData.PlayerCreateInfoByRaceIDThenClassID.at(raceID).end())
+            return worldData.PlayerCreateInfoByRaceIDThenClassID.at(raceID).at(classID);
     }
 
     static const EverQuestPlayerCreateInfo returnEmpty;
     return returnEmpty;
 }
 
-void EverQuestMod::LoadCreatureLootData()
+void EverQuestMod::LoadCreatureLootData(EverQuestWorldData& worldData)
 {
-    CreatureLootGroupsByCreatureTemplateID.clear();
+    worldData.CreatureLootGroupsByCreatureTemplateID.clear();
 
     // Rows are ordered so that all entries of a creature's loot group are next to each other
     QueryResult queryResult = WorldDatabase.Query("SELECT CreatureTemplateID, LootGroupID, GroupMultiplier, GroupMultiplierMin, GroupProbability, DropLimit, MinDrop, ItemTemplateID, Chance, ItemMultiplier, ItemCharges FROM mod_everquest_creature_loot ORDER BY CreatureTemplateID, LootGroupID");
@@ -4251,7 +4755,7 @@ void EverQuestMod::LoadCreatureLootData()
             uint32 creatureTemplateID = fields[0].Get<uint32>();
             uint32 lootGroupID = fields[1].Get<uint32>();
 
-            vector<EverQuestCreatureLootGroup>& lootGroups = CreatureLootGroupsByCreatureTemplateID[creatureTemplateID];
+            vector<EverQuestCreatureLootGroup>& lootGroups = worldData.CreatureLootGroupsByCreatureTemplateID[creatureTemplateID];
 
             // Find or create the group for this LootGroupID (entries for the same group are contiguous)
             EverQuestCreatureLootGroup* lootGroup = nullptr;
@@ -4282,7 +4786,8 @@ void EverQuestMod::LoadCreatureLootData()
 
 bool EverQuestMod::HasCreatureLootDataForCreatureTemplateEntryID(uint32 creatureTemplateEntryID)
 {
-    if (CreatureLootGroupsByCreatureTemplateID.find(creatureTemplateEntryID) == CreatureLootGroupsByCreatureTemplateID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.CreatureLootGroupsByCreatureTemplateID.find(creatureTemplateEntryID) == worldData.CreatureLootGroupsByCreatureTemplateID.end())
         return false;
     return true;
 }
@@ -4661,6 +5166,11 @@ void EverQuestMod::SetupCreatureCombatAbilities(Creature* creature)
     state->EnrageCooldownRemainingMS = 0;
     state->SpecialAttackTimerRemainingMS = 0;
     state->ActiveSwingDamageModPct = 100;
+    state->EnrageStartEmoteText = creature->GetName() + " has become ENRAGED.";
+    state->EnrageEndEmoteText = creature->GetName() + " is no longer enraged.";
+    state->RampageEmoteText = creature->GetName() + " goes on a RAMPAGE!";
+    state->WildRampageEmoteText = creature->GetName() + " goes on a WILD RAMPAGE!";
+    state->ScratchHatedUnitGUIDs.clear();
 }
 
 void EverQuestMod::RemoveCreatureCombatAbilityState(Creature* creature)
@@ -4697,7 +5207,7 @@ void EverQuestMod::UpdateCreatureEnrage(Creature* creature, EverQuestCreatureCom
         state->EnrageDurationRemainingMS = 0;
         state->EnrageCooldownRemainingMS = state->EnrageCooldownInMS > 0 ? state->EnrageCooldownInMS : ConfigCombatSkillsEnrageDefaultCooldownInMS;
         if (creature->IsAlive() == true)
-            creature->TextEmote(creature->GetName() + " is no longer enraged.", nullptr, true);
+            creature->TextEmote(state->EnrageEndEmoteText, nullptr, true);
         return;
     }
 
@@ -4723,7 +5233,7 @@ void EverQuestMod::UpdateCreatureEnrage(Creature* creature, EverQuestCreatureCom
         return;
     state->IsEnraged = true;
     state->EnrageDurationRemainingMS = state->EnrageDurationInMS > 0 ? state->EnrageDurationInMS : ConfigCombatSkillsEnrageDefaultDurationInMS;
-    creature->TextEmote(creature->GetName() + " has become ENRAGED.", nullptr, true);
+    creature->TextEmote(state->EnrageStartEmoteText, nullptr, true);
 }
 
 // Written by referencing TAKP's Mod:AI_Process for special attacks
@@ -4765,7 +5275,7 @@ void EverQuestMod::UpdateCreatureSpecialAttacks(Creature* creature, EverQuestCre
         uint32 chance = state->FlurryChancePct > 0 ? state->FlurryChancePct : ConfigCombatSkillsFlurryDefaultChancePct;
         if (urand(0, 99) < chance)
         {
-            DoCreatureFlurry(creature, victim);
+            DoCreatureFlurry(creature, state, victim);
             return;
         }
     }
@@ -4776,7 +5286,7 @@ void EverQuestMod::UpdateCreatureSpecialAttacks(Creature* creature, EverQuestCre
         {
             float range = state->RampageRange > 0.0f ? state->RampageRange : ConfigCombatSkillsRampageDefaultRange * ConfigWorldScale;
             uint32 damagePct = state->RampageDamagePct > 0 ? state->RampageDamagePct : 100;
-            DoCreatureRampage(creature, victim, range, damagePct);
+            DoCreatureRampage(creature, state, victim, range, damagePct);
             return;
         }
     }
@@ -4787,44 +5297,32 @@ void EverQuestMod::UpdateCreatureSpecialAttacks(Creature* creature, EverQuestCre
         {
             uint32 maxTargets = state->WildRampageMaxTargets > 0 ? state->WildRampageMaxTargets : ConfigCombatSkillsWildRampageDefaultMaxTargets;
             uint32 damagePct = state->WildRampageDamagePct > 0 ? state->WildRampageDamagePct : 100;
-            DoCreatureWildRampage(creature, victim, maxTargets, damagePct);
+            DoCreatureWildRampage(creature, state, victim, maxTargets, damagePct);
         }
     }
 }
 
-// Similar to TAKP's "DoMainHandRound" + "DoOffHandRound". Intentionally not adding an explicit off-hand swing here
-void EverQuestMod::DoCreatureCombatAbilitySwingRound(Creature* creature, Unit* target, uint32 damagePct)
+// Similar to TAKP's "DoMainHandRound" + "DoOffHandRound". Intentionally not adding an explicit off-hand swing here.  Returns the state looked up
+// fresh after the swing (or nullptr if it went away), since the swing can run scripts that remove it
+EverQuestCreatureCombatAbilityState* EverQuestMod::DoCreatureCombatAbilitySwingRound(Creature* creature, EverQuestCreatureCombatAbilityState* state, Unit* target, uint32 damagePct)
 {
     if (target == nullptr || target->IsAlive() == false)
-        return;
-
-    EverQuestCreatureCombatAbilityState* state = creature->CustomData.Get<EverQuestCreatureCombatAbilityState>(EQ_CREATURE_CUSTOMDATA_COMBATABILITY);
-    if (state != nullptr)
-        state->ActiveSwingDamageModPct = damagePct;
+        return state;
 
+    state->ActiveSwingDamageModPct = damagePct;
     creature->AttackerStateUpdate(target, BASE_ATTACK, true);
 
     // Make sure the custom data was not changed via scripting or whatever
     state = creature->CustomData.Get<EverQuestCreatureCombatAbilityState>(EQ_CREATURE_CUSTOMDATA_COMBATABILITY);
     if (state != nullptr)
         state->ActiveSwingDamageModPct = 100;
+    return state;
 }
 
-// Based on TAKP's Mob::Flurry of having one extra full attack round on the current target
-void EverQuestMod::DoCreatureFlurry(Creature* creature, Unit* victim)
-{
-    creature->TextEmote(creature->GetName() + " executes a FLURRY of attacks on " + victim->GetName() + "!", victim);
-    DoCreatureCombatAbilitySwingRound(creature, victim, 100);
-}
-
-// Based on TAKP's Mob::Rampage, but use the hate list instead of engage list
-void EverQuestMod::DoCreatureRampage(Creature* creature, Unit* victim, float range, uint32 damagePct)
+// Snapshot of the hate list in case it changes mid execution, written into a caller owned buffer so its capacity carries over between ticks
+void EverQuestMod::ResolveCreatureSpecialAttackTargets(Creature* creature, vector<ObjectGuid>& hatedUnitGUIDs)
 {
-    // TAKP still emits the message even when nobody else ends up eligible to hit, so let's do that too
-    creature->TextEmote(creature->GetName() + " goes on a RAMPAGE!", nullptr);
-
-    // Take a snapshot of the hate list in case it changes mid execution
-    vector<ObjectGuid> hatedUnitGUIDs;
+    hatedUnitGUIDs.clear();
     for (ThreatReference const* threatReference : creature->GetThreatMgr().GetSortedThreatList())
     {
         if (threatReference == nullptr || threatReference->IsAvailable() == false)
@@ -4834,7 +5332,25 @@ void EverQuestMod::DoCreatureRampage(Creature* creature, Unit* victim, float ran
             continue;
         hatedUnitGUIDs.push_back(hatedUnit->GetGUID());
     }
+}
+
+// Based on TAKP's Mob::Flurry of having one extra full attack round on the current target
+void EverQuestMod::DoCreatureFlurry(Creature* creature, EverQuestCreatureCombatAbilityState* state, Unit* victim)
+{
+    creature->TextEmote(creature->GetName() + " executes a FLURRY of attacks on " + victim->GetName() + "!", victim);
+    DoCreatureCombatAbilitySwingRound(creature, state, victim, 100);
+}
+
+// Based on TAKP's Mob::Rampage, but use the hate list instead of engage list
+void EverQuestMod::DoCreatureRampage(Creature* creature, EverQuestCreatureCombatAbilityState* state, Unit* victim, float range, uint32 damagePct)
+{
+    // TAKP still emits the message even when nobody else ends up eligible to hit, so let's do that too
+    creature->TextEmote(state->RampageEmoteText, nullptr);
 
+    // The snapshot buffer is borrowed out of the state while swinging, since a swing can erase the state
+    vector<ObjectGuid> hatedUnitGUIDs;
+    hatedUnitGUIDs.swap(state->ScratchHatedUnitGUIDs);
+    ResolveCreatureSpecialAttackTargets(creature, hatedUnitGUIDs);
     for (ObjectGuid hatedUnitGUID : hatedUnitGUIDs)
     {
         if (victim != nullptr && hatedUnitGUID == victim->GetGUID())
@@ -4846,28 +5362,22 @@ void EverQuestMod::DoCreatureRampage(Creature* creature, Unit* victim, float ran
             continue;
 
         // Regular rampage hits exactly one extra target
-        DoCreatureCombatAbilitySwingRound(creature, rampageTarget, damagePct);
-        return;
+        state = DoCreatureCombatAbilitySwingRound(creature, state, rampageTarget, damagePct);
+        break;
     }
+    if (state != nullptr)
+        state->ScratchHatedUnitGUIDs.swap(hatedUnitGUIDs);
 }
 
 // Based on TAKP's Mob::WildRampage + HateList::WildRampage.
-void EverQuestMod::DoCreatureWildRampage(Creature* creature, Unit* victim, uint32 maxTargets, uint32 damagePct)
+void EverQuestMod::DoCreatureWildRampage(Creature* creature, EverQuestCreatureCombatAbilityState* state, Unit* victim, uint32 maxTargets, uint32 damagePct)
 {
-    creature->TextEmote(creature->GetName() + " goes on a WILD RAMPAGE!", nullptr);
+    creature->TextEmote(state->WildRampageEmoteText, nullptr);
 
-    // Take a snapshot of the hate list in case it changes mid execution
+    // The snapshot buffer is borrowed out of the state while swinging, since a swing can erase the state
     vector<ObjectGuid> hatedUnitGUIDs;
-    for (ThreatReference const* threatReference : creature->GetThreatMgr().GetSortedThreatList())
-    {
-        if (threatReference == nullptr || threatReference->IsAvailable() == false)
-            continue;
-        Unit* hatedUnit = threatReference->GetVictim();
-        if (hatedUnit == nullptr)
-            continue;
-        hatedUnitGUIDs.push_back(hatedUnit->GetGUID());
-    }
-
+    hatedUnitGUIDs.swap(state->ScratchHatedUnitGUIDs);
+    ResolveCreatureSpecialAttackTargets(creature, hatedUnitGUIDs);
     bool includeCurrentVictim = (hatedUnitGUIDs.size() == 1);
     uint32 targetsHit = 0;
     for (ObjectGuid hatedUnitGUID : hatedUnitGUIDs)
@@ -4883,9 +5393,13 @@ void EverQuestMod::DoCreatureWildRampage(Creature* creature, Unit* victim, uint3
             continue;
         if (creature->IsWithinMeleeRange(rampageTarget) == false)
             continue;
-        DoCreatureCombatAbilitySwingRound(creature, rampageTarget, damagePct);
+        state = DoCreatureCombatAbilitySwingRound(creature, state, rampageTarget, damagePct);
         targetsHit++;
+        if (state == nullptr)
+            break;
     }
+    if (state != nullptr)
+        state->ScratchHatedUnitGUIDs.swap(hatedUnitGUIDs);
 }
 
 bool EverQuestMod::IsCreatureEnragedForRiposte(Unit const* unit, Unit const* attacker)
@@ -5217,6 +5731,50 @@ bool EverQuestMod::IsSocialAggroOverrideNeededForCreature(Creature* creature, fl
     return hasCustomScale == true || maxAgroZDistanceOut >= 0.0f;
 }
 
+// Pulls of a whole pack land in the same tick, so a lone pull scans only its own radius and the second caller in a cell scans wide enough for the rest
+vector<ObjectGuid> const& EverQuestMod::GatherSocialAggroCandidatesForCreature(Creature* caller, float radius)
+{
+    float cellSize = std::max(sWorld->getFloatConfig(CONFIG_CREATURE_FAMILY_ASSISTANCE_RADIUS), radius);
+    int32 cellX = int32(std::floor(caller->GetPositionX() / cellSize));
+    int32 cellY = int32(std::floor(caller->GetPositionY() / cellSize));
+    uint64 cellKey = (uint64(uint32(cellX)) << 32) | uint64(uint32(cellY));
+    uint64 nowMS = uint64(GameTime::GetGameTimeMS().count());
+    EverQuestSocialAggroMapScanCache* scanCache = caller->GetMap()->CustomData.GetDefault<EverQuestSocialAggroMapScanCache>(EQ_MAP_CUSTOMDATA_SOCIALAGGROSCAN);
+    if (scanCache->ScanGameTimeMS != nowMS)
+    {
+        scanCache->ScanGameTimeMS = nowMS;
+        scanCache->ScansByCellKey.clear();
+    }
+    auto scanIter = scanCache->ScansByCellKey.find(cellKey);
+    bool isPackScan = false;
+    if (scanIter != scanCache->ScansByCellKey.end())
+    {
+        // Only reusable if this caller's whole radius is inside what was scanned
+        EverQuestSocialAggroCellScan const& cachedScan = scanIter->second;
+        if (caller->GetExactDist(cachedScan.CenterX, cachedScan.CenterY, cachedScan.CenterZ) + radius + caller->GetObjectSize() <= cachedScan.ScanRadius)
+            return cachedScan.CreatureGUIDs;
+        isPackScan = true;
+    }
+
+    // The first caller scans just what the core would, and a second one covers the rest of the cell from here for the pack behind it
+    EverQuestSocialAggroCellScan& scan = scanCache->ScansByCellKey[cellKey];
+    scan.CenterX = caller->GetPositionX();
+    scan.CenterY = caller->GetPositionY();
+    scan.CenterZ = caller->GetPositionZ();
+    scan.ScanRadius = radius + caller->GetObjectSize();
+    if (isPackScan == true)
+        scan.ScanRadius += cellSize * 1.5f;
+    std::list<Creature*> nearbyCreatures;
+    Acore::AnyUnitInObjectRangeCheck check(caller, scan.ScanRadius);
+    Acore::CreatureListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(caller, nearbyCreatures, check);
+    Cell::VisitObjects(caller, searcher, scan.ScanRadius);
+    scan.CreatureGUIDs.clear();
+    scan.CreatureGUIDs.reserve(nearbyCreatures.size());
+    for (Creature* nearbyCreature : nearbyCreatures)
+        scan.CreatureGUIDs.push_back(nearbyCreature->GetGUID());
+    return scan.CreatureGUIDs;
+}
+
 // Kinda-sorta a mirror of Creature:CallAssistance, but need to override to make custom social behavior
 void EverQuestMod::DoScaledSocialAggroSearch(Creature* caller, Unit* victim, float scale, float maxAgroZDistance)
 {
@@ -5227,15 +5785,16 @@ void EverQuestMod::DoScaledSocialAggroSearch(Creature* caller, Unit* victim, flo
     if (radius <= 0.0f)
         return;
 
-    std::list<Creature*> assistList;
+    // Nothing below can touch the scan cache until the assistants are engaged, so the cached list is filtered in place
+    vector<ObjectGuid> const& candidateGUIDs = GatherSocialAggroCandidatesForCreature(caller, radius);
     Acore::AnyAssistCreatureInRangeCheck check(caller, victim, radius);
-    Acore::CreatureListSearcher<Acore::AnyAssistCreatureInRangeCheck> searcher(caller, assistList, check);
-    Cell::VisitObjects(caller, searcher, radius);
+    Map* map = caller->GetMap();
     std::vector<ObjectGuid> assistantGUIDs;
-    assistantGUIDs.reserve(assistList.size());
-    for (Creature* assistant : assistList)
+    assistantGUIDs.reserve(candidateGUIDs.size());
+    for (ObjectGuid candidateGUID : candidateGUIDs)
     {
-        if (assistant == nullptr)
+        Creature* assistant = map->GetCreature(candidateGUID);
+        if (assistant == nullptr || check(assistant) == false)
             continue;
         if (IsBlockedByAgroZDistance(assistant, caller, maxAgroZDistance) == true)
             continue;
@@ -5439,6 +5998,52 @@ void EverQuestMod::ProcessCreatureRetaliationOnDamage(Unit* attacker, Unit* vict
     creature->AI()->AttackStart(attacker);
 }
 
+// Charm and possess are left out since the core already breaks those through RemoveAllControlled on the death state change
+static const AuraType EQCreatureCrowdControlAuraTypes[] =
+{
+    SPELL_AURA_MOD_ROOT,
+    SPELL_AURA_MOD_STUN,
+    SPELL_AURA_MOD_FEAR,
+    SPELL_AURA_MOD_CONFUSE,
+    SPELL_AURA_MOD_PACIFY,
+    SPELL_AURA_MOD_SILENCE,
+    SPELL_AURA_MOD_PACIFY_SILENCE,
+    SPELL_AURA_MOD_DECREASE_SPEED
+};
+
+static bool IsCreatureCrowdControlAuraType(AuraType auraType)
+{
+    for (AuraType crowdControlAuraType : EQCreatureCrowdControlAuraTypes)
+        if (crowdControlAuraType == auraType)
+            return true;
+    return false;
+}
+
+void EverQuestMod::TrackCreatureCrowdControlOnPlayerAuraApply(Player* player, Aura* aura)
+{
+    if (player == nullptr || aura == nullptr)
+        return;
+    Unit* caster = aura->GetCaster();
+    if (caster == nullptr || caster->IsCreature() == false)
+        return;
+
+    // Pets and charmed creatures cast under player control, so their crowd control follows the player rules instead
+    Creature* casterCreature = caster->ToCreature();
+    if (casterCreature->IsPet() == true || casterCreature->IsControlledByPlayer() == true)
+        return;
+    uint32 mapID = casterCreature->GetMapId();
+    if (mapID < ConfigSystemMapDBCIDMin || mapID > ConfigSystemMapDBCIDMax)
+        return;
+
+    SpellInfo const* spellInfo = aura->GetSpellInfo();
+    bool hasCrowdControl = false;
+    for (uint8 effectIndex = 0; effectIndex < MAX_SPELL_EFFECTS && hasCrowdControl == false; ++effectIndex)
+        hasCrowdControl = spellInfo->Effects[effectIndex].IsAura() == true && IsCreatureCrowdControlAuraType(spellInfo->Effects[effectIndex].ApplyAuraName) == true;
+    if (hasCrowdControl == false)
+        return;
+    casterCreature->CustomData.GetDefault<EverQuestCreatureCrowdControlTargetsState>(EQ_CREATURE_CUSTOMDATA_CROWDCONTROLTARGETS)->PlayerGUIDs.insert(player->GetGUID());
+}
+
 void EverQuestMod::RemoveCreatureCrowdControlAurasFromPlayersOnDeath(Creature* deadCreature)
 {
     if (deadCreature == nullptr)
@@ -5448,35 +6053,33 @@ void EverQuestMod::RemoveCreatureCrowdControlAurasFromPlayersOnDeath(Creature* d
     if (deadCreature->IsPet() == true || deadCreature->IsControlledByPlayer() == true)
         return;
 
-    // Charm and possess are left out since the core already breaks those through RemoveAllControlled on the death state change
-    static const AuraType crowdControlAuraTypes[] =
-    {
-        SPELL_AURA_MOD_ROOT,
-        SPELL_AURA_MOD_STUN,
-        SPELL_AURA_MOD_FEAR,
-        SPELL_AURA_MOD_CONFUSE,
-        SPELL_AURA_MOD_PACIFY,
-        SPELL_AURA_MOD_SILENCE,
-        SPELL_AURA_MOD_PACIFY_SILENCE,
-        SPELL_AURA_MOD_DECREASE_SPEED
-    };
+    // Only the players this creature crowd controlled are visited.  Ones whose auras already faded just find nothing to remove
+    EverQuestCreatureCrowdControlTargetsState* state = deadCreature->CustomData.Get<EverQuestCreatureCrowdControlTargetsState>(EQ_CREATURE_CUSTOMDATA_CROWDCONTROLTARGETS);
+    if (state == nullptr)
+        return;
+    vector<ObjectGuid> playerGUIDs(state->PlayerGUIDs.begin(), state->PlayerGUIDs.end());
+    RemoveCreatureCrowdControlTargetsState(deadCreature);
 
     ObjectGuid deadCreatureGUID = deadCreature->GetGUID();
-    Map::PlayerList const& mapPlayers = deadCreature->GetMap()->GetPlayers();
-    for (Map::PlayerList::const_iterator playerIter = mapPlayers.begin(); playerIter != mapPlayers.end(); ++playerIter)
+    for (ObjectGuid playerGUID : playerGUIDs)
     {
-        Player* mapPlayer = playerIter->GetSource();
-        if (mapPlayer == nullptr || mapPlayer->IsInWorld() == false)
+        Player* player = ObjectAccessor::GetPlayer(*deadCreature, playerGUID);
+        if (player == nullptr || player->IsInWorld() == false)
             continue;
-        for (AuraType curAuraType : crowdControlAuraTypes)
+        for (AuraType curAuraType : EQCreatureCrowdControlAuraTypes)
         {
-            if (mapPlayer->HasAuraTypeWithCaster(curAuraType, deadCreatureGUID) == false)
+            if (player->HasAuraTypeWithCaster(curAuraType, deadCreatureGUID) == false)
                 continue;
-            mapPlayer->RemoveAurasByType(curAuraType, deadCreatureGUID);
+            player->RemoveAurasByType(curAuraType, deadCreatureGUID);
         }
     }
 }
 
+void EverQuestMod::RemoveCreatureCrowdControlTargetsState(Creature* creature)
+{
+    creature->CustomData.Erase(EQ_CREATURE_CUSTOMDATA_CROWDCONTROLTARGETS);
+}
+
 void EverQuestMod::UpdateCreatureScaledSocialAggro(Creature* creature, uint32 diff)
 {
     if (creature == nullptr)
@@ -5628,9 +6231,10 @@ void EverQuestMod::RemoveVisualEquippedItemForCreatureGUIDIfExists(Map* map, Obj
     }
 }
 
-void EverQuestMod::LoadShipTriggerData()
+void EverQuestMod::LoadShipTriggerData(EverQuestWorldData& worldData)
 {
-    ShipTriggersByTriggeringGameObjectTemplateEntryID.clear();
+    worldData.ShipTriggersByTriggeringGameObjectTemplateEntryID.clear();
+    worldData.ShipWaitNodesByGameObjectTemplateEntryID.clear();
 
     // Pulls in all the kill faction rewards
     QueryResult queryResult = WorldDatabase.Query("SELECT TriggeringShipEntryID, TriggeredShipEntryID, TriggeringNodeID, TriggeredActivateNodeID FROM mod_everquest_transport_trigger;");
@@ -5645,17 +6249,23 @@ void EverQuestMod::LoadShipTriggerData()
             shipTrigger.TriggeredShipGameObjectTemplateEntryID = fields[1].Get<uint32>();
             shipTrigger.TriggeringNodeID = fields[2].Get<uint32>();
             shipTrigger.TriggerActivateNodeID = fields[3].Get<int32>();
-            ShipTriggersByTriggeringGameObjectTemplateEntryID[shipTrigger.TriggeringShipGameObjectEntryTemplateID].push_back(shipTrigger);
-            ShipWaitNodesByGameObjectTemplateEntryID[shipTrigger.TriggeredShipGameObjectTemplateEntryID] = shipTrigger.TriggerActivateNodeID;
+            worldData.ShipTriggersByTriggeringGameObjectTemplateEntryID[shipTrigger.TriggeringShipGameObjectEntryTemplateID].push_back(shipTrigger);
+            worldData.ShipWaitNodesByGameObjectTemplateEntryID[shipTrigger.TriggeredShipGameObjectTemplateEntryID] = shipTrigger.TriggerActivateNodeID;
         } while (queryResult->NextRow());
     }
+
+    // Sorted along the route so relocates can walk them with a cursor.  Stable, so triggers on the same node still fire in table order
+    for (auto& shipTriggersByShipEntryID : worldData.ShipTriggersByTriggeringGameObjectTemplateEntryID)
+        std::stable_sort(shipTriggersByShipEntryID.second.begin(), shipTriggersByShipEntryID.second.end(),
+            [](const EverQuestTransportShipTrigger& a, const EverQuestTransportShipTrigger& b) { return a.TriggeringNodeID < b.TriggeringNodeID; });
 }
 
 const vector<EverQuestTransportShipTrigger>& EverQuestMod::GetShipTriggersForShip(int triggeringGameObjectTemplateEntryID)
 {
-    if (ShipTriggersByTriggeringGameObjectTemplateEntryID.find(triggeringGameObjectTemplateEntryID) != ShipTriggersByTriggeringGameObjectTemplateEntryID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.ShipTriggersByTriggeringGameObjectTemplateEntryID.find(triggeringGameObjectTemplateEntryID) != worldData.ShipTriggersByTriggeringGameObjectTemplateEntryID.end())
     {
-        return ShipTriggersByTriggeringGameObjectTemplateEntryID[triggeringGameObjectTemplateEntryID];
+        return worldData.ShipTriggersByTriggeringGameObjectTemplateEntryID.at(triggeringGameObjectTemplateEntryID);
     }
     else
     {
@@ -5664,9 +6274,87 @@ const vector<EverQuestTransportShipTrigger>& EverQuestMod::GetShipTriggersForShi
     }
 }
 
-void EverQuestMod::LoadCreatureInstanceData()
+size_t EverQuestMod::GetShipTriggersReachedAtNode(WorldObject* ship, uint32 nodeID, const EverQuestTransportShipTrigger*& reachedTriggersOut)
+{
+    reachedTriggersOut = nullptr;
+    const EverQuestWorldData& worldData = GetWorldData();
+    auto shipTriggersIter = worldData.ShipTriggersByTriggeringGameObjectTemplateEntryID.find(ship->GetEntry());
+    if (shipTriggersIter == worldData.ShipTriggersByTriggeringGameObjectTemplateEntryID.end())
+        return 0;
+    EverQuestShipTriggerCursor* cursor = ship->CustomData.GetDefault<EverQuestShipTriggerCursor>(EQ_TRANSPORT_CUSTOMDATA_SHIPTRIGGERCURSOR);
+    return AdvanceShipTriggerCursor(*cursor, shipTriggersIter->second, GetWorldDataGeneration(), nodeID, reachedTriggersOut);
+}
+
+// Returns how many triggers sit on this node, starting at reachedTriggersOut.  Only the triggers between the last node and this one are stepped over
+size_t EverQuestMod::AdvanceShipTriggerCursor(EverQuestShipTriggerCursor& cursor, const vector<EverQuestTransportShipTrigger>& shipTriggers, uint32 worldDataGeneration, uint32 nodeID,
+    const EverQuestTransportShipTrigger*& reachedTriggersOut)
+{
+    reachedTriggersOut = nullptr;
+
+    // Going back down the node list means the route looped or the ship respawned, and a reload means the indexes point into old tables
+    if (cursor.HasLastNode == false || nodeID < cursor.LastNodeID || cursor.WorldDataGeneration != worldDataGeneration)
+    {
+        auto lowerIter = std::lower_bound(shipTriggers.begin(), shipTriggers.end(), nodeID,
+            [](const EverQuestTransportShipTrigger& shipTrigger, uint32 searchNodeID) { return shipTrigger.TriggeringNodeID < searchNodeID; });
+        cursor.NextTriggerIndex = size_t(std::distance(shipTriggers.begin(), lowerIter));
+        cursor.WorldDataGeneration = worldDataGeneration;
+    }
+    cursor.LastNodeID = nodeID;
+    cursor.HasLastNode = true;
+
+    // Triggers on nodes the ship skipped past are passed over, same as the full scan, since only the exact node ever fired them
+    while (cursor.NextTriggerIndex < shipTriggers.size() && shipTriggers[cursor.NextTriggerIndex].TriggeringNodeID < nodeID)
+        cursor.NextTriggerIndex++;
+    size_t reachedCount = 0;
+    while (cursor.NextTriggerIndex + reachedCount < shipTriggers.size() && shipTriggers[cursor.NextTriggerIndex + reachedCount].TriggeringNodeID == nodeID)
+        reachedCount++;
+    if (reachedCount != 0)
+        reachedTriggersOut = &shipTriggers[cursor.NextTriggerIndex];
+    return reachedCount;
+}
+
+// Replays two laps of every ship's route through a fresh cursor, relocating twice at each node as a ship sitting on a node does, and checks
+// each relocate fires exactly the triggers the full scan would have, in table order
+bool EverQuestMod::ReplayShipTriggerRoutes(vector<string>& mismatchesOut, uint32& replayedRelocateCountOut)
+{
+    replayedRelocateCountOut = 0;
+    const EverQuestWorldData& worldData = GetWorldData();
+    for (const auto& shipTriggersByShipEntryID : worldData.ShipTriggersByTriggeringGameObjectTemplateEntryID)
+    {
+        const vector<EverQuestTransportShipTrigger>& shipTriggers = shipTriggersByShipEntryID.second;
+        if (shipTriggers.empty() == true)
+            continue;
+        uint32 lastNodeID = shipTriggers.back().TriggeringNodeID + 1;
+        EverQuestShipTriggerCursor cursor;
+        for (uint32 lap = 0; lap < 2; ++lap)
+        {
+            for (uint32 nodeID = 0; nodeID <= lastNodeID; ++nodeID)
+            {
+                for (uint32 relocate = 0; relocate < 2; ++relocate)
+                {
+                    replayedRelocateCountOut++;
+                    vector<uint32> expectedTriggeredShipEntryIDs;
+                    for (const EverQuestTransportShipTrigger& shipTrigger : GetShipTriggersForShip(shipTriggersByShipEntryID.first))
+                        if (shipTrigger.TriggeringNodeID == nodeID)
+                            expectedTriggeredShipEntryIDs.push_back(shipTrigger.TriggeredShipGameObjectTemplateEntryID);
+                    const EverQuestTransportShipTrigger* reachedTriggers = nullptr;
+                    size_t reachedCount = AdvanceShipTriggerCursor(cursor, shipTriggers, 0, nodeID, reachedTriggers);
+                    vector<uint32> reachedTriggeredShipEntryIDs;
+                    for (size_t i = 0; i < reachedCount; ++i)
+                        reachedTriggeredShipEntryIDs.push_back(reachedTriggers[i].TriggeredShipGameObjectTemplateEntryID);
+                    if (reachedTriggeredShipEntryIDs != expectedTriggeredShipEntryIDs)
+                        mismatchesOut.push_back(fmt::format("Ship {} lap {} node {} relocate {}: fired {} triggers where the full scan fires {}", shipTriggersByShipEntryID.first,
+                            lap + 1, nodeID, relocate + 1, reachedCount, expectedTriggeredShipEntryIDs.size()));
+                }
+            }
+        }
+    }
+    return mismatchesOut.empty();
+}
+
+void EverQuestMod::LoadCreatureInstanceData(EverQuestWorldData& worldData)
 {
-    CreatureInstancesByCreatureGUID.clear();
+    worldData.CreatureInstancesByCreatureGUID.clear();
 
     QueryResult queryResult = WorldDatabase.Query("SELECT CreatureGUID, WanderType, PauseType, MapID, WaypointID, DoesRoam, RoamMinX, RoamMaxX, RoamMinY, RoamMaxY, RoamMinZ, RoamMaxZ, RoamMinDelayInMS, RoamMaxDelayInMS, DespawnAtWaypointNum, DisableGroundContour FROM mod_everquest_creature_instance;");
     if (queryResult)
@@ -5691,16 +6379,17 @@ void EverQuestMod::LoadCreatureInstanceData()
             creatureInstance.RoamMaxDelayInMS = fields[13].Get<uint32>();
             creatureInstance.DespawnAtWaypointNum = fields[14].Get<int32>();
             creatureInstance.DisableGroundContour = fields[15].Get<uint8>() == 1 ? true : false;
-            CreatureInstancesByCreatureGUID[creatureInstance.CreatureGUID] = creatureInstance;
+            worldData.CreatureInstancesByCreatureGUID[creatureInstance.CreatureGUID] = creatureInstance;
         } while (queryResult->NextRow());
     }
 }
 
 const EverQuestCreatureInstance& EverQuestMod::GetCreatureInstanceData(uint32 creatureInstanceGUID)
 {
-    if (CreatureInstancesByCreatureGUID.find(creatureInstanceGUID) != CreatureInstancesByCreatureGUID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.CreatureInstancesByCreatureGUID.find(creatureInstanceGUID) != worldData.CreatureInstancesByCreatureGUID.end())
     {
-        return CreatureInstancesByCreatureGUID[creatureInstanceGUID];
+        return worldData.CreatureInstancesByCreatureGUID.at(creatureInstanceGUID);
     }
     else
     {
@@ -5709,9 +6398,62 @@ const EverQuestCreatureInstance& EverQuestMod::GetCreatureInstanceData(uint32 cr
     }
 }
 
-void EverQuestMod::LoadCreatureWaypointData()
+static void BuildWaypointSetSpatialIndex(EverQuestCreatureWaypointSet& waypointSet)
+{
+    waypointSet.IndexCellStarts.clear();
+    waypointSet.IndexWaypointIndexes.clear();
+    if (waypointSet.Waypoints.empty() == true)
+        return;
+
+    float maxX = waypointSet.Waypoints[0].X;
+    float maxY = waypointSet.Waypoints[0].Y;
+    waypointSet.IndexMinX = waypointSet.Waypoints[0].X;
+    waypointSet.IndexMinY = waypointSet.Waypoints[0].Y;
+    for (const EverQuestCreatureWaypoint& waypoint : waypointSet.Waypoints)
+    {
+        waypointSet.IndexMinX = std::min(waypointSet.IndexMinX, waypoint.X);
+        waypointSet.IndexMinY = std::min(waypointSet.IndexMinY, waypoint.Y);
+        maxX = std::max(maxX, waypoint.X);
+        maxY = std::max(maxY, waypoint.Y);
+    }
+
+    // Sized so an average cell holds a couple of waypoints, but never so small that the grid itself outweighs the list
+    float spanX = maxX - waypointSet.IndexMinX;
+    float spanY = maxY - waypointSet.IndexMinY;
+    float cellSize = std::sqrt((spanX * spanY * EQ_WAYPOINT_SET_INDEX_WAYPOINTS_PER_CELL) / float(waypointSet.Waypoints.size()));
+    cellSize = std::max(cellSize, EQ_WAYPOINT_SET_INDEX_MIN_CELL_SIZE);
+    cellSize = std::max(cellSize, std::max(spanX, spanY) / float(EQ_WAYPOINT_SET_INDEX_MAX_CELLS_PER_SIDE));
+    waypointSet.IndexCellSize = cellSize;
+    waypointSet.IndexCellCountX = std::min<uint32>(uint32(spanX / cellSize) + 1, EQ_WAYPOINT_SET_INDEX_MAX_CELLS_PER_SIDE);
+    waypointSet.IndexCellCountY = std::min<uint32>(uint32(spanY / cellSize) + 1, EQ_WAYPOINT_SET_INDEX_MAX_CELLS_PER_SIDE);
+
+    // Counting sort of the waypoint indexes into their cells
+    uint32 cellCount = waypointSet.IndexCellCountX * waypointSet.IndexCellCountY;
+    vector<uint32> cellIndexByWaypointIndex(waypointSet.Waypoints.size());
+    waypointSet.IndexCellStarts.assign(cellCount + 1, 0);
+    for (uint32 waypointIndex = 0; waypointIndex < waypointSet.Waypoints.size(); ++waypointIndex)
+    {
+        const EverQuestCreatureWaypoint& waypoint = waypointSet.Waypoints[waypointIndex];
+        uint32 cellX = std::min<uint32>(uint32((waypoint.X - waypointSet.IndexMinX) / cellSize), waypointSet.IndexCellCountX - 1);
+        uint32 cellY = std::min<uint32>(uint32((waypoint.Y - waypointSet.IndexMinY) / cellSize), waypointSet.IndexCellCountY - 1);
+        cellIndexByWaypointIndex[waypointIndex] = cellY * waypointSet.IndexCellCountX + cellX;
+        waypointSet.IndexCellStarts[cellIndexByWaypointIndex[waypointIndex] + 1]++;
+    }
+    for (uint32 cellIndex = 0; cellIndex < cellCount; ++cellIndex)
+        waypointSet.IndexCellStarts[cellIndex + 1] += waypointSet.IndexCellStarts[cellIndex];
+    vector<uint32> cellFillCounts(cellCount, 0);
+    waypointSet.IndexWaypointIndexes.resize(waypointSet.Waypoints.size());
+    for (uint32 waypointIndex = 0; waypointIndex < waypointSet.Waypoints.size(); ++waypointIndex)
+    {
+        uint32 cellIndex = cellIndexByWaypointIndex[waypointIndex];
+        waypointSet.IndexWaypointIndexes[waypointSet.IndexCellStarts[cellIndex] + cellFillCounts[cellIndex]] = waypointIndex;
+        cellFillCounts[cellIndex]++;
+    }
+}
+
+void EverQuestMod::LoadCreatureWaypointData(EverQuestWorldData& worldData)
 {
-    CreatureWaypointsByMapIDAndWaypointID.clear();
+    worldData.CreatureWaypointSetsByMapIDAndWaypointID.clear();
 
     QueryResult queryResult = WorldDatabase.Query("SELECT MapID, WaypointID, Number, X, Y, Z, PauseInSec FROM mod_everquest_creature_waypoint;");
     if (queryResult)
@@ -5727,191 +6469,1367 @@ void EverQuestMod::LoadCreatureWaypointData()
             creatureWaypoint.Y = fields[4].Get<float>();
             creatureWaypoint.Z = fields[5].Get<float>();
             creatureWaypoint.PauseInSec = fields[6].Get<uint32>();
-            CreatureWaypointsByMapIDAndWaypointID[creatureWaypoint.MapID][creatureWaypoint.WaypointID].push_back(creatureWaypoint);
+            worldData.CreatureWaypointSetsByMapIDAndWaypointID[creatureWaypoint.MapID][creatureWaypoint.WaypointID].Waypoints.push_back(creatureWaypoint);
         } while (queryResult->NextRow());
     }
+
+    for (auto& waypointSetsByMapID : worldData.CreatureWaypointSetsByMapIDAndWaypointID)
+    {
+        for (auto& waypointSetByListID : waypointSetsByMapID.second)
+        {
+            waypointSetByListID.second.Waypoints.shrink_to_fit();
+            BuildWaypointSetSpatialIndex(waypointSetByListID.second);
+        }
+    }
 }
 
 const vector<EverQuestCreatureWaypoint>& EverQuestMod::GetWaypoints(uint32 mapID, uint32 waypointListID)
 {
-    static const vector<EverQuestCreatureWaypoint> returnEmpty;
-    auto outerIt = CreatureWaypointsByMapIDAndWaypointID.find(mapID);
-    if (outerIt == CreatureWaypointsByMapIDAndWaypointID.end())
-        return returnEmpty;
-    const unordered_map<uint32, vector<EverQuestCreatureWaypoint>>& innerMap = outerIt->second;
+    return GetWaypointSet(mapID, waypointListID)->Waypoints;
+}
+
+const EverQuestCreatureWaypointSet* EverQuestMod::GetWaypointSet(uint32 mapID, uint32 waypointListID)
+{
+    return GetWaypointSet(GetWorldData(), mapID, waypointListID);
+}
+
+const EverQuestCreatureWaypointSet* EverQuestMod::GetWaypointSet(const EverQuestWorldData& worldData, uint32 mapID, uint32 waypointListID)
+{
+    // Never null, so callers can hold on to it without checking
+    static const EverQuestCreatureWaypointSet returnEmpty;
+    auto outerIt = worldData.CreatureWaypointSetsByMapIDAndWaypointID.find(mapID);
+    if (outerIt == worldData.CreatureWaypointSetsByMapIDAndWaypointID.end())
+        return &returnEmpty;
+    const unordered_map<uint32, EverQuestCreatureWaypointSet>& innerMap = outerIt->second;
     auto innerIt = innerMap.find(waypointListID);
     if (innerIt == innerMap.end())
-        return returnEmpty;
+        return &returnEmpty;
 
-    return innerIt->second;
+    return &innerIt->second;
 }
 
-void EverQuestMod::LoadForageData()
+uint32 EverQuestMod::FindNearestWaypointIndex(const EverQuestCreatureWaypointSet& waypointSet, float x, float y, float z)
 {
-    ForageZoneItemsByMapID.clear();
-    ForageZoneItemTotalChanceByMapID.clear();
+    if (waypointSet.Waypoints.empty() == true || waypointSet.IndexCellStarts.empty() == true)
+        return 0;
 
-    QueryResult queryResult = WorldDatabase.Query("SELECT MapID, ItemTemplateID, Chance, ForageType FROM mod_everquest_forage_zone_items;");
-    if (queryResult)
+    // Search rings of cells outward from the one holding the point (or nearest to it), stopping once no further ring could hold anything closer
+    float cellSize = waypointSet.IndexCellSize;
+    int32 centerCellX = int32(std::floor((x - waypointSet.IndexMinX) / cellSize));
+    int32 centerCellY = int32(std::floor((y - waypointSet.IndexMinY) / cellSize));
+    centerCellX = std::max<int32>(0, std::min<int32>(centerCellX, int32(waypointSet.IndexCellCountX) - 1));
+    centerCellY = std::max<int32>(0, std::min<int32>(centerCellY, int32(waypointSet.IndexCellCountY) - 1));
+    int32 maxRing = int32(std::max(waypointSet.IndexCellCountX, waypointSet.IndexCellCountY));
+
+    uint32 nearestIndex = 0;
+    float nearestDistSquared = -1.0f;
+    for (int32 ring = 0; ring <= maxRing; ++ring)
     {
-        do
+        if (nearestDistSquared >= 0.0f)
         {
-            Field* fields = queryResult->Fetch();
-            EverQuestForageZoneItem forageZoneItem;
-            forageZoneItem.MapID = fields[0].Get<uint32>();
-            forageZoneItem.ItemTemplateID = fields[1].Get<uint32>();
-            forageZoneItem.Chance = fields[2].Get<uint32>();
-            forageZoneItem.ForageType = fields[3].Get<uint32>();
-            ForageZoneItemsByMapID[forageZoneItem.MapID].push_back(forageZoneItem);
-            ForageZoneItemTotalChanceByMapID[forageZoneItem.MapID] += forageZoneItem.Chance;
-        } while (queryResult->NextRow());
+            float ringMinDist = float(ring - 1) * cellSize;
+            if (ringMinDist > 0.0f && ringMinDist * ringMinDist > nearestDistSquared)
+                break;
+        }
+
+        for (int32 cellY = centerCellY - ring; cellY <= centerCellY + ring; ++cellY)
+        {
+            if (cellY < 0 || cellY >= int32(waypointSet.IndexCellCountY))
+                continue;
+            for (int32 cellX = centerCellX - ring; cellX <= centerCellX + ring; ++cellX)
+            {
+                if (cellX < 0 || cellX >= int32(waypointSet.IndexCellCountX))
+                    continue;
+                // Only the outer edge of the ring, since the inside was searched already
+                if (std::abs(cellX - centerCellX) != ring && std::abs(cellY - centerCellY) != ring)
+                    continue;
+
+                uint32 cellIndex = uint32(cellY) * waypointSet.IndexCellCountX + uint32(cellX);
+                for (uint32 i = waypointSet.IndexCellStarts[cellIndex]; i < waypointSet.IndexCellStarts[cellIndex + 1]; ++i)
+                {
+                    uint32 waypointIndex = waypointSet.IndexWaypointIndexes[i];
+                    const EverQuestCreatureWaypoint& waypoint = waypointSet.Waypoints[waypointIndex];
+                    float dx = waypoint.X - x;
+                    float dy = waypoint.Y - y;
+                    float dz = waypoint.Z - z;
+                    float distSquared = dx * dx + dy * dy + dz * dz;
+                    if (nearestDistSquared < 0.0f || distSquared < nearestDistSquared)
+                    {
+                        nearestDistSquared = distSquared;
+                        nearestIndex = waypointIndex;
+                    }
+                }
+            }
+        }
     }
+    return nearestIndex;
 }
 
-const vector<EverQuestForageZoneItem>& EverQuestMod::GetForageZoneItemsInMap(uint32 mapID)
+static uint64 GetCachedWaypointLegBytes(const EverQuestCachedWaypointLeg& leg)
 {
-    if (ForageZoneItemsByMapID.find(mapID) != ForageZoneItemsByMapID.end())
-    {
-        return ForageZoneItemsByMapID[mapID];
-    }
-    else
+    return sizeof(uint64) + sizeof(EverQuestCachedWaypointLeg) + leg.Points.capacity() * sizeof(G3D::Vector3) + leg.GridIDs.capacity() * sizeof(uint32);
+}
+
+static void RemoveCachedWaypointLeg(EverQuestWaypointLegMapCache& legCache, unordered_map<uint64, EverQuestCachedWaypointLeg>::iterator legIter, EverQuestWaypointLegCacheStats& stats)
+{
+    for (uint32 gridID : legIter->second.GridIDs)
     {
-        static const vector<EverQuestForageZoneItem> returnEmpty;
-        return returnEmpty;
+        auto gridIter = legCache.LegKeysByGridID.find(gridID);
+        if (gridIter == legCache.LegKeysByGridID.end())
+            continue;
+        vector<uint64>& gridLegKeys = gridIter->second;
+        gridLegKeys.erase(std::remove(gridLegKeys.begin(), gridLegKeys.end(), legIter->first), gridLegKeys.end());
+        if (gridLegKeys.empty() == true)
+            legCache.LegKeysByGridID.erase(gridIter);
     }
+    stats.CachedLegCount--;
+    stats.CachedBytes -= GetCachedWaypointLegBytes(legIter->second);
+    legCache.LegsByKey.erase(legIter);
 }
 
-void EverQuestMod::LoadZoneSafePointData()
+bool EverQuestMod::TryGetCachedWaypointLeg(Map* map, uint64 legKey, Movement::PointsArray& pointsOut, float& terrainSnappedTargetZOut)
 {
-    ZoneSafePointByMapID.clear();
+    uint64 mapInstanceKey = GetMapInstanceKey(map);
+    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+    auto legCacheIter = WaypointLegCachesByMapInstanceKey.find(mapInstanceKey);
+    if (legCacheIter != WaypointLegCachesByMapInstanceKey.end())
+    {
+        auto legIter = legCacheIter->second.LegsByKey.find(legKey);
+        if (legIter != legCacheIter->second.LegsByKey.end())
+        {
+            pointsOut = legIter->second.Points;
+            terrainSnappedTargetZOut = legIter->second.TerrainSnappedTargetZ;
+            WaypointLegCacheStats.Hits++;
+            return true;
+        }
+    }
 
-    QueryResult queryResult = WorldDatabase.Query("SELECT MapID, X, Y, Z, Orientation FROM mod_everquest_zone_safe_point;");
-    if (queryResult)
+    // Baked legs are shared by every instance of the map, and are never invalidated since the terrain they were built over doesn't change
+    auto bakedMapIter = BakedWaypointLegsByMapIDThenLegKey.find(map->GetId());
+    if (bakedMapIter != BakedWaypointLegsByMapIDThenLegKey.end())
     {
-        do
+        auto bakedLegIter = bakedMapIter->second.find(legKey);
+        if (bakedLegIter != bakedMapIter->second.end())
         {
-            Field* fields = queryResult->Fetch();
-            EverQuestZoneSafePoint zoneSafePoint;
-            zoneSafePoint.MapID = fields[0].Get<uint32>();
-            zoneSafePoint.X = fields[1].Get<float>();
-            zoneSafePoint.Y = fields[2].Get<float>();
-            zoneSafePoint.Z = fields[3].Get<float>();
-            zoneSafePoint.Orientation = fields[4].Get<float>();
-            ZoneSafePointByMapID[zoneSafePoint.MapID] = zoneSafePoint;
-        } while (queryResult->NextRow());
+            pointsOut = bakedLegIter->second.Points;
+            terrainSnappedTargetZOut = bakedLegIter->second.TerrainSnappedTargetZ;
+            WaypointLegCacheStats.BakedHits++;
+            return true;
+        }
     }
+    WaypointLegCacheStats.Misses++;
+    return false;
 }
 
-void EverQuestMod::LoadZoneData()
+void EverQuestMod::StoreCachedWaypointLeg(Map* map, uint64 legKey, const Movement::PointsArray& points, float terrainSnappedTargetZ)
 {
-    ZoneByMapID.clear();
-    InstanceRaidLowMapIDs.clear();
-    OpenWorldMapIDByInstanceRaidLowMapID.clear();
+    if (points.size() < 2)
+        return;
 
-    QueryResult queryResult = WorldDatabase.Query("SELECT MapID, AllowBind, ExpansionID, MaxAgroZDistance, InstanceRaidLowMapID FROM mod_everquest_zone;");
-    if (queryResult)
+    // Every grid the leg passes through, so unloading any of them drops it
+    EverQuestCachedWaypointLeg leg;
+    leg.Points = points;
+    leg.TerrainSnappedTargetZ = terrainSnappedTargetZ;
+    for (const G3D::Vector3& point : points)
     {
-        do
-        {
-            Field* fields = queryResult->Fetch();
-            EverQuestZone zone;
-            zone.MapID = fields[0].Get<uint32>();
-            zone.AllowBind = fields[1].Get<uint8>() != 0;
-            zone.ExpansionID = fields[2].Get<int32>();
-            zone.MaxAgroZDistance = fields[3].Get<float>();
-            zone.InstanceRaidLowMapID = fields[4].Get<uint32>();
-            ZoneByMapID[zone.MapID] = zone;
-            if (zone.InstanceRaidLowMapID != 0)
-            {
-                InstanceRaidLowMapIDs.insert(zone.InstanceRaidLowMapID);
-                OpenWorldMapIDByInstanceRaidLowMapID[zone.InstanceRaidLowMapID] = zone.MapID;
-            }
-        } while (queryResult->NextRow());
+        uint32 gridID = Acore::ComputeGridCoord(point.x, point.y).GetId();
+        if (std::find(leg.GridIDs.begin(), leg.GridIDs.end(), gridID) == leg.GridIDs.end())
+            leg.GridIDs.push_back(gridID);
     }
+
+    uint64 mapInstanceKey = GetMapInstanceKey(map);
+    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+    EverQuestWaypointLegMapCache& legCache = WaypointLegCachesByMapInstanceKey[mapInstanceKey];
+    auto existingLegIter = legCache.LegsByKey.find(legKey);
+    if (existingLegIter != legCache.LegsByKey.end())
+        RemoveCachedWaypointLeg(legCache, existingLegIter, WaypointLegCacheStats);
+    for (uint32 gridID : leg.GridIDs)
+        legCache.LegKeysByGridID[gridID].push_back(legKey);
+    WaypointLegCacheStats.Stores++;
+    WaypointLegCacheStats.CachedLegCount++;
+    WaypointLegCacheStats.CachedBytes += GetCachedWaypointLegBytes(leg);
+    legCache.LegsByKey.emplace(legKey, std::move(leg));
 }
 
-bool EverQuestMod::IsBindAllowedForMap(uint32 mapID)
+void EverQuestMod::InvalidateCachedWaypointLegsForGrid(Map* map, uint32 gridX, uint32 gridY)
 {
-    // Any zone missing from the zone data is considered bind-restricted
-    auto zoneIt = ZoneByMapID.find(mapID);
-    if (zoneIt == ZoneByMapID.end())
-        return false;
-    return zoneIt->second.AllowBind;
+    uint64 mapInstanceKey = GetMapInstanceKey(map);
+    uint32 gridID = GridCoord(gridX, gridY).GetId();
+    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+    auto legCacheIter = WaypointLegCachesByMapInstanceKey.find(mapInstanceKey);
+    if (legCacheIter == WaypointLegCachesByMapInstanceKey.end())
+        return;
+    EverQuestWaypointLegMapCache& legCache = legCacheIter->second;
+    auto gridIter = legCache.LegKeysByGridID.find(gridID);
+    if (gridIter == legCache.LegKeysByGridID.end())
+        return;
+
+    // Copied out, since removing each leg also edits this grid's own list
+    vector<uint64> gridLegKeys = gridIter->second;
+    for (uint64 legKey : gridLegKeys)
+    {
+        auto legIter = legCache.LegsByKey.find(legKey);
+        if (legIter == legCache.LegsByKey.end())
+            continue;
+        RemoveCachedWaypointLeg(legCache, legIter, WaypointLegCacheStats);
+        WaypointLegCacheStats.InvalidatedLegs++;
+    }
+    if (legCache.LegsByKey.empty() == true)
+        WaypointLegCachesByMapInstanceKey.erase(legCacheIter);
 }
 
-float EverQuestMod::GetMaxAgroZDistanceForMap(uint32 mapID)
+void EverQuestMod::ClearCachedWaypointLegsForMap(Map* map)
 {
-    auto zoneIt = ZoneByMapID.find(mapID);
-    if (zoneIt == ZoneByMapID.end())
-        return -1.0f;
-    return zoneIt->second.MaxAgroZDistance;
+    uint64 mapInstanceKey = GetMapInstanceKey(map);
+    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+    auto legCacheIter = WaypointLegCachesByMapInstanceKey.find(mapInstanceKey);
+    if (legCacheIter == WaypointLegCachesByMapInstanceKey.end())
+        return;
+    for (const auto& legByKey : legCacheIter->second.LegsByKey)
+    {
+        WaypointLegCacheStats.CachedLegCount--;
+        WaypointLegCacheStats.CachedBytes -= GetCachedWaypointLegBytes(legByKey.second);
+        WaypointLegCacheStats.InvalidatedLegs++;
+    }
+    WaypointLegCachesByMapInstanceKey.erase(legCacheIter);
 }
 
-uint32 EverQuestMod::GetInstanceRaidLowMapIDForMap(uint32 mapID)
+EverQuestWaypointLegCacheStats EverQuestMod::GetWaypointLegCacheStats()
 {
-    auto zoneIt = ZoneByMapID.find(mapID);
-    if (zoneIt == ZoneByMapID.end())
-        return 0;
-    return zoneIt->second.InstanceRaidLowMapID;
+    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+    return WaypointLegCacheStats;
 }
 
-bool EverQuestMod::IsMapInstanceRaidLow(uint32 mapID)
+uint64 EverQuestMod::MakeWaypointLegCacheKey(uint32 waypointListID, uint32 fromWaypointIndex, uint32 toWaypointIndex, bool disableGroundContour, bool canFly)
 {
-    return InstanceRaidLowMapIDs.find(mapID) != InstanceRaidLowMapIDs.end();
+    uint64 profileFlags = 0;
+    if (disableGroundContour == true)
+        profileFlags |= 1;
+    if (canFly == true)
+        profileFlags |= 2;
+    return (uint64(waypointListID) << 32) | (uint64(fromWaypointIndex) << 17) | (uint64(toWaypointIndex) << 2) | profileFlags;
 }
 
-uint32 EverQuestMod::GetOpenWorldMapIDForMapID(uint32 mapID)
+void EverQuestMod::DecodeWaypointLegCacheKey(uint64 legKey, uint32& waypointListID, uint32& fromWaypointIndex, uint32& toWaypointIndex)
 {
-    // Any data rows keyed by a map ID (kill spawns, forage) are only generated for the open world copy so instanced copies resolve back to the open version
-    auto openWorldMapIDIt = OpenWorldMapIDByInstanceRaidLowMapID.find(mapID);
-    if (openWorldMapIDIt == OpenWorldMapIDByInstanceRaidLowMapID.end())
-        return mapID;
-    return openWorldMapIDIt->second;
+    waypointListID = uint32(legKey >> 32);
+    fromWaypointIndex = uint32((legKey >> 17) & EQ_MOVE_PATH_CACHE_MAX_WAYPOINT_INDEX);
+    toWaypointIndex = uint32((legKey >> 2) & EQ_MOVE_PATH_CACHE_MAX_WAYPOINT_INDEX);
 }
 
-void EverQuestMod::UpdateRaidLowInstanceStateForPlayer(Player* player)
+static void RollPathingBudgetTick(EverQuestPathingMapBudget& budget, uint64 currentMSTime)
 {
-    if (player == nullptr)
-        return;
-
-    uint32 mapID = player->GetMapId();
-    uint32 instanceID = player->GetInstanceId();
-    bool isInsideRaidLowInstance = (instanceID != 0 && IsMapInstanceRaidLow(mapID) == true);
-
-    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
-    if (isInsideRaidLowInstance == true)
-    {
-        EverQuestPlayerRaidLowInstanceState& raidLowInstanceState = RaidLowInstanceStateByPlayerGUID[player->GetGUID()];
-        raidLowInstanceState.RaidLowMapID = mapID;
-        raidLowInstanceState.InstanceID = instanceID;
-        raidLowInstanceState.IsInside = true;
+    // Every map updates once per world update, and game time only moves between world updates, so a new game time is a new tick
+    if (budget.TickMSTime == currentMSTime)
         return;
-    }
+    budget.TickMSTime = currentMSTime;
+    budget.PathsThisTick = 0;
 
-    // Which instance was left is remembered, since that's what a zone line back into the zone needs to route to
-    auto raidLowInstanceStateIt = RaidLowInstanceStateByPlayerGUID.find(player->GetGUID());
-    if (raidLowInstanceStateIt != RaidLowInstanceStateByPlayerGUID.end())
-        raidLowInstanceStateIt->second.IsInside = false;
+    // Anywhere in the queue, since a creature that stopped asking holds its place ahead of ones still asking behind it
+    budget.WaitingCreatures.erase(std::remove_if(budget.WaitingCreatures.begin(), budget.WaitingCreatures.end(),
+        [currentMSTime](const std::pair<ObjectGuid, uint64>& waitingCreature) { return currentMSTime - waitingCreature.second > EQ_MOVE_PATH_BUDGET_QUEUE_STALE_MS; }),
+        budget.WaitingCreatures.end());
 }
 
-void EverQuestMod::ClearRaidLowInstanceStateForPlayer(ObjectGuid playerGUID)
+// Failed legs are keyed into the waypoint tables, so a budget first used after a world data reload forgets the ones it had
+static EverQuestPathingMapBudget* GetOrCreatePathingBudget(Map* map, uint32 worldDataGeneration)
 {
-    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
-    RaidLowInstanceStateByPlayerGUID.erase(playerGUID);
+    EverQuestPathingMapBudget* budget = map->CustomData.GetDefault<EverQuestPathingMapBudget>(EQ_MAP_CUSTOMDATA_PATHINGBUDGET);
+    budget->MapID = map->GetId();
+    budget->InstanceID = map->GetInstanceId();
+    if (budget->WorldDataGeneration != worldDataGeneration)
+    {
+        budget->FailedWaypointLegsByLegKey.clear();
+        budget->WorldDataGeneration = worldDataGeneration;
+    }
+    return budget;
 }
 
-// True when the player's own last raid instance for this map still has somebody else standing in it
-bool EverQuestMod::HasOccupiedRaidLowInstanceForMap(ObjectGuid playerGUID, uint32 raidLowMapID)
+bool EverQuestMod::TryReservePathingBudget(Creature* creature)
 {
-    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
-    auto raidLowInstanceStateIt = RaidLowInstanceStateByPlayerGUID.find(playerGUID);
-    if (raidLowInstanceStateIt == RaidLowInstanceStateByPlayerGUID.end())
-        return false;
-    if (raidLowInstanceStateIt->second.RaidLowMapID != raidLowMapID || raidLowInstanceStateIt->second.InstanceID == 0)
-        return false;
+    uint64 currentMSTime = GameTime::GetGameTimeMS().count();
+    ObjectGuid creatureGUID = creature->GetGUID();
+    EverQuestPathingMapBudget& budget = *GetOrCreatePathingBudget(creature->GetMap(), GetWorldDataGeneration());
+    RollPathingBudgetTick(budget, currentMSTime);
 
-    uint32 instanceID = raidLowInstanceStateIt->second.InstanceID;
-    for (auto const& raidLowInstanceStateByPlayerGUID : RaidLowInstanceStateByPlayerGUID)
+    // Creatures already waiting get the tick's remaining runs first, in the order they asked
+    uint32 remainingPaths = budget.PathsThisTick < EQ_MOVE_PATH_BUDGET_PER_MAP_TICK ? EQ_MOVE_PATH_BUDGET_PER_MAP_TICK - budget.PathsThisTick : 0;
+    auto waitingIter = std::find_if(budget.WaitingCreatures.begin(), budget.WaitingCreatures.end(),
+        [&creatureGUID](const std::pair<ObjectGuid, uint64>& waitingCreature) { return waitingCreature.first == creatureGUID; });
+    if (waitingIter == budget.WaitingCreatures.end())
+    {
+        if (budget.WaitingCreatures.size() >= remainingPaths)
+        {
+            budget.WaitingCreatures.emplace_back(creatureGUID, currentMSTime);
+            budget.Deferrals++;
+            return false;
+        }
+    }
+    else
+    {
+        if (uint32(std::distance(budget.WaitingCreatures.begin(), waitingIter)) >= remainingPaths)
+        {
+            waitingIter->second = currentMSTime;
+            budget.Deferrals++;
+            return false;
+        }
+        budget.WaitingCreatures.erase(waitingIter);
+    }
+
+    budget.PathsThisTick++;
+    budget.PathsBuilt++;
+    return true;
+}
+
+// Creatures that engage or leave the world stop asking, so they give up their place right away instead of holding it until they go stale
+void EverQuestMod::RemovePathingBudgetWaiter(Creature* creature)
+{
+    EverQuestPathingMapBudget* budget = creature->GetMap()->CustomData.Get<EverQuestPathingMapBudget>(EQ_MAP_CUSTOMDATA_PATHINGBUDGET);
+    if (budget == nullptr)
+        return;
+    ObjectGuid creatureGUID = creature->GetGUID();
+    auto waitingIter = std::find_if(budget->WaitingCreatures.begin(), budget->WaitingCreatures.end(),
+        [&creatureGUID](const std::pair<ObjectGuid, uint64>& waitingCreature) { return waitingCreature.first == creatureGUID; });
+    if (waitingIter != budget->WaitingCreatures.end())
+        budget->WaitingCreatures.erase(waitingIter);
+}
+
+bool EverQuestMod::IsWaypointLegBackingOff(Map* map, uint64 legKey)
+{
+    EverQuestPathingMapBudget* budget = map->CustomData.Get<EverQuestPathingMapBudget>(EQ_MAP_CUSTOMDATA_PATHINGBUDGET);
+    if (budget == nullptr || budget->WorldDataGeneration != GetWorldDataGeneration())
+        return false;
+    auto failedLegIter = budget->FailedWaypointLegsByLegKey.find(legKey);
+    if (failedLegIter == budget->FailedWaypointLegsByLegKey.end())
+        return false;
+    return uint64(GameTime::GetGameTimeMS().count()) < failedLegIter->second.NextAttemptMSTime;
+}
+
+void EverQuestMod::RecordWaypointLegPathResult(Map* map, uint64 legKey, bool pathBuilt)
+{
+    uint64 currentMSTime = GameTime::GetGameTimeMS().count();
+    if (pathBuilt == true)
+    {
+        EverQuestPathingMapBudget* budget = map->CustomData.Get<EverQuestPathingMapBudget>(EQ_MAP_CUSTOMDATA_PATHINGBUDGET);
+        if (budget != nullptr)
+            budget->FailedWaypointLegsByLegKey.erase(legKey);
+        return;
+    }
+
+    EverQuestPathingMapBudget& budget = *GetOrCreatePathingBudget(map, GetWorldDataGeneration());
+    EverQuestFailedWaypointLeg& failedLeg = budget.FailedWaypointLegsByLegKey[legKey];
+    failedLeg.FailCount++;
+    failedLeg.LastFailMSTime = currentMSTime;
+    uint64 backoffMS = EQ_MOVE_PATH_BACKOFF_MAX_MS;
+    if (failedLeg.FailCount <= 16)
+        backoffMS = std::min<uint64>(uint64(EQ_MOVE_PATH_BACKOFF_BASE_MS) << (failedLeg.FailCount - 1), EQ_MOVE_PATH_BACKOFF_MAX_MS);
+    failedLeg.NextAttemptMSTime = currentMSTime + backoffMS;
+    budget.WaypointLegFailures++;
+}
+
+void EverQuestMod::RecordRoamPathFailure(Map* map)
+{
+    GetOrCreatePathingBudget(map, GetWorldDataGeneration())->RoamPathFailures++;
+}
+
+// Only the copy handed to .eqpathfailures sits behind RuntimeStateMutex, and only every EQ_MOVE_PATH_BUDGET_REPORT_MS
+void EverQuestMod::UpdatePathingBudgetReportForMap(Map* map)
+{
+    EverQuestPathingMapBudget* budget = map->CustomData.Get<EverQuestPathingMapBudget>(EQ_MAP_CUSTOMDATA_PATHINGBUDGET);
+    if (budget == nullptr)
+        return;
+    uint64 currentMSTime = GameTime::GetGameTimeMS().count();
+    if (currentMSTime >= budget->LastReportMSTime && currentMSTime - budget->LastReportMSTime < EQ_MOVE_PATH_BUDGET_REPORT_MS)
+        return;
+    budget->LastReportMSTime = currentMSTime;
+    uint64 mapInstanceKey = GetMapInstanceKey(map);
+    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+    PathingBudgetReportsByMapInstanceKey[mapInstanceKey] = *budget;
+}
+
+void EverQuestMod::ClearPathingBudgetForMap(Map* map)
+{
+    uint64 mapInstanceKey = GetMapInstanceKey(map);
+    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+    PathingBudgetReportsByMapInstanceKey.erase(mapInstanceKey);
+}
+
+vector<EverQuestPathingMapBudget> EverQuestMod::GetPathingBudgetsSnapshot()
+{
+    vector<EverQuestPathingMapBudget> budgets;
+    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+    budgets.reserve(PathingBudgetReportsByMapInstanceKey.size());
+    for (const auto& budgetByMapInstanceKey : PathingBudgetReportsByMapInstanceKey)
+        budgets.push_back(budgetByMapInstanceKey.second);
+    return budgets;
+}
+
+bool EverQuestMod::IsWaypointLegKeyInWaypointData(const EverQuestWorldData& worldData, uint32 mapID, uint64 legKey)
+{
+    uint32 waypointListID = 0;
+    uint32 fromWaypointIndex = 0;
+    uint32 toWaypointIndex = 0;
+    DecodeWaypointLegCacheKey(legKey, waypointListID, fromWaypointIndex, toWaypointIndex);
+    const vector<EverQuestCreatureWaypoint>& waypoints = GetWaypointSet(worldData, mapID, waypointListID)->Waypoints;
+    return fromWaypointIndex < waypoints.size() && toWaypointIndex < waypoints.size();
+}
+
+// Note: Reads the file without holding RuntimeStateMutex, as it runs on the reload thread or at startup before the legs are published
+void EverQuestMod::LoadBakedWaypointLegs(const string& bakeFilePath, const EverQuestWorldData& worldData, unordered_map<uint32, unordered_map<uint64, EverQuestCachedWaypointLeg>>& bakedLegsOut)
+{
+    bakedLegsOut.clear();
+    if (bakeFilePath.empty() == true)
+        return;
+
+    std::ifstream bakeFile(bakeFilePath, std::ios::binary);
+    if (bakeFile.is_open() == false)
+    {
+        LOG_INFO("module.EverQuest", "EverQuestMod::LoadBakedWaypointLegs found no baked waypoint leg file at '{}', so all waypoint legs will be pathed live", bakeFilePath);
+        return;
+    }
+
+    uint32 magic = 0;
+    uint32 version = 0;
+    uint32 recordCount = 0;
+    bakeFile.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    bakeFile.read(reinterpret_cast<char*>(&version), sizeof(version));
+    bakeFile.read(reinterpret_cast<char*>(&recordCount), sizeof(recordCount));
+    if (bakeFile.good() == false || magic != EQ_MOVE_PATH_BAKE_FILE_MAGIC || version != EQ_MOVE_PATH_BAKE_FILE_VERSION)
+    {
+        LOG_ERROR("module.EverQuest", "EverQuestMod::LoadBakedWaypointLegs could not read '{}' as a version {} baked waypoint leg file, so it was ignored", bakeFilePath, EQ_MOVE_PATH_BAKE_FILE_VERSION);
+        return;
+    }
+
+    uint32 staleLegCount = 0;
+    uint32 bakedLegCount = 0;
+    for (uint32 recordIndex = 0; recordIndex < recordCount; ++recordIndex)
+    {
+        uint32 mapID = 0;
+        uint64 legKey = 0;
+        float legEnds[6];
+        float terrainSnappedTargetZ = 0;
+        uint32 pointCount = 0;
+        bakeFile.read(reinterpret_cast<char*>(&mapID), sizeof(mapID));
+        bakeFile.read(reinterpret_cast<char*>(&legKey), sizeof(legKey));
+        bakeFile.read(reinterpret_cast<char*>(legEnds), sizeof(legEnds));
+        bakeFile.read(reinterpret_cast<char*>(&terrainSnappedTargetZ), sizeof(terrainSnappedTargetZ));
+        bakeFile.read(reinterpret_cast<char*>(&pointCount), sizeof(pointCount));
+        if (bakeFile.good() == false || pointCount < 2 || pointCount > 0xFFFF)
+        {
+            LOG_ERROR("module.EverQuest", "EverQuestMod::LoadBakedWaypointLegs found '{}' cut short or corrupt at record {}, so only the legs before it were kept", bakeFilePath, recordIndex);
+            break;
+        }
+        EverQuestCachedWaypointLeg leg;
+        leg.TerrainSnappedTargetZ = terrainSnappedTargetZ;
+        leg.Points.resize(pointCount);
+        for (G3D::Vector3& point : leg.Points)
+        {
+            float pointXYZ[3];
+            bakeFile.read(reinterpret_cast<char*>(pointXYZ), sizeof(pointXYZ));
+            point = G3D::Vector3(pointXYZ[0], pointXYZ[1], pointXYZ[2]);
+        }
+        if (bakeFile.good() == false)
+        {
+            LOG_ERROR("module.EverQuest", "EverQuestMod::LoadBakedWaypointLegs found '{}' cut short or corrupt at record {}, so only the legs before it were kept", bakeFilePath, recordIndex);
+            break;
+        }
+
+        // Waypoints edited in the database since the bake would send creatures down the old line, so those legs are left to path live
+        uint32 waypointListID = 0;
+        uint32 fromWaypointIndex = 0;
+        uint32 toWaypointIndex = 0;
+        if (IsWaypointLegKeyInWaypointData(worldData, mapID, legKey) == false)
+        {
+            staleLegCount++;
+            continue;
+        }
+        DecodeWaypointLegCacheKey(legKey, waypointListID, fromWaypointIndex, toWaypointIndex);
+        const vector<EverQuestCreatureWaypoint>& waypoints = GetWaypointSet(worldData, mapID, waypointListID)->Waypoints;
+        const EverQuestCreatureWaypoint& fromWaypoint = waypoints[fromWaypointIndex];
+        const EverQuestCreatureWaypoint& toWaypoint = waypoints[toWaypointIndex];
+        if (std::fabs(fromWaypoint.X - legEnds[0]) > EQ_MOVE_PATH_BAKE_WAYPOINT_TOLERANCE || std::fabs(fromWaypoint.Y - legEnds[1]) > EQ_MOVE_PATH_BAKE_WAYPOINT_TOLERANCE
+            || std::fabs(fromWaypoint.Z - legEnds[2]) > EQ_MOVE_PATH_BAKE_WAYPOINT_TOLERANCE || std::fabs(toWaypoint.X - legEnds[3]) > EQ_MOVE_PATH_BAKE_WAYPOINT_TOLERANCE
+            || std::fabs(toWaypoint.Y - legEnds[4]) > EQ_MOVE_PATH_BAKE_WAYPOINT_TOLERANCE || std::fabs(toWaypoint.Z - legEnds[5]) > EQ_MOVE_PATH_BAKE_WAYPOINT_TOLERANCE)
+        {
+            staleLegCount++;
+            continue;
+        }
+
+        if (bakedLegsOut[mapID].emplace(legKey, std::move(leg)).second == true)
+            bakedLegCount++;
+    }
+
+    LOG_INFO("module.EverQuest", "EverQuestMod::LoadBakedWaypointLegs loaded {} baked waypoint legs across {} maps from '{}' ({} stale legs dropped)", bakedLegCount,
+        bakedLegsOut.size(), bakeFilePath, staleLegCount);
+}
+
+// Note: Writes from a copy of the baked legs, so RuntimeStateMutex isn't held across the file I/O
+bool EverQuestMod::WriteBakedWaypointLegs(const string& bakeFilePath, const unordered_map<uint32, unordered_map<uint64, EverQuestCachedWaypointLeg>>& bakedLegs)
+{
+    if (bakeFilePath.empty() == true)
+        return false;
+    std::lock_guard<std::mutex> fileLock(BakedWaypointLegFileMutex);
+
+    // Written to the side and then swapped in, so a crash mid-write never leaves a torn file for the next startup
+    string tempFilePath = bakeFilePath + ".tmp";
+    {
+        std::ofstream bakeFile(tempFilePath, std::ios::binary | std::ios::trunc);
+        if (bakeFile.is_open() == false)
+        {
+            LOG_ERROR("module.EverQuest", "EverQuestMod::WriteBakedWaypointLegs could not open '{}' for writing", tempFilePath);
+            return false;
+        }
+
+        uint32 magic = EQ_MOVE_PATH_BAKE_FILE_MAGIC;
+        uint32 version = EQ_MOVE_PATH_BAKE_FILE_VERSION;
+        uint32 recordCount = 0;
+        for (const auto& legsByMapID : bakedLegs)
+            for (const auto& legByKey : legsByMapID.second)
+                if (IsWaypointLegKeyInWaypointData(GetWorldData(), legsByMapID.first, legByKey.first) == true)
+                    recordCount++;
+        bakeFile.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
+        bakeFile.write(reinterpret_cast<const char*>(&version), sizeof(version));
+        bakeFile.write(reinterpret_cast<const char*>(&recordCount), sizeof(recordCount));
+
+        for (const auto& legsByMapID : bakedLegs)
+        {
+            uint32 mapID = legsByMapID.first;
+            for (const auto& legByKey : legsByMapID.second)
+            {
+                if (IsWaypointLegKeyInWaypointData(GetWorldData(), mapID, legByKey.first) == false)
+                    continue;
+                uint32 waypointListID = 0;
+                uint32 fromWaypointIndex = 0;
+                uint32 toWaypointIndex = 0;
+                DecodeWaypointLegCacheKey(legByKey.first, waypointListID, fromWaypointIndex, toWaypointIndex);
+                const vector<EverQuestCreatureWaypoint>& waypoints = GetWaypoints(mapID, waypointListID);
+                const EverQuestCreatureWaypoint& fromWaypoint = waypoints[fromWaypointIndex];
+                const EverQuestCreatureWaypoint& toWaypoint = waypoints[toWaypointIndex];
+                float legEnds[6] = { fromWaypoint.X, fromWaypoint.Y, fromWaypoint.Z, toWaypoint.X, toWaypoint.Y, toWaypoint.Z };
+                uint32 pointCount = uint32(legByKey.second.Points.size());
+                bakeFile.write(reinterpret_cast<const char*>(&mapID), sizeof(mapID));
+                bakeFile.write(reinterpret_cast<const char*>(&legByKey.first), sizeof(legByKey.first));
+                bakeFile.write(reinterpret_cast<const char*>(legEnds), sizeof(legEnds));
+                bakeFile.write(reinterpret_cast<const char*>(&legByKey.second.TerrainSnappedTargetZ), sizeof(legByKey.second.TerrainSnappedTargetZ));
+                bakeFile.write(reinterpret_cast<const char*>(&pointCount), sizeof(pointCount));
+                for (const G3D::Vector3& point : legByKey.second.Points)
+                {
+                    float pointXYZ[3] = { point.x, point.y, point.z };
+                    bakeFile.write(reinterpret_cast<const char*>(pointXYZ), sizeof(pointXYZ));
+                }
+            }
+        }
+        if (bakeFile.good() == false)
+        {
+            LOG_ERROR("module.EverQuest", "EverQuestMod::WriteBakedWaypointLegs failed while writing '{}'", tempFilePath);
+            return false;
+        }
+    }
+
+    std::remove(bakeFilePath.c_str());
+    if (std::rename(tempFilePath.c_str(), bakeFilePath.c_str()) != 0)
+    {
+        LOG_ERROR("module.EverQuest", "EverQuestMod::WriteBakedWaypointLegs could not move '{}' over '{}'", tempFilePath, bakeFilePath);
+        return false;
+    }
+    return true;
+}
+
+// Note: Runs on the world thread from .eqpathbake, while no map is updating, so the map's custom data can be written here
+bool EverQuestMod::StartWaypointLegBakeForMap(Map* map, Player* requester)
+{
+    if (map->CustomData.Get<EverQuestWaypointLegBakeJob>(EQ_MAP_CUSTOMDATA_WAYPOINTLEGBAKE) != nullptr)
+        return false;
+
+    // Every list in the spawn data is baked, not only those with a walker loaded right now, so the lists come from the world data
+    uint32 mapID = map->GetId();
+    std::map<uint32, vector<uint32>> spawnIDsByWaypointListID;
+    for (const auto& creatureInstancePair : GetWorldData().CreatureInstancesByCreatureGUID)
+    {
+        const EverQuestCreatureInstance& instanceData = creatureInstancePair.second;
+        if (instanceData.MapID != mapID || instanceData.WaypointListID == uint32(-1) || instanceData.DoesRoam == true || instanceData.RoamMinZ != 0 || instanceData.RoamMaxZ != 0)
+            continue;
+        const vector<EverQuestCreatureWaypoint>& waypoints = GetWaypoints(mapID, instanceData.WaypointListID);
+        if (waypoints.size() < 2 || waypoints.size() > EQ_MOVE_PATH_CACHE_MAX_WAYPOINT_INDEX + 1)
+            continue;
+        spawnIDsByWaypointListID[instanceData.WaypointListID].push_back(instanceData.CreatureGUID);
+    }
+
+    EverQuestWaypointLegBakeJob* bakeJob = map->CustomData.GetDefault<EverQuestWaypointLegBakeJob>(EQ_MAP_CUSTOMDATA_WAYPOINTLEGBAKE);
+    bakeJob->RequesterGUID = requester->GetGUID();
+    bakeJob->BakeFilePath = ConfigPathingBakedWaypointLegFile;
+    for (auto& spawnIDsByListID : spawnIDsByWaypointListID)
+    {
+        EverQuestWaypointLegBakeList bakeList;
+        bakeList.WaypointListID = spawnIDsByListID.first;
+        bakeList.SpawnIDs = std::move(spawnIDsByListID.second);
+        bakeJob->Lists.push_back(std::move(bakeList));
+    }
+    LOG_INFO("module.EverQuest", "EverQuestMod::StartWaypointLegBakeForMap started baking {} waypoint lists for map {}", bakeJob->Lists.size(), mapID);
+    return true;
+}
+
+// Note: Runs on the map's own update thread, so the walkers and grids it touches belong to this thread
+void EverQuestMod::UpdateWaypointLegBakeForMap(Map* map)
+{
+    EverQuestWaypointLegBakeJob* bakeJob = map->CustomData.Get<EverQuestWaypointLegBakeJob>(EQ_MAP_CUSTOMDATA_WAYPOINTLEGBAKE);
+    if (bakeJob == nullptr)
+        return;
+
+    // Only a few legs per update, since each one is a navmesh path and a height query per point
+    if (bakeJob->NextLegIndex < bakeJob->PendingLegs.size())
+    {
+        for (uint32 legsBaked = 0; legsBaked < EQ_MOVE_PATH_BAKE_LEGS_PER_UPDATE && bakeJob->NextLegIndex < bakeJob->PendingLegs.size(); ++legsBaked)
+        {
+            const EverQuestWaypointLegBakeLeg& bakeLeg = bakeJob->PendingLegs[bakeJob->NextLegIndex++];
+            Creature* creature = map->GetCreature(bakeLeg.WalkerGUID);
+            const EverQuestCreatureInstance* instanceData = creature != nullptr ? &GetCreatureInstanceData(creature->GetSpawnId()) : nullptr;
+            uint32 waypointListID = bakeJob->Lists[bakeJob->NextListIndex - 1].WaypointListID;
+            const vector<EverQuestCreatureWaypoint>& waypoints = GetWaypoints(map->GetId(), waypointListID);
+            if (bakeLeg.FromWaypointIndex >= waypoints.size() || bakeLeg.ToWaypointIndex >= waypoints.size())
+                continue;
+            const EverQuestCreatureWaypoint& fromWaypoint = waypoints[bakeLeg.FromWaypointIndex];
+            const EverQuestCreatureWaypoint& toWaypoint = waypoints[bakeLeg.ToWaypointIndex];
+            if (creature == nullptr)
+            {
+                bakeJob->Result.FailedLegs.push_back(fmt::format("List {} waypoint {} -> {}: the walker left the world before the leg was baked", waypointListID, fromWaypoint.Number, toWaypoint.Number));
+                continue;
+            }
+
+            // A live walker starts the leg standing on the prior waypoint, which it reached at that waypoint's snapped height
+            bool foundValidZ = false;
+            float startZ = GetEffectiveDestinationZForCreature(creature, instanceData->DisableGroundContour, 0, 0, 0, fromWaypoint.X, fromWaypoint.Y, fromWaypoint.Z, foundValidZ);
+            Position startPosition(fromWaypoint.X, fromWaypoint.Y, startZ);
+
+            EverQuestCachedWaypointLeg leg;
+            bool navmeshPathFound = false;
+            if (BuildSnappedPathForCreature(creature, *instanceData, false, startPosition, toWaypoint.X, toWaypoint.Y, toWaypoint.Z, leg.Points, leg.TerrainSnappedTargetZ, &navmeshPathFound) == false)
+            {
+                bakeJob->Result.FailedLegs.push_back(fmt::format("List {} waypoint {} -> {} ({:.1f}, {:.1f}, {:.1f}) -> ({:.1f}, {:.1f}, {:.1f}): no path could be built", waypointListID,
+                    fromWaypoint.Number, toWaypoint.Number, fromWaypoint.X, fromWaypoint.Y, fromWaypoint.Z, toWaypoint.X, toWaypoint.Y, toWaypoint.Z));
+                continue;
+            }
+            if (navmeshPathFound == false)
+            {
+                bakeJob->Result.FallbackLegCount++;
+                bakeJob->Result.FailedLegs.push_back(fmt::format("List {} waypoint {} -> {} ({:.1f}, {:.1f}, {:.1f}) -> ({:.1f}, {:.1f}, {:.1f}): no navmesh path, baked as a straight line", waypointListID,
+                    fromWaypoint.Number, toWaypoint.Number, fromWaypoint.X, fromWaypoint.Y, fromWaypoint.Z, toWaypoint.X, toWaypoint.Y, toWaypoint.Z));
+            }
+            uint64 legKey = MakeWaypointLegCacheKey(waypointListID, bakeLeg.FromWaypointIndex, bakeLeg.ToWaypointIndex, instanceData->DisableGroundContour, creature->CanFly());
+            bakeJob->BakedLegsByKey[legKey] = std::move(leg);
+        }
+        return;
+    }
+
+    if (bakeJob->NextListIndex >= bakeJob->Lists.size())
+    {
+        FinishWaypointLegBakeForMap(map, *bakeJob);
+        map->CustomData.Erase(EQ_MAP_CUSTOMDATA_WAYPOINTLEGBAKE);
+        return;
+    }
+
+    // Walkers in grids nobody is standing in aren't in the world, so their grids are loaded first and the walkers picked up on the next update
+    EverQuestWaypointLegBakeList& bakeList = bakeJob->Lists[bakeJob->NextListIndex];
+    if (bakeList.AreGridsLoaded == false)
+    {
+        for (uint32 spawnID : bakeList.SpawnIDs)
+        {
+            CreatureData const* creatureData = sObjectMgr->GetCreatureData(spawnID);
+            if (creatureData != nullptr && creatureData->mapid == map->GetId())
+                map->LoadGrid(creatureData->posX, creatureData->posY);
+        }
+        bakeList.AreGridsLoaded = true;
+        return;
+    }
+    bakeJob->NextListIndex++;
+
+    // One walker per movement profile stands in for the rest, since the leg key already carries everything that makes two walkers path differently
+    unordered_map<uint64, Creature*> sampleCreatureByProfileKey;
+    for (uint32 spawnID : bakeList.SpawnIDs)
+    {
+        auto spawnIDRange = map->GetCreatureBySpawnIdStore().equal_range(spawnID);
+        for (auto spawnIDIter = spawnIDRange.first; spawnIDIter != spawnIDRange.second; ++spawnIDIter)
+        {
+            Creature* creature = spawnIDIter->second;
+            if (creature == nullptr || creature->IsInWorld() == false)
+                continue;
+            const EverQuestCreatureInstance& instanceData = GetCreatureInstanceData(spawnID);
+            uint64 profileKey = MakeWaypointLegCacheKey(bakeList.WaypointListID, 0, 0, instanceData.DisableGroundContour, creature->CanFly());
+            sampleCreatureByProfileKey.emplace(profileKey, creature);
+        }
+    }
+    if (sampleCreatureByProfileKey.empty() == true)
+    {
+        bakeJob->Result.SkippedListCount++;
+        bakeJob->Result.FailedLegs.push_back(fmt::format("List {}: none of its {} spawns could be brought into the world, so its baked legs were kept as they were", bakeList.WaypointListID,
+            bakeList.SpawnIDs.size()));
+        return;
+    }
+    bakeJob->Result.WaypointListCount++;
+
+    // Random path walkers only step to a neighbor, while the other random types can pick any waypoint from any other
+    const vector<EverQuestCreatureWaypoint>& waypoints = GetWaypoints(map->GetId(), bakeList.WaypointListID);
+    bakeJob->PendingLegs.clear();
+    bakeJob->NextLegIndex = 0;
+    for (const auto& sampleCreatureByKey : sampleCreatureByProfileKey)
+    {
+        Creature* creature = sampleCreatureByKey.second;
+        const EverQuestCreatureInstance& instanceData = GetCreatureInstanceData(creature->GetSpawnId());
+        bool bakeEveryPair = instanceData.WanderType != EQ_GRID_RANDOM_PATH && waypoints.size() <= EQ_MOVE_PATH_BAKE_MAX_RANDOM_WAYPOINTS;
+        for (uint32 fromIndex = 0; fromIndex < waypoints.size(); ++fromIndex)
+        {
+            for (uint32 toIndex = 0; toIndex < waypoints.size(); ++toIndex)
+            {
+                if (fromIndex == toIndex)
+                    continue;
+                if (bakeEveryPair == false && fromIndex + 1 != toIndex && toIndex + 1 != fromIndex)
+                    continue;
+                EverQuestWaypointLegBakeLeg bakeLeg;
+                bakeLeg.WalkerGUID = creature->GetGUID();
+                bakeLeg.FromWaypointIndex = fromIndex;
+                bakeLeg.ToWaypointIndex = toIndex;
+                bakeJob->PendingLegs.push_back(bakeLeg);
+            }
+        }
+    }
+}
+
+void EverQuestMod::FinishWaypointLegBakeForMap(Map* map, EverQuestWaypointLegBakeJob& bakeJob)
+{
+    uint32 mapID = map->GetId();
+    EverQuestWaypointLegBakeResult& result = bakeJob.Result;
+    result.BakedLegCount = uint32(bakeJob.BakedLegsByKey.size());
+
+    // Merged over what the map had, so lists that weren't reached this time keep their legs.  The file is written from a copy, outside the lock
+    unordered_map<uint32, unordered_map<uint64, EverQuestCachedWaypointLeg>> bakedLegsToWrite;
+    {
+        std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+        unordered_map<uint64, EverQuestCachedWaypointLeg>& mapBakedLegs = BakedWaypointLegsByMapIDThenLegKey[mapID];
+        for (auto& bakedLegByKey : bakeJob.BakedLegsByKey)
+        {
+            if (mapBakedLegs.insert_or_assign(bakedLegByKey.first, std::move(bakedLegByKey.second)).second == true)
+                WaypointLegCacheStats.BakedLegCount++;
+        }
+        if (mapBakedLegs.empty() == true)
+            BakedWaypointLegsByMapIDThenLegKey.erase(mapID);
+        bakedLegsToWrite = BakedWaypointLegsByMapIDThenLegKey;
+    }
+    bool isSaved = WriteBakedWaypointLegs(bakeJob.BakeFilePath, bakedLegsToWrite);
+
+    LOG_INFO("module.EverQuest", "EverQuestMod::FinishWaypointLegBakeForMap baked {} waypoint legs over {} lists for map {} ({} without a navmesh path, {} lists skipped, {} failed)", result.BakedLegCount,
+        result.WaypointListCount, mapID, result.FallbackLegCount, result.SkippedListCount, uint32(result.FailedLegs.size()) - result.FallbackLegCount - result.SkippedListCount);
+    for (const string& failedLeg : result.FailedLegs)
+        LOG_INFO("module.EverQuest", "EverQuestMod::FinishWaypointLegBakeForMap map {}: {}", mapID, failedLeg);
+
+    // The requester only hears back if they're still on the map, since players elsewhere belong to another thread
+    Player* requester = ObjectAccessor::GetPlayer(map, bakeJob.RequesterGUID);
+    if (requester == nullptr || requester->GetSession() == nullptr)
+        return;
+    ChatHandler handler(requester->GetSession());
+    handler.PSendSysMessage("Baked {} legs over {} waypoint lists for map {} ({} without a navmesh path, {} lists with no walker kept their old legs)", result.BakedLegCount,
+        result.WaypointListCount, mapID, result.FallbackLegCount, result.SkippedListCount);
+    for (size_t i = 0; i < result.FailedLegs.size() && i < EQ_MOVE_PATH_BAKE_MAX_REPORTED_FAILURES; ++i)
+        handler.SendSysMessage(result.FailedLegs[i]);
+    if (result.FailedLegs.size() > EQ_MOVE_PATH_BAKE_MAX_REPORTED_FAILURES)
+        handler.PSendSysMessage("...and {} more, see the server log", result.FailedLegs.size() - EQ_MOVE_PATH_BAKE_MAX_REPORTED_FAILURES);
+    if (isSaved == true)
+        handler.PSendSysMessage("Saved to '{}'", bakeJob.BakeFilePath);
+    else
+        handler.SendSysMessage("The baked legs are live now, but could not be saved (check EverQuest.Pathing.BakedWaypointLegFile)");
+}
+
+// Lookups are cached per small cell, so creatures walking the same waypoints and spawn points, or crossing the same ground on a roam, share
+// one result.  Each cell is resolved at its center rather than wherever the first creature asked, so the cached Z doesn't depend on who
+// got there first and a baked leg still matches what the AI builds
+static int32 GetTerrainZCacheCell(float position)
+{
+    return int32(std::floor(position / EQ_MOVE_TERRAIN_Z_CACHE_CELL_SIZE));
+}
+
+static float GetTerrainZCacheCellCenter(int32 cell)
+{
+    return (float(cell) + 0.5f) * EQ_MOVE_TERRAIN_Z_CACHE_CELL_SIZE;
+}
+
+static uint64 MakeTerrainZCacheKey(const EverQuestTerrainZCacheLookup& lookup)
+{
+    uint32 collisionBits = 0;
+    uint32 bandBits = 0;
+    std::memcpy(&collisionBits, &lookup.CollisionHeight, sizeof(uint32));
+    std::memcpy(&bandBits, &lookup.BandHeight, sizeof(uint32));
+    uint64 key = (uint64(uint32(lookup.CellX)) << 32) | uint64(uint32(lookup.CellY));
+    key ^= ((uint64(uint32(lookup.CellZ)) << 32) | uint64(collisionBits)) * 0x9E3779B97F4A7C15ULL;
+    key ^= ((uint64(bandBits) << 32) | uint64(lookup.PhaseMask)) * 0xC2B2AE3D27D4EB4FULL;
+    key ^= uint64(lookup.Kind) * 0x165667B19E3779F9ULL;
+    return key;
+}
+
+static bool IsSameTerrainZCacheLookup(const EverQuestTerrainZCacheLookup& a, const EverQuestTerrainZCacheLookup& b)
+{
+    return a.CellX == b.CellX && a.CellY == b.CellY && a.CellZ == b.CellZ && a.CollisionHeight == b.CollisionHeight && a.BandHeight == b.BandHeight
+        && a.PhaseMask == b.PhaseMask && a.Kind == b.Kind;
+}
+
+static void RollTerrainZCacheStatsMinute(EverQuestTerrainZCacheStats& stats)
+{
+    uint64 currentMSTime = GameTime::GetGameTimeMS().count();
+    if (stats.MinuteStartMSTime == 0)
+        stats.MinuteStartMSTime = currentMSTime;
+    if (currentMSTime - stats.MinuteStartMSTime < 60000)
+        return;
+    stats.LastMinuteHits = stats.MinuteHits;
+    stats.LastMinuteHeightQueriesAvoided = stats.MinuteHeightQueriesAvoided;
+    stats.MinuteHits = 0;
+    stats.MinuteHeightQueriesAvoided = 0;
+    stats.MinuteStartMSTime = currentMSTime;
+}
+
+void EverQuestMod::FlushTerrainZCacheStats(EverQuestTerrainZMapCache& zCache)
+{
+    {
+        std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+        RollTerrainZCacheStatsMinute(TerrainZCacheStats);
+        TerrainZCacheStats.Hits += zCache.PendingHits;
+        TerrainZCacheStats.MinuteHits += zCache.PendingHits;
+        TerrainZCacheStats.Misses += zCache.PendingMisses;
+        TerrainZCacheStats.HeightQueriesAvoided += zCache.PendingHeightQueriesAvoided;
+        TerrainZCacheStats.MinuteHeightQueriesAvoided += zCache.PendingHeightQueriesAvoided;
+        TerrainZCacheStats.Evictions += zCache.PendingEvictions;
+        TerrainZCacheStats.EntryCount = uint64(int64(TerrainZCacheStats.EntryCount) + zCache.PendingEntryCountChange);
+    }
+    zCache.PendingLookups = 0;
+    zCache.PendingHits = 0;
+    zCache.PendingMisses = 0;
+    zCache.PendingHeightQueriesAvoided = 0;
+    zCache.PendingEvictions = 0;
+    zCache.PendingEntryCountChange = 0;
+}
+
+bool EverQuestMod::TryGetCachedTerrainZ(Map* map, uint64 terrainZKey, const EverQuestTerrainZCacheLookup& lookup, EverQuestTerrainZCacheEntry& entryOut)
+{
+    EverQuestTerrainZMapCache* zCache = map->CustomData.GetDefault<EverQuestTerrainZMapCache>(EQ_MAP_CUSTOMDATA_TERRAINZCACHE);
+
+    // Counted on the map and only added to the shared stats every so often, so a lookup never waits on the runtime lock
+    zCache->PendingLookups++;
+    if (zCache->PendingLookups >= EQ_MOVE_TERRAIN_Z_CACHE_STATS_FLUSH_COUNT)
+        FlushTerrainZCacheStats(*zCache);
+
+    bool isHit = false;
+    auto entryIter = zCache->CurrentEntriesByKey.find(terrainZKey);
+    if (entryIter != zCache->CurrentEntriesByKey.end() && IsSameTerrainZCacheLookup(entryIter->second.Lookup, lookup) == true)
+    {
+        entryOut = entryIter->second;
+        isHit = true;
+    }
+    else
+    {
+        auto previousIter = zCache->PreviousEntriesByKey.find(terrainZKey);
+        if (previousIter != zCache->PreviousEntriesByKey.end() && IsSameTerrainZCacheLookup(previousIter->second.Lookup, lookup) == true)
+        {
+            entryOut = previousIter->second;
+            isHit = true;
+            StoreCachedTerrainZ(map, terrainZKey, entryOut);
+        }
+    }
+    if (isHit == false)
+    {
+        zCache->PendingMisses++;
+        return false;
+    }
+    zCache->PendingHits++;
+    zCache->PendingHeightQueriesAvoided += entryOut.HeightQueryCount;
+    return true;
+}
+
+void EverQuestMod::StoreCachedTerrainZ(Map* map, uint64 terrainZKey, const EverQuestTerrainZCacheEntry& entry)
+{
+    EverQuestTerrainZMapCache* zCache = map->CustomData.GetDefault<EverQuestTerrainZMapCache>(EQ_MAP_CUSTOMDATA_TERRAINZCACHE);
+    auto entryIter = zCache->CurrentEntriesByKey.find(terrainZKey);
+    if (entryIter != zCache->CurrentEntriesByKey.end())
+    {
+        entryIter->second = entry;
+        return;
+    }
+
+    if (zCache->CurrentEntriesByKey.size() >= EQ_MOVE_TERRAIN_Z_CACHE_MAX_ENTRIES)
+    {
+        zCache->PendingEvictions += zCache->PreviousEntriesByKey.size();
+        zCache->PendingEntryCountChange -= int64(zCache->PreviousEntriesByKey.size());
+        zCache->PreviousEntriesByKey.swap(zCache->CurrentEntriesByKey);
+        zCache->CurrentEntriesByKey.clear();
+    }
+    else if (zCache->PreviousEntriesByKey.erase(terrainZKey) != 0)
+        zCache->PendingEntryCountChange--;
+    zCache->CurrentEntriesByKey.emplace(terrainZKey, entry);
+    zCache->PendingEntryCountChange++;
+}
+
+void EverQuestMod::ClearCachedTerrainZForMap(Map* map)
+{
+    EverQuestTerrainZMapCache* zCache = map->CustomData.Get<EverQuestTerrainZMapCache>(EQ_MAP_CUSTOMDATA_TERRAINZCACHE);
+    if (zCache == nullptr)
+        return;
+    zCache->PendingEntryCountChange -= int64(zCache->CurrentEntriesByKey.size() + zCache->PreviousEntriesByKey.size());
+    FlushTerrainZCacheStats(*zCache);
+    map->CustomData.Erase(EQ_MAP_CUSTOMDATA_TERRAINZCACHE);
+}
+
+EverQuestTerrainZCacheStats EverQuestMod::GetTerrainZCacheStats()
+{
+    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+    RollTerrainZCacheStatsMinute(TerrainZCacheStats);
+    return TerrainZCacheStats;
+}
+
+bool EverQuestMod::GetTerrainLiquidLevel(Creature* creature, float x, float y, float z, float& liquidLevelOut)
+{
+    EverQuestTerrainZCacheLookup lookup;
+    lookup.CellX = GetTerrainZCacheCell(x);
+    lookup.CellY = GetTerrainZCacheCell(y);
+    lookup.CellZ = GetTerrainZCacheCell(z);
+    lookup.PhaseMask = creature->GetPhaseMask();
+    lookup.Kind = EQ_MOVE_TERRAIN_Z_CACHE_KIND_LIQUID;
+    uint64 terrainZKey = MakeTerrainZCacheKey(lookup);
+    EverQuestTerrainZCacheEntry entry;
+    if (TryGetCachedTerrainZ(creature->GetMap(), terrainZKey, lookup, entry) == true)
+    {
+        liquidLevelOut = entry.Z;
+        return entry.Found;
+    }
+
+    LiquidData liquidData = creature->GetMap()->GetLiquidData(creature->GetPhaseMask(), GetTerrainZCacheCellCenter(lookup.CellX), GetTerrainZCacheCellCenter(lookup.CellY),
+        GetTerrainZCacheCellCenter(lookup.CellZ), 0, {});
+    entry.Lookup = lookup;
+    entry.Found = liquidData.Status != LIQUID_MAP_NO_WATER;
+    entry.Z = liquidData.Level;
+    entry.HeightQueryCount = 1;
+    StoreCachedTerrainZ(creature->GetMap(), terrainZKey, entry);
+    liquidLevelOut = entry.Z;
+    return entry.Found;
+}
+
+float EverQuestMod::GetTerrainFloorZ(Creature* creature, float x, float y, float z, bool isPriorPointInWater, float minZ, float maxZ)
+{
+    bool isInRoamBand = (minZ != 0 && maxZ != 0);
+    EverQuestTerrainZCacheLookup lookup;
+    lookup.CellX = GetTerrainZCacheCell(x);
+    lookup.CellY = GetTerrainZCacheCell(y);
+    lookup.CollisionHeight = creature->GetCollisionHeight();
+    lookup.PhaseMask = creature->GetPhaseMask();
+    lookup.Kind = EQ_MOVE_TERRAIN_Z_CACHE_KIND_FLOOR_FROM_DRY;
+    if (isInRoamBand == true)
+        lookup.Kind = EQ_MOVE_TERRAIN_Z_CACHE_KIND_FLOOR_IN_BAND;
+    else if (isPriorPointInWater == true)
+        lookup.Kind = EQ_MOVE_TERRAIN_Z_CACHE_KIND_FLOOR_FROM_WET;
+
+    // A band search always starts from the band's top, so that stands in for the target height in the key
+    lookup.CellZ = GetTerrainZCacheCell(isInRoamBand == true ? maxZ : z);
+    lookup.BandHeight = isInRoamBand == true ? maxZ - minZ : 0;
+    uint64 terrainZKey = MakeTerrainZCacheKey(lookup);
+    EverQuestTerrainZCacheEntry entry;
+    if (TryGetCachedTerrainZ(creature->GetMap(), terrainZKey, lookup, entry) == true)
+        return entry.Z;
+
+    float cellX = GetTerrainZCacheCellCenter(lookup.CellX);
+    float cellY = GetTerrainZCacheCellCenter(lookup.CellY);
+    float cellZ = GetTerrainZCacheCellCenter(lookup.CellZ);
+    float solidFloorZ = -20001;
+    if (isInRoamBand == true)
+    {
+        solidFloorZ = creature->GetMapHeight(cellX, cellY, cellZ, true, lookup.BandHeight);
+        entry.HeightQueryCount = 1;
+    }
+    else
+    {
+        float targetTestZ = cellZ;
+        int floorLoopNum = 0;
+        float curAddedZStep = 0;
+        if (isPriorPointInWater == false)
+            curAddedZStep = 1.0f;
+        while (solidFloorZ < -20000)
+        {
+            targetTestZ = cellZ + (floorLoopNum * curAddedZStep);
+            curAddedZStep += 1.0f;
+            float floorSearchDist = floorLoopNum * 20.0f;
+            if (floorSearchDist > 0.0f)
+            {
+                solidFloorZ = creature->GetMapHeight(cellX, cellY, targetTestZ, true, floorSearchDist);
+                entry.HeightQueryCount++;
+            }
+            floorLoopNum++;
+            if (floorLoopNum >= 10)
+                break;
+        }
+    }
+
+    entry.Lookup = lookup;
+    entry.Z = solidFloorZ;
+    StoreCachedTerrainZ(creature->GetMap(), terrainZKey, entry);
+    return solidFloorZ;
+}
+
+// Shared by the creature instance AI and the waypoint leg bake, so a baked leg is exactly what the AI would have built
+float EverQuestMod::GetEffectiveDestinationZForCreature(Creature* creature, bool disableGroundContour, float priorX, float priorY, float priorZ, float initialTargetX, float initialTargetY,
+    float initialTargetZ, bool& foundValidZ, float minZ, float maxZ)
+{
+    if (disableGroundContour == true)
+    {
+        foundValidZ = true;
+        return initialTargetZ;
+    }
+    
+    foundValidZ = false;
+
+    // Prior point might be in water
+    bool isPriorPointInWater = false;
+    float liquidLevel = 0;
+    if (priorX != 0 && priorY != 0 && priorZ != 0)
+        isPriorPointInWater = GetTerrainLiquidLevel(creature, priorX, priorY, priorZ, liquidLevel);
+
+    // Calculate a solid floor
+    float solidFloorZ = GetTerrainFloorZ(creature, initialTargetX, initialTargetY, initialTargetZ, isPriorPointInWater, minZ, maxZ);
+
+    if (solidFloorZ < -20000)
+    {
+        // No solid floor means it's out of bounds or over a large body of water, so first test if it's a body of water
+        if (GetTerrainLiquidLevel(creature, initialTargetX, initialTargetY, initialTargetZ - EQ_MOVE_TEST_Z_DOWN_AMOUNT_FOR_WATER_TEST, liquidLevel) == true)
+        {
+            foundValidZ = true;
+            if (isPriorPointInWater == true && priorZ <= (liquidLevel - EQ_MOVE_UNDER_WATER_SURFACE_SKIM_REDICTION))
+                return priorZ;
+            else
+                return liquidLevel - EQ_MOVE_UNDER_WATER_SURFACE_SKIM_REDICTION;
+        }
+        else
+            return initialTargetZ;
+    }
+    else
+    {
+        foundValidZ = true;
+        if (isPriorPointInWater == true)
+        {
+            if (GetTerrainLiquidLevel(creature, initialTargetX, initialTargetY, initialTargetZ, liquidLevel) == true)
+            {
+                float skimLevel = liquidLevel - EQ_MOVE_UNDER_WATER_SURFACE_SKIM_REDICTION;
+                if (solidFloorZ > priorZ || solidFloorZ > skimLevel)
+                    return solidFloorZ;
+                else if (priorZ > skimLevel)
+                    return skimLevel;
+                else
+                    return priorZ;
+            }
+        }
+        return solidFloorZ;
+    }
+}
+
+bool EverQuestMod::BuildSnappedPathForCreature(Creature* creature, const EverQuestCreatureInstance& instanceData, bool isRoaming, const Position& startPosition, float initialTargetX,
+    float initialTargetY, float initialTargetZ, Movement::PointsArray& waypointPath, float& terrainSnappedTargetZ, bool* navmeshPathFoundOut)
+{
+    bool foundValidZ = false;
+    terrainSnappedTargetZ = GetEffectiveDestinationZForCreature(creature, instanceData.DisableGroundContour, 0, 0, 0, initialTargetX, initialTargetY, initialTargetZ, foundValidZ,
+        instanceData.RoamMinZ, instanceData.RoamMaxZ);
+
+    // Generate a base path to make sure it exists
+    PathGenerator path(creature);
+    bool result = path.CalculatePath(startPosition.GetPositionX(), startPosition.GetPositionY(), startPosition.GetPositionZ(), initialTargetX, initialTargetY, initialTargetZ, false);
+    PathType pathType = path.GetPathType();
+    bool pathFound = ((result == true) && ((pathType & PATHFIND_NOPATH) == 0));
+    Movement::PointsArray fallbackPath;
+    const Movement::PointsArray* pathNodesPtr = &path.GetPath();
+
+    // If there is no single spline-based path, it was probably too long so break it into parts
+    if (pathFound == false)
+    {
+        float distToTarget = startPosition.GetExactDist(initialTargetX, initialTargetY, terrainSnappedTargetZ);
+        if (distToTarget > 30.0f)
+        {
+            const float MAX_SAFE_SEGMENT = 220.0f;
+
+            Position current = startPosition;
+            float dx = initialTargetX - current.GetPositionX();
+            float dy = initialTargetY - current.GetPositionY();
+            float dz = terrainSnappedTargetZ - current.GetPositionZ();
+            float dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+            if (dist > 5.0f)
+            {
+                float ratio = std::min(1.0f, MAX_SAFE_SEGMENT / dist);
+                float interX = current.GetPositionX() + dx * ratio;
+                float interY = current.GetPositionY() + dy * ratio;
+                float interZ = current.GetPositionZ() + dz * ratio;
+
+                PathGenerator shortPath(creature);
+                bool shortResult = shortPath.CalculatePath(current.GetPositionX(), current.GetPositionY(), current.GetPositionZ(), interX, interY, interZ, false);
+                if (shortResult && (shortPath.GetPathType() & PATHFIND_NOPATH) == 0)
+                {
+                    fallbackPath = shortPath.GetPath();
+                    if (fallbackPath.size() >= 2)
+                    {
+                        pathNodesPtr = &fallbackPath;
+                        pathFound = true;
+                    }
+                }
+            }
+        }
+    }
+
+    if (navmeshPathFoundOut != nullptr)
+        *navmeshPathFoundOut = pathFound;
+    if (pathFound == false && foundValidZ == false && isRoaming == true)
+        return false;
+
+    const Movement::PointsArray& pathNodes = *pathNodesPtr;
+    if (pathNodes.size() < 2)
+        return false;
+
+    // Walk the path to generate steps that are small enough to snap the character to the Z
+    waypointPath.clear();
+    waypointPath.emplace_back(startPosition.GetPositionX(), startPosition.GetPositionY(), startPosition.GetPositionZ());
+    Position previousPosition = startPosition;
+    float priorInterimZ = -100001.0f;
+    for (int cornerIndex = 1; cornerIndex < (int)pathNodes.size(); ++cornerIndex)
+    {
+        Position corner(pathNodes[cornerIndex].x, pathNodes[cornerIndex].y, pathNodes[cornerIndex].z);
+        bool isFinalCorner = (cornerIndex == (int)pathNodes.size() - 1);
+
+        float segDX = corner.GetPositionX() - previousPosition.GetPositionX();
+        float segDY = corner.GetPositionY() - previousPosition.GetPositionY();
+        float segDZ = corner.GetPositionZ() - previousPosition.GetPositionZ();
+        float segLength = std::sqrt(segDX * segDX + segDY * segDY + segDZ * segDZ);
+
+        if (segLength < 0.001f)
+            continue;
+
+        float ux = segDX / segLength;
+        float uy = segDY / segLength;
+        float uz = segDZ / segLength;
+
+        float endThreshold = isFinalCorner ? EQ_MOVE_SMALL_STEP_SIZE_LAST_DISTANCE : EQ_MOVE_SMALL_STEP_SIZE_DISTANCE;
+        float remainingDistance = segLength;
+
+        bool nodeCapReached = false;
+        while (remainingDistance > endThreshold)
+        {
+            // Prevent oversizing paths
+            if (waypointPath.size() >= EQ_MOVE_MAX_PATH_NODES)
+            {
+                nodeCapReached = true;
+                break;
+            }
+
+            float interimX = previousPosition.GetPositionX() + ux * EQ_MOVE_SMALL_STEP_SIZE_DISTANCE;
+            float interimY = previousPosition.GetPositionY() + uy * EQ_MOVE_SMALL_STEP_SIZE_DISTANCE;
+            float interimZ = previousPosition.GetPositionZ() + uz * EQ_MOVE_SMALL_STEP_SIZE_DISTANCE;
+
+            if (priorInterimZ < -100000)
+                priorInterimZ = interimZ;
+
+            interimZ = GetEffectiveDestinationZForCreature(creature, instanceData.DisableGroundContour, previousPosition.GetPositionX(), previousPosition.GetPositionY(),
+                previousPosition.GetPositionZ(), interimX, interimY, priorInterimZ, foundValidZ,
+                instanceData.RoamMinZ, instanceData.RoamMaxZ);
+
+            waypointPath.emplace_back(interimX, interimY, interimZ);
+            previousPosition = Position(interimX, interimY, interimZ);
+            remainingDistance -= EQ_MOVE_SMALL_STEP_SIZE_DISTANCE;
+            priorInterimZ = interimZ;
+        }
+
+        // When cap is hit, stop at the last interim node instead of an unsnapped one
+        if (nodeCapReached)
+            break;
+
+        // Add corner
+        float refZ = (priorInterimZ < -100000.0f) ? corner.GetPositionZ() : priorInterimZ;
+        float cornerZ = GetEffectiveDestinationZForCreature(creature, instanceData.DisableGroundContour, previousPosition.GetPositionX(), previousPosition.GetPositionY(),
+            previousPosition.GetPositionZ(), corner.GetPositionX(), corner.GetPositionY(), refZ,
+            foundValidZ, instanceData.RoamMinZ, instanceData.RoamMaxZ);
+
+        waypointPath.emplace_back(corner.GetPositionX(), corner.GetPositionY(), cornerZ);
+        previousPosition = Position(corner.GetPositionX(), corner.GetPositionY(), cornerZ);
+        priorInterimZ = cornerZ;
+    }
+
+    // Add for saftey, though this shouldn't happen...
+    if (waypointPath.size() <= 1)
+        waypointPath.emplace_back(initialTargetX, initialTargetY, terrainSnappedTargetZ);
+    return true;
+}
+
+void EverQuestMod::LoadForageData(EverQuestWorldData& worldData)
+{
+    worldData.ForageZoneItemsByMapID.clear();
+    worldData.ForageZoneItemTotalChanceByMapID.clear();
+
+    QueryResult queryResult = WorldDatabase.Query("SELECT MapID, ItemTemplateID, Chance, ForageType FROM mod_everquest_forage_zone_items;");
+    if (queryResult)
+    {
+        do
+        {
+            Field* fields = queryResult->Fetch();
+            EverQuestForageZoneItem forageZoneItem;
+            forageZoneItem.MapID = fields[0].Get<uint32>();
+            forageZoneItem.ItemTemplateID = fields[1].Get<uint32>();
+            forageZoneItem.Chance = fields[2].Get<uint32>();
+            forageZoneItem.ForageType = fields[3].Get<uint32>();
+            worldData.ForageZoneItemsByMapID[forageZoneItem.MapID].push_back(forageZoneItem);
+            worldData.ForageZoneItemTotalChanceByMapID[forageZoneItem.MapID] += forageZoneItem.Chance;
+        } while (queryResult->NextRow());
+    }
+}
+
+const vector<EverQuestForageZoneItem>& EverQuestMod::GetForageZoneItemsInMap(uint32 mapID)
+{
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.ForageZoneItemsByMapID.find(mapID) != worldData.ForageZoneItemsByMapID.end())
+    {
+        return worldData.ForageZoneItemsByMapID.at(mapID);
+    }
+    else
+    {
+        static const vector<EverQuestForageZoneItem> returnEmpty;
+        return returnEmpty;
+    }
+}
+
+void EverQuestMod::LoadZoneSafePointData(EverQuestWorldData& worldData)
+{
+    worldData.ZoneSafePointByMapID.clear();
+
+    QueryResult queryResult = WorldDatabase.Query("SELECT MapID, X, Y, Z, Orientation FROM mod_everquest_zone_safe_point;");
+    if (queryResult)
+    {
+        do
+        {
+            Field* fields = queryResult->Fetch();
+            EverQuestZoneSafePoint zoneSafePoint;
+            zoneSafePoint.MapID = fields[0].Get<uint32>();
+            zoneSafePoint.X = fields[1].Get<float>();
+            zoneSafePoint.Y = fields[2].Get<float>();
+            zoneSafePoint.Z = fields[3].Get<float>();
+            zoneSafePoint.Orientation = fields[4].Get<float>();
+            worldData.ZoneSafePointByMapID[zoneSafePoint.MapID] = zoneSafePoint;
+        } while (queryResult->NextRow());
+    }
+}
+
+void EverQuestMod::LoadZoneData(EverQuestWorldData& worldData)
+{
+    worldData.ZoneByMapID.clear();
+    worldData.InstanceRaidLowMapIDs.clear();
+    worldData.OpenWorldMapIDByInstanceRaidLowMapID.clear();
+
+    QueryResult queryResult = WorldDatabase.Query("SELECT MapID, AllowBind, ExpansionID, MaxAgroZDistance, InstanceRaidLowMapID FROM mod_everquest_zone;");
+    if (queryResult)
+    {
+        do
+        {
+            Field* fields = queryResult->Fetch();
+            EverQuestZone zone;
+            zone.MapID = fields[0].Get<uint32>();
+            zone.AllowBind = fields[1].Get<uint8>() != 0;
+            zone.ExpansionID = fields[2].Get<int32>();
+            zone.MaxAgroZDistance = fields[3].Get<float>();
+            zone.InstanceRaidLowMapID = fields[4].Get<uint32>();
+            worldData.ZoneByMapID[zone.MapID] = zone;
+            if (zone.InstanceRaidLowMapID != 0)
+            {
+                worldData.InstanceRaidLowMapIDs.insert(zone.InstanceRaidLowMapID);
+                worldData.OpenWorldMapIDByInstanceRaidLowMapID[zone.InstanceRaidLowMapID] = zone.MapID;
+            }
+        } while (queryResult->NextRow());
+    }
+}
+
+bool EverQuestMod::IsBindAllowedForMap(uint32 mapID)
+{
+    const EverQuestWorldData& worldData = GetWorldData();
+
+    // Any zone missing from the zone data is considered bind-restricted
+    auto zoneIt = worldData.ZoneByMapID.find(mapID);
+    if (zoneIt == worldData.ZoneByMapID.end())
+        return false;
+    return zoneIt->second.AllowBind;
+}
+
+float EverQuestMod::GetMaxAgroZDistanceForMap(uint32 mapID)
+{
+    const EverQuestWorldData& worldData = GetWorldData();
+    auto zoneIt = worldData.ZoneByMapID.find(mapID);
+    if (zoneIt == worldData.ZoneByMapID.end())
+        return -1.0f;
+    return zoneIt->second.MaxAgroZDistance;
+}
+
+uint32 EverQuestMod::GetInstanceRaidLowMapIDForMap(uint32 mapID)
+{
+    const EverQuestWorldData& worldData = GetWorldData();
+    auto zoneIt = worldData.ZoneByMapID.find(mapID);
+    if (zoneIt == worldData.ZoneByMapID.end())
+        return 0;
+    return zoneIt->second.InstanceRaidLowMapID;
+}
+
+bool EverQuestMod::IsMapInstanceRaidLow(uint32 mapID)
+{
+    const EverQuestWorldData& worldData = GetWorldData();
+    return worldData.InstanceRaidLowMapIDs.find(mapID) != worldData.InstanceRaidLowMapIDs.end();
+}
+
+uint32 EverQuestMod::GetOpenWorldMapIDForMapID(uint32 mapID)
+{
+    const EverQuestWorldData& worldData = GetWorldData();
+
+    // Any data rows keyed by a map ID (kill spawns, forage) are only generated for the open world copy so instanced copies resolve back to the open version
+    auto openWorldMapIDIt = worldData.OpenWorldMapIDByInstanceRaidLowMapID.find(mapID);
+    if (openWorldMapIDIt == worldData.OpenWorldMapIDByInstanceRaidLowMapID.end())
+        return mapID;
+    return openWorldMapIDIt->second;
+}
+
+void EverQuestMod::UpdateRaidLowInstanceStateForPlayer(Player* player)
+{
+    if (player == nullptr)
+        return;
+
+    uint32 mapID = player->GetMapId();
+    uint32 instanceID = player->GetInstanceId();
+    bool isInsideRaidLowInstance = (instanceID != 0 && IsMapInstanceRaidLow(mapID) == true);
+
+    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+    if (isInsideRaidLowInstance == true)
+    {
+        EverQuestPlayerRaidLowInstanceState& raidLowInstanceState = RaidLowInstanceStateByPlayerGUID[player->GetGUID()];
+        raidLowInstanceState.RaidLowMapID = mapID;
+        raidLowInstanceState.InstanceID = instanceID;
+        raidLowInstanceState.IsInside = true;
+        return;
+    }
+
+    // Which instance was left is remembered, since that's what a zone line back into the zone needs to route to
+    auto raidLowInstanceStateIt = RaidLowInstanceStateByPlayerGUID.find(player->GetGUID());
+    if (raidLowInstanceStateIt != RaidLowInstanceStateByPlayerGUID.end())
+        raidLowInstanceStateIt->second.IsInside = false;
+}
+
+void EverQuestMod::ClearRaidLowInstanceStateForPlayer(ObjectGuid playerGUID)
+{
+    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+    RaidLowInstanceStateByPlayerGUID.erase(playerGUID);
+}
+
+// True when the player's own last raid instance for this map still has somebody else standing in it
+bool EverQuestMod::HasOccupiedRaidLowInstanceForMap(ObjectGuid playerGUID, uint32 raidLowMapID)
+{
+    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+    auto raidLowInstanceStateIt = RaidLowInstanceStateByPlayerGUID.find(playerGUID);
+    if (raidLowInstanceStateIt == RaidLowInstanceStateByPlayerGUID.end())
+        return false;
+    if (raidLowInstanceStateIt->second.RaidLowMapID != raidLowMapID || raidLowInstanceStateIt->second.InstanceID == 0)
+        return false;
+
+    uint32 instanceID = raidLowInstanceStateIt->second.InstanceID;
+    for (auto const& raidLowInstanceStateByPlayerGUID : RaidLowInstanceStateByPlayerGUID)
     {
         if (raidLowInstanceStateByPlayerGUID.first == playerGUID)
             continue;
@@ -5969,13 +7887,15 @@ bool EverQuestMod::IsBlockedByAgroZDistance(WorldObject const* source, WorldObje
 
 bool EverQuestMod::IsMapRestrictedByExpansion(uint32 mapID)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
+
     // A negative maximum disables the restriction entirely
     if (ConfigMapMaxExpansionID < 0)
         return false;
 
     // Only EverQuest zones carry an expansion, so anything else (like Azeroth) is left to other rules
-    auto zoneIt = ZoneByMapID.find(mapID);
-    if (zoneIt == ZoneByMapID.end())
+    auto zoneIt = worldData.ZoneByMapID.find(mapID);
+    if (zoneIt == worldData.ZoneByMapID.end())
         return false;
 
     return zoneIt->second.ExpansionID > ConfigMapMaxExpansionID;
@@ -6147,10 +8067,10 @@ void EverQuestMod::ClearClientVersionCheckForPlayer(ObjectGuid playerGUID)
     PendingClientVersionChecksByPlayerGUID.erase(playerGUID);
 }
 
-void EverQuestMod::LoadFactionData()
+void EverQuestMod::LoadFactionData(EverQuestWorldData& worldData)
 {
-    FactionsByFactionTemplateID.clear();
-    DefendCombatFactionTemplateIDs.clear();
+    worldData.FactionsByFactionTemplateID.clear();
+    worldData.DefendCombatFactionTemplateIDs.clear();
 
     QueryResult queryResult = WorldDatabase.Query("SELECT FactionTemplateID, FactionID, BaseAlignment, PredominantEQRaceID, WillDefendFriendlyPlayers, DefendersWillAttackToDefendPlayer, DefendCombatFactionTemplateID FROM mod_everquest_faction;");
     if (queryResult)
@@ -6166,16 +8086,16 @@ void EverQuestMod::LoadFactionData()
             faction.WillDefendFriendlyPlayers = fields[4].Get<uint8>() != 0;
             faction.DefendersWillAttackToDefendPlayer = fields[5].Get<uint8>() != 0;
             faction.DefendCombatFactionTemplateID = fields[6].Get<uint32>();
-            FactionsByFactionTemplateID[faction.FactionTemplateID] = faction;
+            worldData.FactionsByFactionTemplateID[faction.FactionTemplateID] = faction;
         } while (queryResult->NextRow());
     }
 }
 
 // Note: Runs at world startup (OnStartup) since the DBC stores aren't loaded when LoadFactionData loads with the config
-void EverQuestMod::ResolveDefendCombatFactionTemplates()
+void EverQuestMod::ResolveDefendCombatFactionTemplates(EverQuestWorldData& worldData)
 {
     // Defend combat templates only work if the deployed FactionTemplate.dbc contains them
-    for (auto& factionPair : FactionsByFactionTemplateID)
+    for (auto& factionPair : worldData.FactionsByFactionTemplateID)
     {
         EverQuestFaction& faction = factionPair.second;
         if (faction.DefendCombatFactionTemplateID != 0 && sFactionTemplateStore.LookupEntry(faction.DefendCombatFactionTemplateID) == nullptr)
@@ -6187,24 +8107,24 @@ void EverQuestMod::ResolveDefendCombatFactionTemplates()
 
     // Register the combat versions under their own IDs too
     vector<EverQuestFaction> combatVariantFactions;
-    for (auto& factionPair : FactionsByFactionTemplateID)
+    for (auto& factionPair : worldData.FactionsByFactionTemplateID)
     {
         if (factionPair.second.DefendCombatFactionTemplateID == 0)
             continue;
-        DefendCombatFactionTemplateIDs.insert(factionPair.second.DefendCombatFactionTemplateID);
+        worldData.DefendCombatFactionTemplateIDs.insert(factionPair.second.DefendCombatFactionTemplateID);
         EverQuestFaction combatVariantFaction = factionPair.second;
         combatVariantFaction.FactionTemplateID = factionPair.second.DefendCombatFactionTemplateID;
         combatVariantFactions.push_back(combatVariantFaction);
     }
     for (EverQuestFaction& combatVariantFaction : combatVariantFactions)
-        FactionsByFactionTemplateID[combatVariantFaction.FactionTemplateID] = combatVariantFaction;
+        worldData.FactionsByFactionTemplateID[combatVariantFaction.FactionTemplateID] = combatVariantFaction;
 }
 
 // Note: Runs at world startup (OnStartup) since the DBC stores aren't loaded when LoadFactionData loads with the config
-void EverQuestMod::ResolveEQReputationFactions()
+void EverQuestMod::ResolveEQReputationFactions(EverQuestWorldData& worldData)
 {
-    EQReputationFactionInfoByFactionID.clear();
-    for (auto& factionPair : FactionsByFactionTemplateID)
+    worldData.EQReputationFactionInfoByFactionID.clear();
+    for (auto& factionPair : worldData.FactionsByFactionTemplateID)
     {
         uint32 factionID = factionPair.second.FactionID;
         if (factionID == 0)
@@ -6215,12 +8135,13 @@ void EverQuestMod::ResolveEQReputationFactions()
         EverQuestReputationFactionInfo factionInfo;
         factionInfo.BaseAlignment = factionPair.second.BaseAlignment;
         factionInfo.PredominantEQRaceID = factionPair.second.PredominantEQRaceID;
-        EQReputationFactionInfoByFactionID[factionID] = factionInfo;
+        worldData.EQReputationFactionInfoByFactionID[factionID] = factionInfo;
     }
 }
 
 void EverQuestMod::HandleModFactionAuraApplyOnCreature(Creature* creature, Aura* aura)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
     if (creature == nullptr || aura == nullptr)
         return;
     int32 modFactionRepValue = GetSpellDataForSpellID(aura->GetId()).ModFactionRepValue;
@@ -6232,8 +8153,8 @@ void EverQuestMod::HandleModFactionAuraApplyOnCreature(Creature* creature, Aura*
     Player* casterPlayer = casterUnit->ToPlayer();
 
     // The creature's faction has to be a reputation faction, which mirrors EQ requiring the target to have a primary faction
-    auto factionIter = FactionsByFactionTemplateID.find(creature->GetFaction());
-    if (factionIter == FactionsByFactionTemplateID.end() || EQReputationFactionInfoByFactionID.find(factionIter->second.FactionID) == EQReputationFactionInfoByFactionID.end())
+    auto factionIter = worldData.FactionsByFactionTemplateID.find(creature->GetFaction());
+    if (factionIter == worldData.FactionsByFactionTemplateID.end() || worldData.EQReputationFactionInfoByFactionID.find(factionIter->second.FactionID) == worldData.EQReputationFactionInfoByFactionID.end())
     {
         creature->RemoveAura(aura);
         ChatHandler(casterPlayer->GetSession()).PSendSysMessage("Your spell would have no effect on that target.");
@@ -6297,6 +8218,7 @@ void EverQuestMod::HandleModFactionAuraRemoveFromCreature(Creature* creature, Au
 
 void EverQuestMod::RecalculateTemporaryFactionReactionsForPlayer(Player* player)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
     if (player == nullptr || player->GetSession() == nullptr)
         return;
 
@@ -6339,7 +8261,7 @@ void EverQuestMod::RecalculateTemporaryFactionReactionsForPlayer(Player* player)
     // Force a reaction on every faction where the adjustments land in a different band than the real standing
     ReputationMgr& reputationMgr = player->GetReputationMgr();
     vector<uint32> newForcedFactionIDs;
-    for (auto& factionInfoPair : EQReputationFactionInfoByFactionID)
+    for (auto& factionInfoPair : worldData.EQReputationFactionInfoByFactionID)
     {
         uint32 factionID = factionInfoPair.first;
         const EverQuestReputationFactionInfo& factionInfo = factionInfoPair.second;
@@ -6542,81 +8464,196 @@ bool EverQuestMod::IsPlayerFriendlyWithCreatureByReputation(Creature* creature,
     return player->GetReputationMgr().GetRank(factionEntry) >= REP_FRIENDLY;
 }
 
-void EverQuestMod::DoDefendFriendlyPlayersSearch(Creature* attacker, Player* attackedPlayer)
+// Threatened players are bucketed at the search radius, so any player in range of a defender is in the defender's own bucket or one of its eight neighbours
+static uint64 GetDefendBucketKey(float x, float y)
+{
+    int32 bucketX = int32(std::floor(x / EQ_DEFEND_PLAYERS_SEARCH_RADIUS));
+    int32 bucketY = int32(std::floor(y / EQ_DEFEND_PLAYERS_SEARCH_RADIUS));
+    return (uint64(uint32(bucketX)) << 32) | uint64(uint32(bucketY));
+}
+
+void EverQuestMod::UpdateDefendBrokerForMap(Map* map)
 {
     if (ConfigFactionDefendFriendlyPlayersEnabled == false)
         return;
-    if (attacker == nullptr || attackedPlayer == nullptr)
+
+    // No broker means no attacker on this map has a player to be defended from
+    EverQuestDefendMapBroker* broker = map->CustomData.Get<EverQuestDefendMapBroker>(EQ_MAP_CUSTOMDATA_DEFENDBROKER);
+    if (broker == nullptr)
+        return;
+    uint64 nowMS = uint64(GameTime::GetGameTimeMS().count());
+    bool sweepAll = nowMS < broker->LastSweepMSTime || nowMS - broker->LastSweepMSTime >= EQ_DEFEND_PLAYERS_CHECK_MS;
+    if (sweepAll == false && broker->NewAttackerGUIDs.empty() == true)
         return;
+    vector<pair<ObjectGuid, ObjectGuid>> attackerAndPlayerGUIDs;
+    if (sweepAll == true)
+    {
+        broker->LastSweepMSTime = nowMS;
+        attackerAndPlayerGUIDs.assign(broker->AttackedPlayerGUIDByAttackerGUID.begin(), broker->AttackedPlayerGUIDByAttackerGUID.end());
+    }
+    else
+    {
+        for (ObjectGuid attackerGUID : broker->NewAttackerGUIDs)
+        {
+            auto attackerIter = broker->AttackedPlayerGUIDByAttackerGUID.find(attackerGUID);
+            if (attackerIter != broker->AttackedPlayerGUIDByAttackerGUID.end())
+                attackerAndPlayerGUIDs.push_back(*attackerIter);
+        }
+    }
+    broker->NewAttackerGUIDs.clear();
 
-    // The zone's vertical agro limit applies to defenders too, since this is agro like any other
-    float maxAgroZDistance = -1.0f;
-    uint32 mapID = attackedPlayer->GetMapId();
-    if (mapID >= ConfigSystemMapDBCIDMin && mapID <= ConfigSystemMapDBCIDMax)
-        maxAgroZDistance = GetMaxAgroZDistanceForMap(mapID);
+    // Engaging runs AI and script hooks that can register or drop attackers, so the sweep works from the copied fights
+    DoDefendFriendlyPlayersSearch(map, attackerAndPlayerGUIDs);
+}
 
-    std::list<Creature*> nearbyCreatures;
-    Acore::AnyUnitInObjectRangeCheck check(attackedPlayer, EQ_DEFEND_PLAYERS_SEARCH_RADIUS);
-    Acore::CreatureListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(attackedPlayer, nearbyCreatures, check);
-    Cell::VisitObjects(attackedPlayer, searcher, EQ_DEFEND_PLAYERS_SEARCH_RADIUS);
+bool EverQuestMod::IsDefendCandidateFriendlyToDefender(Creature* defender, uint32 defenderFactionTemplateID, EverQuestDefendCandidate& candidate)
+{
+    // Guards of one faction all get the same answer for a player, so it's only worked out once per faction per sweep
+    auto friendlyIter = candidate.IsFriendlyByDefenderFactionTemplateID.find(defenderFactionTemplateID);
+    if (friendlyIter != candidate.IsFriendlyByDefenderFactionTemplateID.end())
+        return friendlyIter->second;
+    bool isFriendly = defender->GetReactionTo(candidate.AttackedPlayer) >= REP_FRIENDLY || IsPlayerFriendlyWithCreatureByReputation(defender, candidate.AttackedPlayer) == true;
+    candidate.IsFriendlyByDefenderFactionTemplateID[defenderFactionTemplateID] = isFriendly;
+    return isFriendly;
+}
 
-    for (Creature* defender : nearbyCreatures)
-    {
-        if (defender == attacker)
-            continue;
+void EverQuestMod::DoDefendFriendlyPlayersSearch(Map* map, vector<pair<ObjectGuid, ObjectGuid>> const& attackerAndPlayerGUIDs)
+{
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (attackerAndPlayerGUIDs.empty() == true)
+        return;
 
-        // Both ends of the fight are checked, as the defender has to be able to reach the player it is coming to help as well as the attacker it would be engaging
-        if (IsBlockedByAgroZDistance(defender, attackedPlayer, maxAgroZDistance) == true)
-            continue;
-        if (IsBlockedByAgroZDistance(defender, attacker, maxAgroZDistance) == true)
-            continue;
-        auto factionIter = FactionsByFactionTemplateID.find(defender->GetFaction());
-        if (factionIter == FactionsByFactionTemplateID.end() || factionIter->second.WillDefendFriendlyPlayers == false)
-            continue;
-        if (defender->IsPet() == true || defender->IsControlledByPlayer() == true)
-            continue;
-        if (defender->GetReactionTo(attackedPlayer) < REP_FRIENDLY && IsPlayerFriendlyWithCreatureByReputation(defender, attackedPlayer) == false)
+    // Group the fights by the player being attacked, so a whole train on one player is a single candidate
+    unordered_map<ObjectGuid, EverQuestDefendCandidate> candidatesByPlayerGUID;
+    for (auto const& attackerAndPlayerGUID : attackerAndPlayerGUIDs)
+    {
+        Creature* attacker = map->GetCreature(attackerAndPlayerGUID.first);
+        if (attacker == nullptr || attacker->IsAlive() == false)
             continue;
-        if (defender->IsInCombatWith(attacker) == true)
+        Unit* victim = attacker->GetVictim();
+        if (victim == nullptr || victim->GetGUID() != attackerAndPlayerGUID.second || victim->IsAlive() == false || victim->ToPlayer() == nullptr)
             continue;
-        if (defender->IsValidAttackTarget(attacker) == false)
+        EverQuestDefendCandidate& candidate = candidatesByPlayerGUID[attackerAndPlayerGUID.second];
+        candidate.AttackedPlayer = victim->ToPlayer();
+        candidate.Attackers.push_back(attacker);
+    }
+    if (candidatesByPlayerGUID.empty() == true)
+        return;
+    unordered_map<uint64, vector<EverQuestDefendCandidate*>> candidatesByBucketKey;
+    for (auto& candidateByPlayerGUID : candidatesByPlayerGUID)
+    {
+        Player* attackedPlayer = candidateByPlayerGUID.second.AttackedPlayer;
+        candidatesByBucketKey[GetDefendBucketKey(attackedPlayer->GetPositionX(), attackedPlayer->GetPositionY())].push_back(&candidateByPlayerGUID.second);
+    }
+
+    // The zone's vertical agro limit applies to defenders too, since this is agro like any other.  Maps with no EQ zone have no limit
+    float maxAgroZDistance = GetMaxAgroZDistanceForMap(map->GetId());
+
+    // One grid search per occupied bucket, and each defender found is handed only the candidates in its neighbouring buckets
+    unordered_set<ObjectGuid> visitedDefenderGUIDs;
+    vector<EverQuestDefendCandidate*> defendedCandidates;
+    for (auto const& bucketCandidates : candidatesByBucketKey)
+    {
+        Player* searchCenter = bucketCandidates.second.front()->AttackedPlayer;
+        std::list<Creature*> nearbyCreatures;
+        Acore::AnyUnitInObjectRangeCheck check(searchCenter, EQ_DEFEND_PLAYERS_BUCKET_SEARCH_RADIUS);
+        Acore::CreatureListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(searchCenter, nearbyCreatures, check);
+        Cell::VisitObjects(searchCenter, searcher, EQ_DEFEND_PLAYERS_BUCKET_SEARCH_RADIUS);
+
+        for (Creature* defender : nearbyCreatures)
         {
-            // Creature-vs-creature combat is only valid when the factions are hostile
-            uint32 defendCombatFactionTemplateID = factionIter->second.DefendCombatFactionTemplateID;
-            uint32 originalFactionTemplateID = defender->GetFaction();
-            if (defendCombatFactionTemplateID == 0 || originalFactionTemplateID == defendCombatFactionTemplateID)
+            if (visitedDefenderGUIDs.insert(defender->GetGUID()).second == false)
                 continue;
-            defender->SetFaction(defendCombatFactionTemplateID);
-            if (defender->IsValidAttackTarget(attacker) == false)
-            {
-                defender->SetFaction(originalFactionTemplateID);
+            uint32 defenderFactionTemplateID = defender->GetFaction();
+            auto factionIter = worldData.FactionsByFactionTemplateID.find(defenderFactionTemplateID);
+            if (factionIter == worldData.FactionsByFactionTemplateID.end() || factionIter->second.WillDefendFriendlyPlayers == false)
+                continue;
+            if (defender->IsPet() == true || defender->IsControlledByPlayer() == true)
                 continue;
+
+            // Settle who this defender will help before it engages anything, since engaging can swap its faction
+            defendedCandidates.clear();
+            uint64 defenderBucketKey = GetDefendBucketKey(defender->GetPositionX(), defender->GetPositionY());
+            int32 defenderBucketX = int32(defenderBucketKey >> 32);
+            int32 defenderBucketY = int32(uint32(defenderBucketKey));
+            for (int32 bucketX = defenderBucketX - 1; bucketX <= defenderBucketX + 1; ++bucketX)
+            {
+                for (int32 bucketY = defenderBucketY - 1; bucketY <= defenderBucketY + 1; ++bucketY)
+                {
+                    auto neighbourIter = candidatesByBucketKey.find((uint64(uint32(bucketX)) << 32) | uint64(uint32(bucketY)));
+                    if (neighbourIter == candidatesByBucketKey.end())
+                        continue;
+                    for (EverQuestDefendCandidate* candidate : neighbourIter->second)
+                    {
+                        if (defender->IsWithinDistInMap(candidate->AttackedPlayer, EQ_DEFEND_PLAYERS_SEARCH_RADIUS) == false)
+                            continue;
+                        if (IsBlockedByAgroZDistance(defender, candidate->AttackedPlayer, maxAgroZDistance) == true)
+                            continue;
+                        if (IsDefendCandidateFriendlyToDefender(defender, defenderFactionTemplateID, *candidate) == false)
+                            continue;
+                        defendedCandidates.push_back(candidate);
+                    }
+                }
+            }
+
+            for (EverQuestDefendCandidate* candidate : defendedCandidates)
+            {
+                for (Creature* attacker : candidate->Attackers)
+                {
+                    if (defender == attacker)
+                        continue;
+
+                    // The defender has to be able to reach the attacker it would be engaging as well as the player it is coming to help
+                    if (IsBlockedByAgroZDistance(defender, attacker, maxAgroZDistance) == true)
+                        continue;
+                    if (defender->IsInCombatWith(attacker) == true)
+                        continue;
+                    if (defender->IsValidAttackTarget(attacker) == false)
+                    {
+                        // Creature-vs-creature combat is only valid when the factions are hostile
+                        uint32 defendCombatFactionTemplateID = factionIter->second.DefendCombatFactionTemplateID;
+                        uint32 originalFactionTemplateID = defender->GetFaction();
+                        if (defendCombatFactionTemplateID == 0 || originalFactionTemplateID == defendCombatFactionTemplateID)
+                            continue;
+                        defender->SetFaction(defendCombatFactionTemplateID);
+                        if (defender->IsValidAttackTarget(attacker) == false)
+                        {
+                            defender->SetFaction(originalFactionTemplateID);
+                            continue;
+                        }
+                    }
+                    defender->EngageWithTarget(attacker);
+                }
             }
         }
-        defender->EngageWithTarget(attacker);
     }
 }
 
 void EverQuestMod::UpdateCreatureDefendFactionRestore(Creature* creature)
 {
-    if (DefendCombatFactionTemplateIDs.empty() == true)
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.DefendCombatFactionTemplateIDs.empty() == true)
         return;
     if (creature->IsInCombat() == true)
         return;
-    if (DefendCombatFactionTemplateIDs.find(creature->GetFaction()) == DefendCombatFactionTemplateIDs.end())
+    uint32 templateFactionTemplateID = creature->GetCreatureTemplate()->faction;
+    if (creature->GetFaction() == templateFactionTemplateID)
         return;
-    creature->SetFaction(creature->GetCreatureTemplate()->faction);
+    if (worldData.DefendCombatFactionTemplateIDs.find(creature->GetFaction()) == worldData.DefendCombatFactionTemplateIDs.end())
+        return;
+    creature->SetFaction(templateFactionTemplateID);
 }
 
-void EverQuestMod::UpdateCreatureDefendFriendlyPlayers(Creature* creature, uint32 diff)
+void EverQuestMod::UpdateCreatureDefendFriendlyPlayers(Creature* creature)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
     if (ConfigFactionDefendFriendlyPlayersEnabled == false)
         return;
-    if (creature == nullptr || FactionsByFactionTemplateID.empty() == true)
+    if (creature == nullptr || worldData.FactionsByFactionTemplateID.empty() == true)
         return;
 
-    auto factionIter = FactionsByFactionTemplateID.find(creature->GetFaction());
-    bool eligible = factionIter != FactionsByFactionTemplateID.end() && factionIter->second.DefendersWillAttackToDefendPlayer == true &&
+    auto factionIter = worldData.FactionsByFactionTemplateID.find(creature->GetFaction());
+    bool eligible = factionIter != worldData.FactionsByFactionTemplateID.end() && factionIter->second.DefendersWillAttackToDefendPlayer == true &&
         creature->IsAlive() == true && creature->IsInCombat() == true &&
         creature->IsPet() == false && creature->IsControlledByPlayer() == false;
     Player* attackedPlayer = nullptr;
@@ -6632,32 +8669,45 @@ void EverQuestMod::UpdateCreatureDefendFriendlyPlayers(Creature* creature, uint3
         return;
     }
 
+    // The map's defend broker answers the fight, so the attacker only has to tell it when its victim changes
     EverQuestCreatureDefendPlayerWatchState* state = creature->CustomData.GetDefault<EverQuestCreatureDefendPlayerWatchState>(EQ_CREATURE_CUSTOMDATA_DEFENDPLAYERWATCH);
-    if (state->RecheckTimerMS <= diff)
-    {
-        DoDefendFriendlyPlayersSearch(creature, attackedPlayer);
-        state->RecheckTimerMS = EQ_DEFEND_PLAYERS_CHECK_MS;
-    }
-    else
-        state->RecheckTimerMS -= diff;
+    if (state->RegisteredPlayerGUID == attackedPlayer->GetGUID())
+        return;
+    state->RegisteredPlayerGUID = attackedPlayer->GetGUID();
+    EverQuestDefendMapBroker* broker = creature->GetMap()->CustomData.GetDefault<EverQuestDefendMapBroker>(EQ_MAP_CUSTOMDATA_DEFENDBROKER);
+    broker->AttackedPlayerGUIDByAttackerGUID[creature->GetGUID()] = attackedPlayer->GetGUID();
+    broker->NewAttackerGUIDs.insert(creature->GetGUID());
 }
 
 void EverQuestMod::RemoveCreatureDefendPlayerWatchState(Creature* creature)
 {
+    // This runs every update for every creature not fighting a player, so the broker is only touched when this one was registered
+    if (creature->CustomData.Get<EverQuestCreatureDefendPlayerWatchState>(EQ_CREATURE_CUSTOMDATA_DEFENDPLAYERWATCH) == nullptr)
+        return;
     creature->CustomData.Erase(EQ_CREATURE_CUSTOMDATA_DEFENDPLAYERWATCH);
+    Map* map = creature->GetMap();
+    EverQuestDefendMapBroker* broker = map->CustomData.Get<EverQuestDefendMapBroker>(EQ_MAP_CUSTOMDATA_DEFENDBROKER);
+    if (broker == nullptr)
+        return;
+    broker->AttackedPlayerGUIDByAttackerGUID.erase(creature->GetGUID());
+    broker->NewAttackerGUIDs.erase(creature->GetGUID());
+    if (broker->AttackedPlayerGUIDByAttackerGUID.empty() == true)
+        map->CustomData.Erase(EQ_MAP_CUSTOMDATA_DEFENDBROKER);
 }
 
 void EverQuestMod::SendPlayerToZoneSafePoint(Player* player, bool includeGroup)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
+
     // In-zone succor sends to the safe point of the zone the caster is currently in
     uint32 mapID = player->GetMapId();
-    if (ZoneSafePointByMapID.find(mapID) == ZoneSafePointByMapID.end())
+    if (worldData.ZoneSafePointByMapID.find(mapID) == worldData.ZoneSafePointByMapID.end())
     {
         ChatHandler(player->GetSession()).PSendSysMessage("There is no safe location in this zone. Spell failed.");
         return;
     }
 
-    const EverQuestZoneSafePoint& zoneSafePoint = ZoneSafePointByMapID[mapID];
+    const EverQuestZoneSafePoint& zoneSafePoint = worldData.ZoneSafePointByMapID.at(mapID);
     player->TeleportTo({ mapID, {zoneSafePoint.X, zoneSafePoint.Y, zoneSafePoint.Z, zoneSafePoint.Orientation} });
 
     // Party-target succor also pulls the caster's living group members that share the same zone to the safe point
@@ -6681,9 +8731,9 @@ void EverQuestMod::SendPlayerToZoneSafePoint(Player* player, bool includeGroup)
     }
 }
 
-void EverQuestMod::LoadClassMapData()
+void EverQuestMod::LoadClassMapData(EverQuestWorldData& worldData)
 {
-    ClassMapByWOWClassID.clear();
+    worldData.ClassMapByWOWClassID.clear();
 
     QueryResult queryResult = WorldDatabase.Query("SELECT wowclass, eqclass_base, eqclass_defaultsecond, eqclass_eligiblesecond_mask FROM mod_everquest_classmap;");
     if (queryResult)
@@ -6696,15 +8746,16 @@ void EverQuestMod::LoadClassMapData()
             classMap.EQClassIDBase = fields[1].Get<uint8>();
             classMap.EQClassIDDefaultSecond = fields[2].Get<uint8>();
             classMap.EQClassIDEligibleSecondMask = fields[3].Get<uint32>();
-            ClassMapByWOWClassID[classMap.WOWClassID] = classMap;
+            worldData.ClassMapByWOWClassID[classMap.WOWClassID] = classMap;
         } while (queryResult->NextRow());
     }
 }
 
 const EverQuestClassMap& EverQuestMod::GetClassMapForWOWClassID(uint8 wowClassID)
 {
-    if (ClassMapByWOWClassID.find(wowClassID) != ClassMapByWOWClassID.end())
-        return ClassMapByWOWClassID[wowClassID];
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.ClassMapByWOWClassID.find(wowClassID) != worldData.ClassMapByWOWClassID.end())
+        return worldData.ClassMapByWOWClassID.at(wowClassID);
     else
     {
         static const EverQuestClassMap returnEmpty{};
@@ -6715,7 +8766,8 @@ const EverQuestClassMap& EverQuestMod::GetClassMapForWOWClassID(uint8 wowClassID
 
 bool EverQuestMod::IsEQClassABaseEQClass(uint8 eqClassID)
 {
-    for (auto& classMapPair : ClassMapByWOWClassID)
+    const EverQuestWorldData& worldData = GetWorldData();
+    for (auto& classMapPair : worldData.ClassMapByWOWClassID)
         if (classMapPair.second.EQClassIDBase == eqClassID)
             return true;
     return false;
@@ -6776,6 +8828,17 @@ void EverQuestMod::SendPlayerToLastGate(Player* player)
 // Reads the EverQuest bind point, returning false when the player has never bound in Norrath
 bool EverQuestMod::TryGetEQBindHomePosition(Player* player, uint32& mapIDOut, float& xOut, float& yOut, float& zOut)
 {
+    if (std::shared_ptr<const EverQuestPlayerLoginData> loginData = GetReadyLoginDataForPlayer(player->GetGUID()))
+    {
+        if (loginData->HasBindHome == false)
+            return false;
+        mapIDOut = loginData->BindHomeMapID;
+        xOut = loginData->BindHomeX;
+        yOut = loginData->BindHomeY;
+        zOut = loginData->BindHomeZ;
+        return true;
+    }
+
     QueryResult queryResult = CharacterDatabase.Query("SELECT homebindMapId, homebindZoneId, homebindPosX, homebindPosY, homebindPosZ FROM mod_everquest_character_settings WHERE guid = {} AND homebindMapId IS NOT NULL", player->GetGUID().GetCounter());
     if (!queryResult || queryResult->GetRowCount() == 0)
         return false;
@@ -6831,6 +8894,26 @@ void EverQuestMod::SetNewBindHome(Player* player, uint32 playerGUIDCounter, int
         playerGUIDCounter, mapID, zoneID, playerX, playerY, playerZ,
         mapID, zoneID, playerX, playerY, playerZ);
 
+    // First login binds before the login data is dropped, so keep it from handing back the old bind point
+    {
+        std::lock_guard<std::mutex> lock(PlayerLoginDataMutex);
+        auto loginDataItr = PlayerLoginDataByGUID.find(player->GetGUID());
+        // A load still in flight would finish with the old bind point, so it is dropped and the rest of login reads the database instead
+        if (loginDataItr != PlayerLoginDataByGUID.end() && loginDataItr->second.IsReady() == false)
+            PlayerLoginDataByGUID.erase(loginDataItr);
+        else if (loginDataItr != PlayerLoginDataByGUID.end())
+        {
+            // Readers may still hold the current copy, so the bind point goes into a new one
+            std::shared_ptr<EverQuestPlayerLoginData> loginData = std::make_shared<EverQuestPlayerLoginData>(*loginDataItr->second.Data);
+            loginData->HasBindHome = true;
+            loginData->BindHomeMapID = uint32(mapID);
+            loginData->BindHomeX = playerX;
+            loginData->BindHomeY = playerY;
+            loginData->BindHomeZ = playerZ;
+            loginDataItr->second.Data = loginData;
+        }
+    }
+
     // Send a message to the player
     ChatHandler(player->GetSession()).PSendSysMessage("You feel yourself bind to the area.");
 }
@@ -6853,14 +8936,15 @@ uint64 EverQuestMod::GetMapInstanceKey(Map* map)
 
 void EverQuestMod::AddCreatureAsLoaded(Creature* creature)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
     uint64 mapInstanceKey = GetMapInstanceKey(creature->GetMap());
     std::lock_guard<std::mutex> lock(RuntimeStateMutex);
     AllLoadedCreaturesByMapInstanceKeyThenCreatureEntryID[mapInstanceKey][creature->GetEntry()].push_back(creature);
 
     // Track by spawn point and spawn group, if this creature has one
-    if (creature->GetSpawnId() != 0 && CreatureSpawnPointsByCreatureGUID.find(creature->GetSpawnId()) != CreatureSpawnPointsByCreatureGUID.end())
+    if (creature->GetSpawnId() != 0 && worldData.CreatureSpawnPointsByCreatureGUID.find(creature->GetSpawnId()) != worldData.CreatureSpawnPointsByCreatureGUID.end())
     {
-        const EverQuestCreatureSpawnPoint& creatureSpawnPoint = CreatureSpawnPointsByCreatureGUID[creature->GetSpawnId()];
+        const EverQuestCreatureSpawnPoint& creatureSpawnPoint = worldData.CreatureSpawnPointsByCreatureGUID.at(creature->GetSpawnId());
         AllLoadedCreaturesByMapInstanceKeyThenSpawnPointID[mapInstanceKey][creatureSpawnPoint.SpawnPointID].push_back(creature);
         AllLoadedCreaturesByMapInstanceKeyThenSpawnGroupID[mapInstanceKey][creatureSpawnPoint.SpawnGroupID].push_back(creature);
     }
@@ -6868,6 +8952,7 @@ void EverQuestMod::AddCreatureAsLoaded(Creature* creature)
 
 void EverQuestMod::RemoveCreatureAsLoaded(Creature* creature)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
     uint64 mapInstanceKey = GetMapInstanceKey(creature->GetMap());
     std::lock_guard<std::mutex> lock(RuntimeStateMutex);
     auto entryMapIt = AllLoadedCreaturesByMapInstanceKeyThenCreatureEntryID.find(mapInstanceKey);
@@ -6899,15 +8984,18 @@ void EverQuestMod::RemoveCreatureAsLoaded(Creature* creature)
             {
                 innerMap.erase(bucketIt);
                 if (innerMap.empty())
+                {
                     AllLoadedCreaturesByMapInstanceKeyThenCreatureEntryID.erase(entryMapIt);
+                    TrackingSnapshotsByMapInstanceKey.erase(mapInstanceKey);
+                }
             }
         }
     }
 
     // Remove from the spawn point and spawn group trackers, if this creature has one
-    if (creature->GetSpawnId() != 0 && CreatureSpawnPointsByCreatureGUID.find(creature->GetSpawnId()) != CreatureSpawnPointsByCreatureGUID.end())
+    if (creature->GetSpawnId() != 0 && worldData.CreatureSpawnPointsByCreatureGUID.find(creature->GetSpawnId()) != worldData.CreatureSpawnPointsByCreatureGUID.end())
     {
-        const EverQuestCreatureSpawnPoint& creatureSpawnPoint = CreatureSpawnPointsByCreatureGUID[creature->GetSpawnId()];
+        const EverQuestCreatureSpawnPoint& creatureSpawnPoint = worldData.CreatureSpawnPointsByCreatureGUID.at(creature->GetSpawnId());
         if (AllLoadedCreaturesByMapInstanceKeyThenSpawnPointID.find(mapInstanceKey) != AllLoadedCreaturesByMapInstanceKeyThenSpawnPointID.end())
         {
             unordered_map<uint32, vector<Creature*>>& spawnPointMap = AllLoadedCreaturesByMapInstanceKeyThenSpawnPointID[mapInstanceKey];
@@ -6986,6 +9074,7 @@ vector<Creature*> EverQuestMod::GetLoadedCreaturesWithEntryID(Map* map, uint32 e
 
 void EverQuestMod::RollLootItemsForCreature(Creature* creature)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
     ObjectGuid creatureGUID = creature->GetGUID();
     uint64 mapInstanceKey = GetMapInstanceKey(creature->GetMap());
 
@@ -7002,8 +9091,8 @@ void EverQuestMod::RollLootItemsForCreature(Creature* creature)
     counts->clear();
 
     // Skip creatures with no loot data
-    auto creatureLootGroups = CreatureLootGroupsByCreatureTemplateID.find(creature->GetEntry());
-    if (creatureLootGroups == CreatureLootGroupsByCreatureTemplateID.end())
+    auto creatureLootGroups = worldData.CreatureLootGroupsByCreatureTemplateID.find(creature->GetEntry());
+    if (creatureLootGroups == worldData.CreatureLootGroupsByCreatureTemplateID.end())
         return;
 
     // Each loot group (lootdrop reference) is processed based on the group multiplier
@@ -7166,7 +9255,8 @@ void EverQuestMod::MakeCreatureAttackPlayer(uint32 entryID, Map* map, Player* pl
 
 bool EverQuestMod::IsSpellAnEQSpell(uint32 spellID)
 {
-    if (SpellDataBySpellID.find(spellID) != SpellDataBySpellID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.SpellDataBySpellID.find(spellID) != worldData.SpellDataBySpellID.end())
         return true;
     else
         return false;
@@ -7174,7 +9264,8 @@ bool EverQuestMod::IsSpellAnEQSpell(uint32 spellID)
 
 bool EverQuestMod::IsSpellAnEQBardSong(uint32 spellID)
 {
-    if (SpellDataBySpellID.find(spellID) != SpellDataBySpellID.end())
+    const EverQuestWorldData& worldData = GetWorldData();
+    if (worldData.SpellDataBySpellID.find(spellID) != worldData.SpellDataBySpellID.end())
     {
         SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellID);
         if (!spellInfo)
@@ -7190,6 +9281,171 @@ bool EverQuestMod::IsSpellAnEQBardSong(uint32 spellID)
     return false;
 }
 
+// Resizing keeps the newest songs, which is what the limit would have left running anyway.  The older songs that no longer fit are handed back
+// so the caller can end them
+static void ResizeBardSongRing(EverQuestPlayerBardSongRingState& ring, uint32 capacity, vector<uint32>& evictedSpellIDsOut)
+{
+    vector<uint32> songSpellIDs(capacity, 0);
+    uint32 keptCount = std::min(ring.Count, capacity);
+    for (uint32 i = 0; i < ring.Count - keptCount; ++i)
+        evictedSpellIDsOut.push_back(ring.SongSpellIDs[(ring.HeadIndex + i) % ring.SongSpellIDs.size()]);
+    for (uint32 i = 0; i < keptCount; ++i)
+        songSpellIDs[i] = ring.SongSpellIDs[(ring.HeadIndex + ring.Count - keptCount + i) % ring.SongSpellIDs.size()];
+    ring.SongSpellIDs.swap(songSpellIDs);
+    ring.HeadIndex = 0;
+    ring.Count = keptCount;
+}
+
+static bool RemoveSongFromBardSongRing(EverQuestPlayerBardSongRingState& ring, uint32 spellID)
+{
+    uint32 capacity = (uint32)ring.SongSpellIDs.size();
+    for (uint32 i = 0; i < ring.Count; ++i)
+    {
+        if (ring.SongSpellIDs[(ring.HeadIndex + i) % capacity] != spellID)
+            continue;
+
+        // Close the gap by sliding the newer songs back one slot
+        for (uint32 j = i + 1; j < ring.Count; ++j)
+            ring.SongSpellIDs[(ring.HeadIndex + j - 1) % capacity] = ring.SongSpellIDs[(ring.HeadIndex + j) % capacity];
+        ring.Count--;
+        return true;
+    }
+    return false;
+}
+
+// Moves the song to the newest slot, returning the oldest song it pushed out (or 0 if the ring had room)
+static uint32 RefreshSongInBardSongRing(EverQuestPlayerBardSongRingState& ring, uint32 spellID)
+{
+    uint32 capacity = (uint32)ring.SongSpellIDs.size();
+    if (capacity == 0)
+        return 0;
+    RemoveSongFromBardSongRing(ring, spellID);
+    uint32 evictedSpellID = 0;
+    if (ring.Count == capacity)
+    {
+        evictedSpellID = ring.SongSpellIDs[ring.HeadIndex];
+        ring.HeadIndex = (ring.HeadIndex + 1) % capacity;
+        ring.Count--;
+    }
+    ring.SongSpellIDs[(ring.HeadIndex + ring.Count) % capacity] = spellID;
+    ring.Count++;
+    return evictedSpellID;
+}
+
+// A config reload can change the limit, so the ring picks up the new size on the bard's next song and ends any songs that no longer fit
+static EverQuestPlayerBardSongRingState* GetBardSongRingForPlayer(Player* player, uint32 capacity)
+{
+    EverQuestPlayerBardSongRingState* ring = player->CustomData.GetDefault<EverQuestPlayerBardSongRingState>(EQ_PLAYER_CUSTOMDATA_BARDSONGS);
+    if (ring->SongSpellIDs.size() != capacity)
+    {
+        vector<uint32> evictedSpellIDs;
+        ResizeBardSongRing(*ring, capacity, evictedSpellIDs);
+        for (uint32 evictedSpellID : evictedSpellIDs)
+            player->RemoveAurasDueToSpell(evictedSpellID);
+    }
+    return ring;
+}
+
+void EverQuestMod::RefreshConcurrentBardSongForPlayer(Player* player, uint32 spellID)
+{
+    if (ConfigBardMaxConcurrentSongs == 0)
+        return;
+    uint32 evictedSpellID = RefreshSongInBardSongRing(*GetBardSongRingForPlayer(player, ConfigBardMaxConcurrentSongs), spellID);
+    if (evictedSpellID != 0)
+        player->RemoveAurasDueToSpell(evictedSpellID);
+}
+
+void EverQuestMod::RemoveConcurrentBardSongForPlayer(Player* player, uint32 spellID)
+{
+    if (ConfigBardMaxConcurrentSongs == 0)
+        return;
+    EverQuestPlayerBardSongRingState* ring = player->CustomData.Get<EverQuestPlayerBardSongRingState>(EQ_PLAYER_CUSTOMDATA_BARDSONGS);
+    if (ring == nullptr || ring->SongSpellIDs.empty() == true)
+        return;
+    RemoveSongFromBardSongRing(*ring, spellID);
+}
+
+void EverQuestMod::RebuildConcurrentBardSongsForPlayer(Player* player)
+{
+    if (ConfigBardMaxConcurrentSongs == 0)
+        return;
+    EverQuestPlayerBardSongRingState* ring = GetBardSongRingForPlayer(player, ConfigBardMaxConcurrentSongs);
+    ring->HeadIndex = 0;
+    ring->Count = 0;
+    vector<uint32> evictedSpellIDs;
+    for (auto const& itr : player->GetAppliedAuras())
+    {
+        uint32 spellID = itr.second->GetBase()->GetId();
+        if (IsSpellAnEQBardSong(spellID) == true)
+        {
+            uint32 evictedSpellID = RefreshSongInBardSongRing(*ring, spellID);
+            if (evictedSpellID != 0)
+                evictedSpellIDs.push_back(evictedSpellID);
+        }
+    }
+
+    // Removed after the walk, since removing an aura changes the applied aura list
+    for (uint32 evictedSpellID : evictedSpellIDs)
+        player->RemoveAurasDueToSpell(evictedSpellID);
+}
+
+// Run on demand by .eqbenchbardsongs rather than at startup.  A full raid of bards twisting more songs than the limit allows, through the old
+// locked map of deques with its linear find and erase, and through the per-player rings
+string EverQuestMod::MeasureConcurrentBardSongThroughput()
+{
+    static const uint32 raidBardCount = 40;
+    static const uint32 twistedSongCount = 6;
+    static const uint32 appliesPerBard = 25000;
+    uint32 capacity = ConfigBardMaxConcurrentSongs != 0 ? ConfigBardMaxConcurrentSongs : 4;
+    uint64 applyCount = (uint64)raidBardCount * appliesPerBard;
+
+    std::mutex lockedSongsMutex;
+    unordered_map<uint32, deque<uint32>> lockedSongsByBardIndex;
+    uint64 lockedEvictionCount = 0;
+    auto lockedStartTime = std::chrono::steady_clock::now();
+    for (uint32 applyIndex = 0; applyIndex < appliesPerBard; ++applyIndex)
+    {
+        for (uint32 bardIndex = 0; bardIndex < raidBardCount; ++bardIndex)
+        {
+            deque<uint32>* songs = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(lockedSongsMutex);
+                songs = &lockedSongsByBardIndex[bardIndex];
+            }
+            uint32 spellID = 1 + ((applyIndex + bardIndex) % twistedSongCount);
+            auto songIter = std::find(songs->begin(), songs->end(), spellID);
+            if (songIter != songs->end())
+                songs->erase(songIter);
+            songs->push_back(spellID);
+            while (songs->size() > capacity)
+            {
+                songs->pop_front();
+                lockedEvictionCount++;
+            }
+        }
+    }
+    double lockedElapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - lockedStartTime).count();
+
+    vector<EverQuestPlayerBardSongRingState> rings(raidBardCount);
+    vector<uint32> unusedEvictedSpellIDs;
+    for (EverQuestPlayerBardSongRingState& ring : rings)
+        ResizeBardSongRing(ring, capacity, unusedEvictedSpellIDs);
+    uint64 ringEvictionCount = 0;
+    auto ringStartTime = std::chrono::steady_clock::now();
+    for (uint32 applyIndex = 0; applyIndex < appliesPerBard; ++applyIndex)
+        for (uint32 bardIndex = 0; bardIndex < raidBardCount; ++bardIndex)
+            if (RefreshSongInBardSongRing(rings[bardIndex], 1 + ((applyIndex + bardIndex) % twistedSongCount)) != 0)
+                ringEvictionCount++;
+    double ringElapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - ringStartTime).count();
+
+    if (lockedEvictionCount != ringEvictionCount)
+        LOG_ERROR("module.EverQuest", "EverQuestMod::MeasureConcurrentBardSongThroughput found the ring evicted {} songs where the old limiter evicted {}", ringEvictionCount, lockedEvictionCount);
+    string result = fmt::format("Bard song limiter, {} song applies for a {} bard raid at a {} song limit: {:.0f} applies per second per raid with the locked deques, {:.0f} with the rings",
+        applyCount, raidBardCount, capacity, lockedElapsedSeconds > 0 ? applyCount / lockedElapsedSeconds : 0.0, ringElapsedSeconds > 0 ? applyCount / ringElapsedSeconds : 0.0);
+    LOG_INFO("module.EverQuest", "EverQuestMod::MeasureConcurrentBardSongThroughput {}", result);
+    return result;
+}
+
 uint32 EverQuestMod::CalculateSpellFocusBoostValue(Unit* caster, uint32 spellID)
 {
     if (caster == nullptr)
@@ -7243,6 +9499,7 @@ uint32 EverQuestMod::CalculateSpellFocusBoostValue(Unit* caster, uint32 spellID)
 
 void EverQuestMod::ProcessForage(Player* player)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
     if (player == nullptr)
         return;
     if (player->GetMap() == nullptr)
@@ -7262,7 +9519,7 @@ void EverQuestMod::ProcessForage(Player* player)
         ChatHandler(player->GetSession()).PSendSysMessage("This area has nothing to forage.");
         return;
     }
-    int32 roll = (int32)urand(0, ForageZoneItemTotalChanceByMapID[mapID]);
+    int32 roll = (int32)urand(0, worldData.ForageZoneItemTotalChanceByMapID.at(mapID));
     for (const EverQuestForageZoneItem& zoneItem : forageZoneItems)
     {
         roll -= zoneItem.Chance;
@@ -7486,7 +9743,10 @@ EverQuestPlayerControllerData* EverQuestMod::GetOrLoadActivePlayerClassControlle
     EverQuestPlayerControllerData loadedControllerData = GetPlayerControllerData(player);
 
     std::lock_guard<std::mutex> lock(RuntimeStateMutex);
-    return &ActivePlayerClassControllerDataByGUID.emplace(player->GetGUID(), loadedControllerData).first->second;
+    auto emplaceResult = ActivePlayerClassControllerDataByGUID.emplace(player->GetGUID(), loadedControllerData);
+    if (emplaceResult.second == true)
+        SetBardPulseHiddenTrackedForPlayer(player->GetGUID(), loadedControllerData.ShowBardPulse == false);
+    return &emplaceResult.first->second;
 }
 
 uint8 EverQuestMod::GetCurrentSecondEQClassForPlayer(Player* player)
@@ -7515,6 +9775,7 @@ void EverQuestMod::SetInitialEQClassesForPlayer(Player* player)
     {
         std::lock_guard<std::mutex> lock(RuntimeStateMutex);
         ActivePlayerClassControllerDataByGUID[player->GetGUID()] = controllerData;
+        SetBardPulseHiddenTrackedForPlayer(player->GetGUID(), controllerData.ShowBardPulse == false);
     }
 
     // Persist the controller columns immediately, without disturbing any home-bind / last-gate data already in this row
@@ -7539,34 +9800,172 @@ void EverQuestMod::SetInitialCreatePositionForPlayer(Player* player)
         createInfo.MapID, createInfo.ZoneID, createInfo.PositionX, createInfo.PositionY, createInfo.PositionZ, createInfo.Orientation, player->GetGUID().GetCounter());
 }
 
-EverQuestPlayerControllerData EverQuestMod::GetPlayerControllerData(Player* player)
+EverQuestPlayerControllerData EverQuestMod::GetDefaultPlayerControllerData(Player* player)
 {
+    const EverQuestClassMap classMap = GetClassMapForWOWClassID(player->getClass());
     EverQuestPlayerControllerData controllerData;
     controllerData.GUID = player->GetGUID().GetCounter();
-    QueryResult queryResult = CharacterDatabase.Query("SELECT nextSecondaryClass, currentSecondaryClass, secondaryExpPool, illusionFaceId, showBardPulse, issuedIllusionItemId, hideWoWGear FROM mod_everquest_character_settings WHERE guid = {}", player->GetGUID().GetCounter());
-    if (!queryResult || queryResult->GetRowCount() == 0)
+    controllerData.CurrentSecondClass = classMap.EQClassIDDefaultSecond;
+    controllerData.NextSecondClass = classMap.EQClassIDDefaultSecond;
+    controllerData.SecondaryExpPool = 0;
+    controllerData.IllusionFaceID = 0;
+    controllerData.ShowBardPulse = true;
+    controllerData.IssuedIllusionItemID = 0;
+    controllerData.HideWoWGear = false;
+    return controllerData;
+}
+
+// Field order must match the controller column list used by GetPlayerControllerData and BeginLoginDataLoadForPlayer
+static void ReadPlayerControllerDataFields(Field* fields, EverQuestPlayerControllerData& controllerData)
+{
+    controllerData.NextSecondClass = fields[0].Get<uint8>();
+    controllerData.CurrentSecondClass = fields[1].Get<uint8>();
+    controllerData.SecondaryExpPool = fields[2].Get<uint32>();
+    controllerData.IllusionFaceID = (uint32)std::max(0, fields[3].Get<int32>());
+    controllerData.ShowBardPulse = fields[4].Get<bool>();
+    controllerData.IssuedIllusionItemID = fields[5].Get<uint32>();
+    controllerData.HideWoWGear = fields[6].Get<bool>();
+}
+
+EverQuestPlayerControllerData EverQuestMod::GetPlayerControllerData(Player* player)
+{
+    EverQuestPlayerControllerData controllerData = GetDefaultPlayerControllerData(player);
+
+    // Use the login load if it is there, so entering the world doesn't block on this query
+    if (std::shared_ptr<const EverQuestPlayerLoginData> loginData = GetReadyLoginDataForPlayer(player->GetGUID()))
     {
-        const EverQuestClassMap classMap = GetClassMapForWOWClassID(player->getClass());
-        controllerData.CurrentSecondClass = classMap.EQClassIDDefaultSecond;
-        controllerData.NextSecondClass = classMap.EQClassIDDefaultSecond;
-        controllerData.SecondaryExpPool = 0;
-        controllerData.IllusionFaceID = 0;
-        controllerData.ShowBardPulse = true;
-        controllerData.IssuedIllusionItemID = 0;
-        controllerData.HideWoWGear = false;
+        if (loginData->HasControllerRow == true)
+            controllerData = loginData->ControllerData;
+        controllerData.GUID = player->GetGUID().GetCounter();
+        return controllerData;
     }
-    else
+
+    QueryResult queryResult = CharacterDatabase.Query("SELECT nextSecondaryClass, currentSecondaryClass, secondaryExpPool, illusionFaceId, showBardPulse, issuedIllusionItemId, hideWoWGear FROM mod_everquest_character_settings WHERE guid = {}", player->GetGUID().GetCounter());
+    if (queryResult && queryResult->GetRowCount() != 0)
+        ReadPlayerControllerDataFields(queryResult->Fetch(), controllerData);
+    return controllerData;
+}
+
+// Called from CanPacketReceive on the network thread when CMSG_PLAYER_LOGIN arrives.  Only the request is recorded here, one per account, and the
+// world thread starts the load once it has checked the character belongs to the account
+void EverQuestMod::QueueLoginDataLoadForPlayer(WorldSession* session, ObjectGuid playerGUID)
+{
+    std::lock_guard<std::mutex> lock(PlayerLoginDataMutex);
+    PendingLoginDataRequestsByAccountID[session->GetAccountId()] = playerGUID;
+}
+
+// Issues every mod-owned per-character read that login needs as one asynchronous batch, while the core is still loading its own login holder.
+// The mod has no prepared statements registered with the core's CharacterDatabase, so this is a set of async queries that complete into one
+// login data entry rather than a CharacterDatabaseQueryHolder.  Called with PlayerLoginDataMutex held
+void EverQuestMod::BeginLoginDataLoadForPlayer(uint32 accountID, ObjectGuid playerGUID)
+{
+    uint32 playerGUIDCounter = playerGUID.GetCounter();
+    EverQuestPlayerLoginDataLoad& loginDataLoad = PlayerLoginDataByGUID[playerGUID];
+    loginDataLoad = EverQuestPlayerLoginDataLoad();
+    loginDataLoad.IssuedMSTime = getMSTime();
+    loginDataLoad.Data = std::make_shared<EverQuestPlayerLoginData>();
+
+    // Each callback holds its own reference, so a load that gets dropped or replaced before its queries finish is still safe to complete into
+    std::shared_ptr<EverQuestPlayerLoginData> loginData = loginDataLoad.Data;
+    loginDataLoad.PendingQueryCallbacks.push_back(CharacterDatabase.AsyncQuery(Acore::StringFormat("SELECT nextSecondaryClass, currentSecondaryClass, secondaryExpPool, illusionFaceId, showBardPulse, issuedIllusionItemId, hideWoWGear, "
+        "homebindMapId, homebindPosX, homebindPosY, homebindPosZ FROM mod_everquest_character_settings WHERE guid = {}", playerGUIDCounter)).WithCallback([loginData](QueryResult queryResult)
     {
+        if (!queryResult || queryResult->GetRowCount() == 0)
+            return;
         Field* fields = queryResult->Fetch();
-        controllerData.NextSecondClass = fields[0].Get<uint8>();
-        controllerData.CurrentSecondClass = fields[1].Get<uint8>();
-        controllerData.SecondaryExpPool = fields[2].Get<uint32>();
-        controllerData.IllusionFaceID = (uint32)std::max(0, fields[3].Get<int32>());
-        controllerData.ShowBardPulse = fields[4].Get<bool>();
-        controllerData.IssuedIllusionItemID = fields[5].Get<uint32>();
-        controllerData.HideWoWGear = fields[6].Get<bool>();
+        loginData->HasControllerRow = true;
+        ReadPlayerControllerDataFields(fields, loginData->ControllerData);
+        if (fields[7].IsNull() == false)
+        {
+            loginData->HasBindHome = true;
+            loginData->BindHomeMapID = fields[7].Get<uint32>();
+            loginData->BindHomeX = fields[8].Get<float>();
+            loginData->BindHomeY = fields[9].Get<float>();
+            loginData->BindHomeZ = fields[10].Get<float>();
+        }
+    }));
+    loginDataLoad.PendingQueryCallbacks.push_back(CharacterDatabase.AsyncQuery(Acore::StringFormat("SELECT `eqclass`, `level` FROM mod_everquest_characters WHERE guid = {}", playerGUIDCounter)).WithCallback([loginData](QueryResult queryResult)
+    {
+        if (!queryResult)
+            return;
+        do
+        {
+            Field* fields = queryResult->Fetch();
+            loginData->SavedClassLevelsByClass[fields[0].Get<uint8>()] = fields[1].Get<uint8>();
+        } while (queryResult->NextRow());
+    }));
+    loginDataLoad.PendingQueryCallbacks.push_back(CharacterDatabase.AsyncQuery(Acore::StringFormat("SELECT 1 FROM mod_everquest_account_settings WHERE accountid = {} AND earnedAdventurerAchievement = 1", accountID)).WithCallback([loginData](QueryResult queryResult)
+    {
+        loginData->AccountEarnedAdventurerAchievement = (queryResult != nullptr);
+    }));
+}
+
+// Starts the requested loads, runs any completed login data callbacks, and drops entries for logins that never made it into the world
+void EverQuestMod::ProcessPendingLoginDataLoads()
+{
+    std::lock_guard<std::mutex> lock(PlayerLoginDataMutex);
+    uint32 nowMSTime = getMSTime();
+
+    // The GUID comes straight from the client, so it has to be one of the account's own characters.  A character whose load is still in flight
+    // isn't loaded again, so repeating the login packet can't queue up more queries
+    for (const auto& loginRequestPair : PendingLoginDataRequestsByAccountID)
+    {
+        if (sCharacterCache->GetCharacterAccountIdByGuid(loginRequestPair.second) != loginRequestPair.first)
+            continue;
+        auto loginDataItr = PlayerLoginDataByGUID.find(loginRequestPair.second);
+        if (loginDataItr != PlayerLoginDataByGUID.end() && loginDataItr->second.IsReady() == false)
+            continue;
+        BeginLoginDataLoadForPlayer(loginRequestPair.first, loginRequestPair.second);
     }
-    return controllerData;
+    PendingLoginDataRequestsByAccountID.clear();
+
+    for (auto loginDataItr = PlayerLoginDataByGUID.begin(); loginDataItr != PlayerLoginDataByGUID.end();)
+    {
+        EverQuestPlayerLoginDataLoad& loginDataLoad = loginDataItr->second;
+        if (loginDataLoad.IsReady() == false)
+        {
+            loginDataLoad.PendingQueryCallbacks.erase(std::remove_if(loginDataLoad.PendingQueryCallbacks.begin(), loginDataLoad.PendingQueryCallbacks.end(),
+                [](QueryCallback& callback) { return callback.InvokeIfReady(); }), loginDataLoad.PendingQueryCallbacks.end());
+            if (loginDataLoad.IsReady() == true)
+            {
+                loginDataLoad.ReadyMSTime = nowMSTime;
+                LOG_DEBUG("module.EverQuest", "EverQuestMod login data for player guid {} loaded in {} ms", loginDataItr->first.GetCounter(), getMSTimeDiff(loginDataLoad.IssuedMSTime, nowMSTime));
+            }
+        }
+        else if (getMSTimeDiff(loginDataLoad.IssuedMSTime, nowMSTime) > EQ_LOGIN_DATA_EXPIRY_MS)
+        {
+            loginDataItr = PlayerLoginDataByGUID.erase(loginDataItr);
+            continue;
+        }
+        ++loginDataItr;
+    }
+}
+
+// Returns the player's login data if every query in it has finished.  Returns nullptr if there is none or it is still loading, which callers
+// handle by querying directly, so the world thread never waits on the load
+std::shared_ptr<const EverQuestPlayerLoginData> EverQuestMod::GetReadyLoginDataForPlayer(ObjectGuid playerGUID)
+{
+    std::lock_guard<std::mutex> lock(PlayerLoginDataMutex);
+    auto loginDataItr = PlayerLoginDataByGUID.find(playerGUID);
+    if (loginDataItr == PlayerLoginDataByGUID.end())
+        return nullptr;
+    EverQuestPlayerLoginDataLoad& loginDataLoad = loginDataItr->second;
+    if (loginDataLoad.IsReady() == false)
+    {
+        loginDataLoad.PendingQueryCallbacks.erase(std::remove_if(loginDataLoad.PendingQueryCallbacks.begin(), loginDataLoad.PendingQueryCallbacks.end(),
+            [](QueryCallback& callback) { return callback.InvokeIfReady(); }), loginDataLoad.PendingQueryCallbacks.end());
+        if (loginDataLoad.IsReady() == false)
+            return nullptr;
+        loginDataLoad.ReadyMSTime = getMSTime();
+        LOG_DEBUG("module.EverQuest", "EverQuestMod login data for player guid {} loaded in {} ms", playerGUID.GetCounter(), getMSTimeDiff(loginDataLoad.IssuedMSTime, loginDataLoad.ReadyMSTime));
+    }
+    return loginDataLoad.Data;
+}
+
+void EverQuestMod::ClearLoginDataForPlayer(ObjectGuid playerGUID)
+{
+    std::lock_guard<std::mutex> lock(PlayerLoginDataMutex);
+    PlayerLoginDataByGUID.erase(playerGUID);
 }
 
 uint32 EverQuestMod::GetSecondaryExpPoolForPlayer(Player* player)
@@ -7697,9 +10096,38 @@ bool EverQuestMod::GetShowBardPulseForPlayer(Player* player)
 void EverQuestMod::SetShowBardPulseForPlayer(Player* player, bool showBardPulse)
 {
     GetOrLoadActivePlayerClassControllerData(player)->ShowBardPulse = showBardPulse;
+    {
+        std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+        SetBardPulseHiddenTrackedForPlayer(player->GetGUID(), showBardPulse == false);
+    }
     SaveShowBardPulseForPlayer(player);
 }
 
+// Caller must hold RuntimeStateMutex.  The count lets the packet send hook skip spell packets without locking when nobody hides pulses
+void EverQuestMod::SetBardPulseHiddenTrackedForPlayer(ObjectGuid playerGUID, bool isHidden)
+{
+    if (isHidden == true)
+        PlayersWithBardPulseHidden.insert(playerGUID);
+    else
+        PlayersWithBardPulseHidden.erase(playerGUID);
+    PlayersWithBardPulseHiddenCount.store((uint32)PlayersWithBardPulseHidden.size(), std::memory_order_relaxed);
+}
+
+// Only counts the character again if its controller data is still cached from before, since a first load counts it as it loads
+void EverQuestMod::RetrackBardPulseHiddenForPlayerLogin(Player* player)
+{
+    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+    auto controllerDataIt = ActivePlayerClassControllerDataByGUID.find(player->GetGUID());
+    if (controllerDataIt != ActivePlayerClassControllerDataByGUID.end())
+        SetBardPulseHiddenTrackedForPlayer(player->GetGUID(), controllerDataIt->second.ShowBardPulse == false);
+}
+
+void EverQuestMod::UntrackBardPulseHiddenForPlayerLogout(ObjectGuid playerGUID)
+{
+    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+    SetBardPulseHiddenTrackedForPlayer(playerGUID, false);
+}
+
 void EverQuestMod::SaveShowBardPulseForPlayer(Player* player)
 {
     EverQuestPlayerControllerData controllerData;
@@ -7885,7 +10313,17 @@ map<uint8, uint8> EverQuestMod::GetClassLevelsByClassForPlayer(Player* player)
 {
     // Pull the other class levels first
     map<uint8, uint8> levelsByClass;
-    QueryResult classQueryResult = CharacterDatabase.Query("SELECT `eqclass`, `level` FROM mod_everquest_characters WHERE guid = {} AND eqclass <> {}", player->GetGUID().GetCounter(), GetCurrentSecondEQClassForPlayer(player));
+    uint8 currentSecondClass = GetCurrentSecondEQClassForPlayer(player);
+    if (std::shared_ptr<const EverQuestPlayerLoginData> loginData = GetReadyLoginDataForPlayer(player->GetGUID()))
+    {
+        for (auto const& savedClassLevel : loginData->SavedClassLevelsByClass)
+            if (savedClassLevel.first != currentSecondClass)
+                levelsByClass.insert(savedClassLevel);
+        levelsByClass.insert(pair<uint8, uint8>(currentSecondClass, player->GetLevel()));
+        return levelsByClass;
+    }
+
+    QueryResult classQueryResult = CharacterDatabase.Query("SELECT `eqclass`, `level` FROM mod_everquest_characters WHERE guid = {} AND eqclass <> {}", player->GetGUID().GetCounter(), currentSecondClass);
     if (classQueryResult)
     {
         do
@@ -7899,13 +10337,16 @@ map<uint8, uint8> EverQuestMod::GetClassLevelsByClassForPlayer(Player* player)
     }
 
     // Add this class level
-    levelsByClass.insert(pair<uint8, uint8>(GetCurrentSecondEQClassForPlayer(player), player->GetLevel()));
+    levelsByClass.insert(pair<uint8, uint8>(currentSecondClass, player->GetLevel()));
 
     return levelsByClass;
 }
 
 bool EverQuestMod::DoesSavedClassDataExistForPlayer(Player* player, uint8 lookupClass)
 {
+    if (std::shared_ptr<const EverQuestPlayerLoginData> loginData = GetReadyLoginDataForPlayer(player->GetGUID()))
+        return loginData->SavedClassLevelsByClass.find(lookupClass) != loginData->SavedClassLevelsByClass.end();
+
     QueryResult queryResult = CharacterDatabase.Query("SELECT guid, eqclass FROM mod_everquest_characters WHERE guid = {} AND eqclass = {}", player->GetGUID().GetCounter(), lookupClass);
     if (!queryResult || queryResult->GetRowCount() == 0)
         return false;
@@ -8018,6 +10459,8 @@ bool EverQuestMod::IsDeathKnightSkillID(uint32 skillID)
 
 bool EverQuestMod::IsSpellExemptFromClassMove(uint32 spellID)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
+
     // Death Knight abilities belong to the fixed WoW class rather than the active EQ secondary class, so persist across switches
     if (spellID == EQ_DEATHKNIGHT_DEATHGATE_SPELL_ID || spellID == EQ_DEATHKNIGHT_RUNEFORGING_SPELL_ID)
         return true;
@@ -8029,8 +10472,8 @@ bool EverQuestMod::IsSpellExemptFromClassMove(uint32 spellID)
         return true;
 
     // Spells flagged by the converter as character-wide (like the racial guise spells) persist across switches
-    auto spellDataItr = SpellDataBySpellID.find(spellID);
-    if (spellDataItr != SpellDataBySpellID.end() && spellDataItr->second.PersistOnClassChange == true)
+    auto spellDataItr = worldData.SpellDataBySpellID.find(spellID);
+    if (spellDataItr != worldData.SpellDataBySpellID.end() && spellDataItr->second.PersistOnClassChange == true)
         return true;
 
     // Recipes / abilities mapped to a cross-class skill line via SkillLineAbility
@@ -8185,12 +10628,13 @@ void EverQuestMod::MoveGlyphsToModGlyhpsTable(Player* player, CharacterDatabaseT
 
 void EverQuestMod::MoveAuraToModAuraTable(Player* player, CharacterDatabaseTransaction& transaction)
 {
+    const EverQuestWorldData& worldData = GetWorldData();
     uint8 curEQClass = GetCurrentSecondEQClassForPlayer(player);
 
     // Build the list of spells that should remain on character_aura across a secondary class switch (like gate tether)
     string keptSpellsList = "";
     bool adventurerAuraAlreadyKept = false;
-    for (auto const& spellPair : SpellDataBySpellID)
+    for (auto const& spellPair : worldData.SpellDataBySpellID)
     {
         if (spellPair.second.AuraStaysOnSecondaryClassSwitch == true)
         {
@@ -8551,6 +10995,7 @@ bool EverQuestMod::PerformPlayerDelete(ObjectGuid guid)
     {
         std::lock_guard<std::mutex> lock(RuntimeStateMutex);
         ActivePlayerClassControllerDataByGUID.erase(guid);
+        SetBardPulseHiddenTrackedForPlayer(guid, false);
         PendingEquipmentStorageCommitMSByGUID.erase(guid);
         AgileFighterRefreshTimerMSByPlayerGUID.erase(guid);
     }
@@ -8768,14 +11213,9 @@ void EverQuestMod::SetEquipmentStorageCommitPendingForPlayerGUID(ObjectGuid play
 
 bool EverQuestMod::IsItemEQClassAllowedForPlayerSecondaryClass(Player* player, uint8 eqClassID, uint32 itemTemplateID)
 {
-    // No EQ template data = allowed
-    auto itemTemplateItr = ItemTemplatesByEntryID.find(itemTemplateID);
-    if (itemTemplateItr == ItemTemplatesByEntryID.end())
-        return true;
-
-    // Zero mask = all
-    uint32 allowedEQClassMask = itemTemplateItr->second.AllowedEQClassMask;
-    if (allowedEQClassMask == 0)
+    // No EQ template data or a zero mask = allowed (both come back as the all mask)
+    uint32 allowedEQClassMask = GetEQClassMaskForItemTemplate(itemTemplateID);
+    if (allowedEQClassMask == EQ_EQCLASS_MASK_ALL)
         return true;
 
     // Compare base class (no class map row means the shift below would be undefined, so allow the item)
@@ -9484,11 +11924,106 @@ void EverQuestMod::SendTrackingAddonMessageToPlayer(Player* player, const std::s
     player->SendDirectMessage(&data);
 }
 
+// Returns the map's shared track candidates, rebuilding them from the loaded creature tracker when they are older than the refresh interval.
+// Returns nullptr for maps without loaded creature tracking (non-EverQuest maps). A rebuild publishes a new snapshot rather than refilling the
+// old one, so a caller's copy stays valid however long it holds it
+std::shared_ptr<const EverQuestTrackingMapSnapshot> EverQuestMod::GetTrackingSnapshotForMap(Map* map)
+{
+    uint64 mapInstanceKey = GetMapInstanceKey(map);
+    uint64 nowMS = uint64(GameTime::GetGameTimeMS().count());
+    const unordered_map<int, vector<Creature*>>* loadedCreaturesByEntryID = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+        auto loadedMapIter = AllLoadedCreaturesByMapInstanceKeyThenCreatureEntryID.find(mapInstanceKey);
+        if (loadedMapIter == AllLoadedCreaturesByMapInstanceKeyThenCreatureEntryID.end())
+            return nullptr;
+        auto snapshotIter = TrackingSnapshotsByMapInstanceKey.find(mapInstanceKey);
+        if (snapshotIter != TrackingSnapshotsByMapInstanceKey.end() && nowMS >= snapshotIter->second->BuiltMSTime && nowMS - snapshotIter->second->BuiltMSTime < EQ_TRACKING_SNAPSHOT_REFRESH_MS)
+            return snapshotIter->second;
+        loadedCreaturesByEntryID = &loadedMapIter->second;
+    }
+
+    // The map's loaded creature lists are only changed by this map's thread, so they can be walked without the lock.  Only the per-creature
+    // checks that don't depend on the tracker are done here
+    std::shared_ptr<EverQuestTrackingMapSnapshot> snapshot = std::make_shared<EverQuestTrackingMapSnapshot>();
+    snapshot->BuiltMSTime = nowMS;
+    for (auto const& loadedEntry : *loadedCreaturesByEntryID)
+    {
+        for (Creature* creature : loadedEntry.second)
+        {
+            if (creature->IsInWorld() == false || creature->IsAlive() == false || creature->IsTrigger() == true || creature->IsTotem() == true)
+                continue;
+            EverQuestTrackingCandidate candidate;
+            candidate.CreatureGUID = creature->GetGUID();
+            candidate.X = creature->GetPositionX();
+            candidate.Y = creature->GetPositionY();
+            snapshot->CandidatesByCellID[Acore::ComputeCellCoord(candidate.X, candidate.Y).GetId()].push_back(candidate);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(RuntimeStateMutex);
+    TrackingSnapshotsByMapInstanceKey[mapInstanceKey] = snapshot;
+    return snapshot;
+}
+
+void EverQuestMod::GatherTrackingEntriesForPlayer(Player* player, float maxTrackDistance, std::vector<std::pair<float, Creature*>>& sortedCreatureEntriesOut)
+{
+    sortedCreatureEntriesOut.clear();
+    std::shared_ptr<const EverQuestTrackingMapSnapshot> snapshot = GetTrackingSnapshotForMap(player->GetMap());
+    if (snapshot != nullptr)
+    {
+        // Read only the cells the track range touches, padded for creatures that wandered since the snapshot
+        CellArea cellArea = Cell::CalculateCellArea(player->GetPositionX(), player->GetPositionY(), maxTrackDistance + EQ_TRACKING_SNAPSHOT_MOVE_SLACK);
+        for (uint32 cellX = cellArea.low_bound.x_coord; cellX <= cellArea.high_bound.x_coord; ++cellX)
+        {
+            for (uint32 cellY = cellArea.low_bound.y_coord; cellY <= cellArea.high_bound.y_coord; ++cellY)
+            {
+                auto cellIter = snapshot->CandidatesByCellID.find(CellCoord(cellX, cellY).GetId());
+                if (cellIter == snapshot->CandidatesByCellID.end())
+                    continue;
+                for (const EverQuestTrackingCandidate& candidate : cellIter->second)
+                {
+                    Creature* creature = player->GetMap()->GetCreature(candidate.CreatureGUID);
+                    if (creature == nullptr || player->IsWithinDistInMap(creature, maxTrackDistance) == false)
+                        continue;
+                    if (IsCreatureTrackableForPlayer(player, creature) == false)
+                        continue;
+                    sortedCreatureEntriesOut.push_back(std::make_pair(player->GetDistance(creature), creature));
+                }
+            }
+        }
+    }
+    else
+    {
+        // Gather every trackable creature in range
+        std::list<Creature*> nearbyCreatures;
+        Acore::AnyUnitInObjectRangeCheck check(player, maxTrackDistance);
+        Acore::CreatureListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(player, nearbyCreatures, check);
+        Cell::VisitObjects(player, searcher, maxTrackDistance);
+        for (Creature* creature : nearbyCreatures)
+        {
+            if (IsCreatureTrackableForPlayer(player, creature) == false)
+                continue;
+            sortedCreatureEntriesOut.push_back(std::make_pair(player->GetDistance(creature), creature));
+        }
+    }
+
+    // Nearest first, but only the rows that can be shown need to be in order
+    if (ConfigTrackingMaxResults > 0 && sortedCreatureEntriesOut.size() > size_t(ConfigTrackingMaxResults))
+    {
+        std::partial_sort(sortedCreatureEntriesOut.begin(), sortedCreatureEntriesOut.begin() + ConfigTrackingMaxResults, sortedCreatureEntriesOut.end(), CompareTrackingEntriesByDistance);
+        sortedCreatureEntriesOut.resize(ConfigTrackingMaxResults);
+    }
+    else
+        std::sort(sortedCreatureEntriesOut.begin(), sortedCreatureEntriesOut.end(), CompareTrackingEntriesByDistance);
+}
+
 // Message stream (after the "EQTRACK\t" prefix): "H|<rowCount>|<maxDistance>|<trackedGUIDRaw or empty>", then rows batched a few per message as
 // "R|<guidRaw>|<level>|<distance>|<name>" joined with "~", then a final "F". Separately, "T|<guidRaw>" / "T|" is pushed when tracking starts / stops
 // so the addon can mark the tracked row live, and "D|<maxRange>" is pushed when the player's track range changes (level up).  Creature GUIDs are 64 bit values, so
-// the addon must keep them as strings (Lua numbers lose precision above 2^53) and echo them back in ".track start"
-void EverQuestMod::SendTrackingListToPlayer(Player* player)
+// the addon must keep them as strings (Lua numbers lose precision above 2^53) and echo them back in ".track start".
+// An addon that asks with ".track list 2" gets the packed stream from SendPackedTrackingListToPlayer instead
+void EverQuestMod::SendTrackingListToPlayer(Player* player, uint8 protocolVersion)
 {
     if (player == nullptr || player->IsInWorld() == false)
         return;
@@ -9507,21 +12042,19 @@ void EverQuestMod::SendTrackingListToPlayer(Player* player)
         return;
     trackingState->LastScanMSTime = nowMS;
 
-    // Gather every trackable creature in range, nearest first
-    std::list<Creature*> nearbyCreatures;
-    Acore::AnyUnitInObjectRangeCheck check(player, maxTrackDistance);
-    Acore::CreatureListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(player, nearbyCreatures, check);
-    Cell::VisitObjects(player, searcher, maxTrackDistance);
     std::vector<std::pair<float, Creature*>> sortedCreatureEntries;
-    for (Creature* creature : nearbyCreatures)
+    GatherTrackingEntriesForPlayer(player, maxTrackDistance, sortedCreatureEntries);
+
+    if (protocolVersion == EQ_TRACKING_PROTOCOL_VERSION_PACKED)
     {
-        if (IsCreatureTrackableForPlayer(player, creature) == false)
-            continue;
-        sortedCreatureEntries.push_back(std::make_pair(player->GetDistance(creature), creature));
+        // A request means the addon (re)built its window, so start from a full list and keep it current with deltas for a while
+        trackingState->SentRowsByCreatureGUID.clear();
+        trackingState->SentNameIndexesByName.clear();
+        trackingState->LiveListRemainingMS = EQ_TRACKING_LIVE_LIST_DURATION_MS;
+        trackingState->LiveListPulseTimerMS = 0;
+        SendPackedTrackingListToPlayer(player, trackingState, maxTrackDistance, sortedCreatureEntries, true);
+        return;
     }
-    std::sort(sortedCreatureEntries.begin(), sortedCreatureEntries.end(), CompareTrackingEntriesByDistance);
-    if (ConfigTrackingMaxResults > 0 && sortedCreatureEntries.size() > size_t(ConfigTrackingMaxResults))
-        sortedCreatureEntries.resize(ConfigTrackingMaxResults);
 
     std::ostringstream headerPayload;
     headerPayload << "H|" << sortedCreatureEntries.size() << "|" << uint32(maxTrackDistance) << "|";
@@ -9551,6 +12084,167 @@ void EverQuestMod::SendTrackingListToPlayer(Player* player)
     SendTrackingAddonMessageToPlayer(player, "F");
 }
 
+// Printable ASCII minus the characters that chat or the addon treat specially (quote, backslash, pipe and tilde), which leaves 90 digits
+static const char TrackingPackedDigits[] = "!#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[]^_`abcdefghijklmnopqrstuvwxyz{}";
+static const uint64 TrackingPackedBase = sizeof(TrackingPackedDigits) - 1;
+
+// Fixed width, most significant digit first.  Values too big for the width are clamped to the largest it can hold
+static void AppendTrackingPackedValue(std::string& out, uint64 value, uint32 width)
+{
+    uint64 capacity = 1;
+    bool fitsAnyValue = false;
+    for (uint32 i = 0; i < width && fitsAnyValue == false; ++i)
+    {
+        if (capacity > std::numeric_limits<uint64>::max() / TrackingPackedBase)
+            fitsAnyValue = true;
+        else
+            capacity *= TrackingPackedBase;
+    }
+    if (fitsAnyValue == false && value >= capacity)
+        value = capacity - 1;
+
+    size_t startSize = out.size();
+    out.resize(startSize + width);
+    for (uint32 i = 0; i < width; ++i)
+    {
+        out[startSize + width - 1 - i] = TrackingPackedDigits[value % TrackingPackedBase];
+        value /= TrackingPackedBase;
+    }
+}
+
+// Sends the records under one message type tag, as many per message as fit under the addon message limit
+static void SendTrackingPackedRecords(Player* player, const char* messageTag, const std::vector<std::string>& records)
+{
+    static const size_t maxPayloadLength = EQ_TRACKING_ADDON_MAX_MESSAGE_LENGTH - (sizeof("EQTRACK\t") - 1);
+    std::string message;
+    for (const std::string& record : records)
+    {
+        if (message.empty() == false && message.size() + record.size() > maxPayloadLength)
+        {
+            EverQuest->SendTrackingAddonMessageToPlayer(player, message);
+            message.clear();
+        }
+        if (message.empty() == true)
+            message = messageTag;
+        message += record;
+    }
+    if (message.empty() == false)
+        EverQuest->SendTrackingAddonMessageToPlayer(player, message);
+}
+
+// Packed message stream (after the "EQTRACK\t" prefix).  Every message opens with the protocol version digit and a type letter, and numbers are fixed
+// width base-90 using TrackingPackedDigits (G is a 10 digit GUID, n is a 2 digit number):
+//   "2S<rowCount:n><maxDistance:n>[trackedGUID:G]"     a full list follows, so clear the list first
+//   "2D<rowCount:n><maxDistance:n>[trackedGUID:G]"     a delta follows, to apply on top of the current list (rowCount is the size afterwards)
+//   "2N<nameIndex:n><name>~..."                       new name table entries, since most rows share a handful of names
+//   "2R<guid:G><level:n><distance:n><nameIndex:n>..." added or changed rows, 16 characters each
+//   "2X<guid:G>..."                                   removed rows
+//   "2F"                                              end of the list or delta
+// A delta with nothing in it isn't sent at all
+void EverQuestMod::SendPackedTrackingListToPlayer(Player* player, EverQuestPlayerTrackingState* trackingState, float maxTrackDistance, const std::vector<std::pair<float, Creature*>>& sortedCreatureEntries, bool isFullList)
+{
+    // Running out of name indexes takes a very long session, and starting over is simpler than recycling them
+    if (trackingState->SentNameIndexesByName.size() + sortedCreatureEntries.size() >= EQ_TRACKING_PACKED_MAX_NAME_INDEXES)
+    {
+        trackingState->SentRowsByCreatureGUID.clear();
+        trackingState->SentNameIndexesByName.clear();
+        isFullList = true;
+    }
+
+    // Work out what differs from what the addon already shows
+    std::vector<std::string> nameRecords;
+    std::vector<std::string> rowRecords;
+    std::vector<std::string> removedRecords;
+    unordered_map<ObjectGuid, EverQuestTrackingSentRow> currentRowsByCreatureGUID;
+    for (const std::pair<float, Creature*>& creatureEntry : sortedCreatureEntries)
+    {
+        Creature* creature = creatureEntry.second;
+        auto nameIndexItr = trackingState->SentNameIndexesByName.find(creature->GetName());
+        if (nameIndexItr == trackingState->SentNameIndexesByName.end())
+        {
+            nameIndexItr = trackingState->SentNameIndexesByName.emplace(creature->GetName(), uint32(trackingState->SentNameIndexesByName.size())).first;
+            std::string nameRecord;
+            AppendTrackingPackedValue(nameRecord, nameIndexItr->second, EQ_TRACKING_PACKED_SMALL_WIDTH);
+            nameRecord += creature->GetName();
+            nameRecord += "~";
+            nameRecords.push_back(std::move(nameRecord));
+        }
+
+        EverQuestTrackingSentRow& currentRow = currentRowsByCreatureGUID[creature->GetGUID()];
+        currentRow.Level = creature->GetLevel();
+        currentRow.Distance = uint32(creatureEntry.first);
+        currentRow.NameIndex = nameIndexItr->second;
+        if (isFullList == false)
+        {
+            auto sentRowItr = trackingState->SentRowsByCreatureGUID.find(creature->GetGUID());
+            if (sentRowItr != trackingState->SentRowsByCreatureGUID.end() && sentRowItr->second.Level == currentRow.Level
+                && sentRowItr->second.Distance == currentRow.Distance && sentRowItr->second.NameIndex == currentRow.NameIndex)
+                continue;
+        }
+        std::string rowRecord;
+        AppendTrackingPackedValue(rowRecord, creature->GetGUID().GetRawValue(), EQ_TRACKING_PACKED_GUID_WIDTH);
+        AppendTrackingPackedValue(rowRecord, currentRow.Level, EQ_TRACKING_PACKED_SMALL_WIDTH);
+        AppendTrackingPackedValue(rowRecord, currentRow.Distance, EQ_TRACKING_PACKED_SMALL_WIDTH);
+        AppendTrackingPackedValue(rowRecord, currentRow.NameIndex, EQ_TRACKING_PACKED_SMALL_WIDTH);
+        rowRecords.push_back(std::move(rowRecord));
+    }
+    if (isFullList == false)
+    {
+        for (auto const& sentRow : trackingState->SentRowsByCreatureGUID)
+        {
+            if (currentRowsByCreatureGUID.find(sentRow.first) != currentRowsByCreatureGUID.end())
+                continue;
+            std::string removedRecord;
+            AppendTrackingPackedValue(removedRecord, sentRow.first.GetRawValue(), EQ_TRACKING_PACKED_GUID_WIDTH);
+            removedRecords.push_back(std::move(removedRecord));
+        }
+        if (rowRecords.empty() == true && removedRecords.empty() == true)
+            return;
+    }
+    trackingState->SentRowsByCreatureGUID = std::move(currentRowsByCreatureGUID);
+
+    std::string headerPayload = (isFullList == true) ? "2S" : "2D";
+    AppendTrackingPackedValue(headerPayload, sortedCreatureEntries.size(), EQ_TRACKING_PACKED_SMALL_WIDTH);
+    AppendTrackingPackedValue(headerPayload, uint32(maxTrackDistance), EQ_TRACKING_PACKED_SMALL_WIDTH);
+    if (trackingState->TrackedCreatureGUID.IsEmpty() == false)
+        AppendTrackingPackedValue(headerPayload, trackingState->TrackedCreatureGUID.GetRawValue(), EQ_TRACKING_PACKED_GUID_WIDTH);
+    SendTrackingAddonMessageToPlayer(player, headerPayload);
+    SendTrackingPackedRecords(player, "2N", nameRecords);
+    SendTrackingPackedRecords(player, "2R", rowRecords);
+    SendTrackingPackedRecords(player, "2X", removedRecords);
+    SendTrackingAddonMessageToPlayer(player, "2F");
+}
+
+// Keeps a packed list the addon asked for current, sending only the rows that changed since the last refresh
+void EverQuestMod::UpdatePlayerTrackingLiveList(Player* player, EverQuestPlayerTrackingState* trackingState, uint32 diffInMS)
+{
+    if (trackingState->LiveListRemainingMS == 0)
+        return;
+    if (trackingState->LiveListRemainingMS <= diffInMS)
+    {
+        trackingState->LiveListRemainingMS = 0;
+        trackingState->SentRowsByCreatureGUID.clear();
+        trackingState->SentNameIndexesByName.clear();
+        return;
+    }
+    trackingState->LiveListRemainingMS -= diffInMS;
+
+    trackingState->LiveListPulseTimerMS += diffInMS;
+    if (trackingState->LiveListPulseTimerMS < ConfigTrackingPulseIntervalInMS)
+        return;
+    trackingState->LiveListPulseTimerMS = 0;
+
+    float maxTrackDistance = GetTrackingMaxDistanceForPlayer(player);
+    if (maxTrackDistance <= 0)
+    {
+        trackingState->LiveListRemainingMS = 0;
+        return;
+    }
+    std::vector<std::pair<float, Creature*>> sortedCreatureEntries;
+    GatherTrackingEntriesForPlayer(player, maxTrackDistance, sortedCreatureEntries);
+    SendPackedTrackingListToPlayer(player, trackingState, maxTrackDistance, sortedCreatureEntries, false);
+}
+
 void EverQuestMod::StartTrackingForPlayer(Player* player, uint64 rawCreatureGUID)
 {
     if (player == nullptr || player->IsInWorld() == false)
@@ -9621,7 +12315,10 @@ void EverQuestMod::UpdatePlayerTracking(Player* player, uint32 diffInMS)
         return;
 
     EverQuestPlayerTrackingState* trackingState = player->CustomData.Get<EverQuestPlayerTrackingState>(EQ_PLAYER_CUSTOMDATA_TRACKING);
-    if (trackingState == nullptr || trackingState->TrackedCreatureGUID.IsEmpty() == true)
+    if (trackingState == nullptr)
+        return;
+    UpdatePlayerTrackingLiveList(player, trackingState, diffInMS);
+    if (trackingState->TrackedCreatureGUID.IsEmpty() == true)
         return;
 
     trackingState->PulseTimerMS += diffInMS;
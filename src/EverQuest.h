@@ -27,11 +27,19 @@
 #include "CreatureData.h"
 #include "Player.h"
 #include "Chat.h"
+#include "MoveSplineInitArgs.h"
 
+#include <atomic>
+#include <deque>
+#include <functional>
 #include <string>
 #include <list>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <set>
+#include <thread>
+#include <tuple>
 #include <unordered_set>
 
 using namespace std;
@@ -43,10 +51,15 @@ class Aura;
 class AuraApplication;
 class WorldPacket;
 class ByteBuffer;
+class KillRewarder;
 struct AreaTrigger;
 struct BuildValuesCachePosPointers;
 
 #define EQ_MOD_VERSION                              74
+#define EQ_WORLD_DATA_SNAPSHOT_MAGIC                0x44575145 // "EQWD" at the start of a world data snapshot file
+#define EQ_WORLD_DATA_SNAPSHOT_VERSION              2       // Bump whenever a snapshotted row class or container changes shape
+#define EQ_WORLD_DATA_SNAPSHOT_HEADER_SIZE          28      // Magic, snapshot version, mod version, source table checksum and payload hash
+#define EQ_WORLD_DATA_RETIRE_GRACE_TICKS            2       // World updates a replaced set of world data tables is kept before it's freed
 
 #define EQ_EQCLASS_NONE                             0
 #define EQ_EQCLASS_WARRIOR                          1
@@ -63,6 +76,7 @@ struct BuildValuesCachePosPointers;
 #define EQ_EQCLASS_WIZARD                           12
 #define EQ_EQCLASS_MAGICIAN                         13
 #define EQ_EQCLASS_ENCHANTER                        14
+#define EQ_EQCLASS_MASK_ALL                         0xFFFFFFFF  // Usable by every EQ class (also stands in for "no EQ class restriction")
 
 #define EQ_BASHKICKSTUN_BASE_CHANCE                 45
 #define EQ_BASHKICKSTUN_BASE_CHANCE_ABOVE_LEVEL_60  40
@@ -222,6 +236,9 @@ struct BuildValuesCachePosPointers;
 #define EQ_GRID_RANDOM_CENTER_POINT                 8
 #define EQ_GRID_RANDOM_PATH                         9
 
+#define EQ_SHIP_RESYNC_VIEW_RANGE_MARGIN            100.0f  // Added to the ship's visibility range when picking which players get recreated straight away, since ships are large
+#define EQ_SHIP_RESYNC_DEFERRED_CHECK_MS            1000    // How often a ship checks if any deferred players have come into range
+
 #define EQ_CREATURE_MOVEMENT_NO_CUSTOM              0      
 #define EQ_CREATURE_MOVEMENT_CUSTOM_WAYPOINT        1
 #define EQ_CREATURE_MOVEMENT_CUSTOM_ROAMING         2
@@ -244,6 +261,33 @@ struct BuildValuesCachePosPointers;
 #define EQ_MOVE_PHASE_RETURNING_FROM_AGRO           4
 
 #define EQ_MOVE_PATH_MAX_RETRY_COUNT                10
+#define EQ_MOVE_PATH_CACHE_START_TOLERANCE          2.0f    // How close (2D) to a leg's starting waypoint a creature must be to walk the cached leg
+#define EQ_MOVE_PATH_CACHE_MAX_WAYPOINT_INDEX       0x7FFF  // Waypoint indexes above this don't fit the leg key and are pathed uncached
+#define EQ_MOVE_PATH_BAKE_FILE_MAGIC                0x4C575145 // "EQWL" at the start of a baked waypoint leg file
+#define EQ_MOVE_PATH_BAKE_FILE_VERSION              1
+#define EQ_MOVE_PATH_BAKE_MAX_RANDOM_WAYPOINTS      64      // Random-target lists longer than this only bake their consecutive legs, since every pair grows as the square
+#define EQ_MOVE_PATH_BAKE_WAYPOINT_TOLERANCE        0.1f    // How far a baked leg's end may drift from the current waypoint data before it's thrown out as stale
+#define EQ_MOVE_PATH_BAKE_MAX_REPORTED_FAILURES     25      // Failed legs listed in chat by .eqpathbake, the rest only go to the log
+#define EQ_MOVE_PATH_BAKE_LEGS_PER_UPDATE           8       // Legs .eqpathbake builds per map update, so the map and the rest of the server keep ticking while it runs
+#define EQ_MOVE_PATH_BUDGET_PER_MAP_TICK            8       // Path generator runs each map allows per update for creatures starting a new wander or waypoint leg
+#define EQ_MOVE_PATH_BUDGET_WAIT_MS                 100     // How long a creature refused a path waits before asking again
+#define EQ_MOVE_PATH_BUDGET_QUEUE_STALE_MS          1000    // Waiting creatures that stop asking for this long lose their place in the queue
+#define EQ_MOVE_PATH_BACKOFF_BASE_MS                5000    // How long a failed waypoint leg is skipped after its first failure, doubled for each one after
+#define EQ_MOVE_PATH_BACKOFF_MAX_MS                 600000  // Longest a failed waypoint leg is ever skipped for
+#define EQ_MOVE_PATH_BACKOFF_MAX_TARGET_PICKS       3       // Random targets tried before waiting, when the chosen legs are all being skipped
+#define EQ_MOVE_PATH_BUDGET_REPORT_MS               5000    // How often each map copies its pathing budget out for .eqpathfailures
+#define EQ_MOVE_PATH_RETRY_BASE_MS                  100     // A creature's first retry after failing to path, doubled for each failure in a row
+#define EQ_MOVE_PATH_RETRY_MAX_MS                   10000
+#define EQ_WAYPOINT_SET_INDEX_MIN_CELL_SIZE         10.0f   // Smallest cell of a waypoint set's nearest waypoint grid
+#define EQ_WAYPOINT_SET_INDEX_WAYPOINTS_PER_CELL    2.0f    // Cells are sized for about this many waypoints each, on average
+#define EQ_WAYPOINT_SET_INDEX_MAX_CELLS_PER_SIDE    256
+#define EQ_MOVE_TERRAIN_Z_CACHE_MAX_ENTRIES         8192    // Per map and generation, a full generation is retired and the one before it dropped
+#define EQ_MOVE_TERRAIN_Z_CACHE_STATS_FLUSH_COUNT   1024    // Lookups a map counts on its own before adding them to the shared stats
+#define EQ_MOVE_TERRAIN_Z_CACHE_CELL_SIZE           0.25f   // Lookups are snapped to cells this size on each axis, and resolved once at the cell's center
+#define EQ_MOVE_TERRAIN_Z_CACHE_KIND_LIQUID         0       // Liquid status and level at a point
+#define EQ_MOVE_TERRAIN_Z_CACHE_KIND_FLOOR_FROM_DRY 1       // Stepped floor search when the prior point was dry
+#define EQ_MOVE_TERRAIN_Z_CACHE_KIND_FLOOR_FROM_WET 2       // Stepped floor search when the prior point was in water
+#define EQ_MOVE_TERRAIN_Z_CACHE_KIND_FLOOR_IN_BAND  3       // Single floor search inside a roam Z band
 
 #define EQ_FORAGE_TYPE_FOOD                         0
 #define EQ_FORAGE_TYPE_DRINK                        1
@@ -263,20 +307,45 @@ struct BuildValuesCachePosPointers;
 #define EQ_CREATURE_CUSTOMDATA_AGGROPOSITION        "EQAggroPos"
 #define EQ_CREATURE_CUSTOMDATA_AGROZBLOCK           "EQAgroZBlock"
 #define EQ_CREATURE_CUSTOMDATA_FEARDIMINISH         "EQFearDiminish"
+#define EQ_CREATURE_CUSTOMDATA_CROWDCONTROLTARGETS  "EQCrowdControlTargets"
+
+#define EQ_MAP_CUSTOMDATA_DEFENDBROKER              "EQDefendBroker"
+#define EQ_MAP_CUSTOMDATA_SOCIALAGGROSCAN           "EQSocialAggroScan"
+#define EQ_MAP_CUSTOMDATA_TERRAINZCACHE             "EQTerrainZCache"
+#define EQ_MAP_CUSTOMDATA_WAYPOINTLEGBAKE           "EQWaypointLegBake"
+#define EQ_MAP_CUSTOMDATA_PATHINGBUDGET             "EQPathingBudget"
 
 #define EQ_AGRO_Z_BLOCK_SUPPRESS_MS                 2000
 
 #define EQ_DEFEND_PLAYERS_CHECK_MS                  2000
 #define EQ_DEFEND_PLAYERS_SEARCH_RADIUS             15.0f
+#define EQ_DEFEND_PLAYERS_BUCKET_SEARCH_RADIUS      (EQ_DEFEND_PLAYERS_SEARCH_RADIUS * 2.5f) // Reaches every defender in range of any player in a search-radius sized bucket
 
+#define EQ_UNIT_CUSTOMDATA_HASTELEDGER              "EQHasteLedger"
 #define EQ_PLAYER_CUSTOMDATA_TRACKING               "EQTracking"
+#define EQ_PLAYER_CUSTOMDATA_BARDPULSE              "EQBardPulse"
+#define EQ_PLAYER_CUSTOMDATA_BARDSONGS              "EQBardSongs"
+#define EQ_TRANSPORT_CUSTOMDATA_SHIPTRIGGERCURSOR   "EQShipTriggerCursor"
+#define EQ_BARD_PULSE_LOS_CACHE_MS                  1000    // How long a bard's line of sight result to one unit is reused across song pulses
+#define EQ_BARD_PULSE_FACTION_CACHE_MS              5000    // How long a bard's reputation standing against one faction template is reused
 #define EQ_TRACKING_ADDON_ROWS_PER_MESSAGE          4       // List rows batched per addon message to stay under client chat limits
 #define EQ_TRACKING_LOST_DISTANCE_MULTIPLIER        1.25f   // Fraction of max track distance a tracked creature can stray before the trail goes cold
 #define EQ_TRACKING_FOUND_DISTANCE                  15.0f   // Within this many yards, the tracked creature counts as found
 #define EQ_TRACKING_SCAN_MIN_INTERVAL_MS            2000    // Minimum time between track scans for one player (guards against command spam)
+#define EQ_TRACKING_PROTOCOL_VERSION_TEXT           1       // Original "H|R|F" text rows, a few per message
+#define EQ_TRACKING_PROTOCOL_VERSION_PACKED         2       // Fixed width base-90 rows packed to the message limit, with delta refreshes
+#define EQ_TRACKING_ADDON_MAX_MESSAGE_LENGTH        255     // Longest addon message (prefix included) the client will accept
+#define EQ_TRACKING_PACKED_GUID_WIDTH               10      // Base-90 digits needed to hold a 64 bit GUID
+#define EQ_TRACKING_PACKED_SMALL_WIDTH              2       // Base-90 digits for level, distance, counts and name indexes (0 - 8099)
+#define EQ_TRACKING_PACKED_MAX_NAME_INDEXES         8100    // Name table is reset (forcing a full list) when it would outgrow the small field width
+#define EQ_TRACKING_SNAPSHOT_REFRESH_MS             2000    // How often a map's shared track candidate snapshot is rebuilt (only when someone tracks)
+#define EQ_TRACKING_SNAPSHOT_MOVE_SLACK             20.0f   // Extra yards read around a tracker, covering creatures that moved since the snapshot was taken
+#define EQ_TRACKING_LIVE_LIST_DURATION_MS           30000   // How long a packed list request keeps sending delta refreshes, so the addon renews it while its window is open
 
 #define EQ_AGILE_FIGHTER_REFRESH_INTERVAL_MS        2000    // How often to scan for gear changes since some forms of unequip have no hook
 
+#define EQ_LOGIN_DATA_EXPIRY_MS                     60000   // Loaded login data for a character that never entered the world is dropped after this long
+
 // Vulak`Aerr (Temple of Veeshan) spawns perma-rooted and "locked" (unattackable, non-aggro) until every required dragon is dead, matching Velious-era EQ
 #define EQ_VULAK_CREATURE_TEMPLATE_ID               55045
 #define EQ_VULAK_LOCK_RECHECK_MS                    3000
@@ -475,6 +544,11 @@ public:
     uint32 EnrageCooldownRemainingMS = 0;
     uint32 SpecialAttackTimerRemainingMS = 0;
     uint32 ActiveSwingDamageModPct = 100;
+    std::string EnrageStartEmoteText;                   // Emote texts only depend on the creature name, so they are built once at setup
+    std::string EnrageEndEmoteText;
+    std::string RampageEmoteText;
+    std::string WildRampageEmoteText;
+    vector<ObjectGuid> ScratchHatedUnitGUIDs;           // Reused hate list snapshot for rampage and wild rampage, so a tick doesn't allocate
 };
 
 class EverQuestCreatureSummonState : public DataMap::Base
@@ -500,6 +574,25 @@ public:
     uint32 RecallTimerMS = 0;
 };
 
+// Every living creature around a caller in a cell this tick, which later callers in the same cell filter with their own assist check
+class EverQuestSocialAggroCellScan
+{
+public:
+    float CenterX = 0;
+    float CenterY = 0;
+    float CenterZ = 0;
+    float ScanRadius = 0;
+    vector<ObjectGuid> CreatureGUIDs;
+};
+
+// Held in the map's own data, since only that map's update thread pulls creatures on it
+class EverQuestSocialAggroMapScanCache : public DataMap::Base
+{
+public:
+    uint64 ScanGameTimeMS = 0;
+    unordered_map<uint64, EverQuestSocialAggroCellScan> ScansByCellKey;
+};
+
 class EverQuestCreatureAggroPositionState : public DataMap::Base
 {
 public:
@@ -518,6 +611,13 @@ public:
     uint32 ResetWindowInMS = 0;
 };
 
+// Players this creature has landed crowd control on, so its death only has to visit them
+class EverQuestCreatureCrowdControlTargetsState : public DataMap::Base
+{
+public:
+    unordered_set<ObjectGuid> PlayerGUIDs;
+};
+
 class EverQuestCreatureAgroZBlockState : public DataMap::Base
 {
 public:
@@ -631,6 +731,30 @@ public:
     uint32 RefreshTimerMS = 0;
 };
 
+class EverQuestTrackingSentRow
+{
+public:
+    uint32 Level = 0;
+    uint32 Distance = 0;
+    uint32 NameIndex = 0;
+};
+
+class EverQuestTrackingCandidate
+{
+public:
+    ObjectGuid CreatureGUID;
+    float X = 0;
+    float Y = 0;
+};
+
+// Every creature on a map that could show up in a track list, bucketed by grid cell. Built once per refresh interval and read by all trackers on the map
+class EverQuestTrackingMapSnapshot
+{
+public:
+    uint64 BuiltMSTime = 0;
+    unordered_map<uint32, vector<EverQuestTrackingCandidate>> CandidatesByCellID;
+};
+
 class EverQuestPlayerTrackingState : public DataMap::Base
 {
 public:
@@ -639,6 +763,53 @@ public:
     float MaxTrackDistance = 0;
     uint32 PulseTimerMS = 0;
     uint64 LastScanMSTime = 0;
+    uint32 LiveListRemainingMS = 0;
+    uint32 LiveListPulseTimerMS = 0;
+    unordered_map<ObjectGuid, EverQuestTrackingSentRow> SentRowsByCreatureGUID;   // What the addon's packed list currently shows, the baseline for delta refreshes
+    unordered_map<std::string, uint32> SentNameIndexesByName;
+};
+
+class EverQuestBardPulseTargetSet
+{
+public:
+    int TargetType = 0;
+    uint32 Radius = 0;
+    vector<ObjectGuid> TargetGUIDs;
+};
+
+class EverQuestBardPulseLOSResult
+{
+public:
+    bool IsInLOS = false;
+    uint32 ExpireGameTimeMS = 0;
+};
+
+class EverQuestBardPulseFactionStanding
+{
+public:
+    bool HasReputation = false;         // False when the template or its parent faction has no reputation row, which leaves the call to IsValidAttackTarget
+    bool IsEnemyByReputation = false;
+    bool IsFriendlyByReputation = false;
+    uint32 ExpireGameTimeMS = 0;
+};
+
+// Lives on the bard, so only the bard's map thread ever touches it
+class EverQuestPlayerBardPulseState : public DataMap::Base
+{
+public:
+    uint32 TargetSetsGameTimeMS = 0;
+    vector<EverQuestBardPulseTargetSet> TargetSetsThisTick;     // Area song targets already gathered this world tick, reused by other songs of the same type and radius
+    unordered_map<ObjectGuid, EverQuestBardPulseLOSResult> LOSResultsByUnitGUID;
+    unordered_map<uint32, EverQuestBardPulseFactionStanding> FactionStandingsByFactionTemplateID;
+};
+
+// Songs a bard has running, oldest first, in a ring sized to ConfigBardMaxConcurrentSongs.  Lives on the bard, so only the bard's map thread touches it
+class EverQuestPlayerBardSongRingState : public DataMap::Base
+{
+public:
+    vector<uint32> SongSpellIDs;
+    uint32 HeadIndex = 0;
+    uint32 Count = 0;
 };
 
 class EverQuestPet
@@ -764,6 +935,27 @@ public:
     uint32 TriggerActivateNodeID = 0;
 };
 
+// Where a ship is along its node-sorted triggers, kept on the ship since only its map's thread relocates it.  The cursor stays on a node's
+// triggers for as long as the ship sits on that node, so each relocate there fires them again, and only moves past them once the ship moves on
+class EverQuestShipTriggerCursor : public DataMap::Base
+{
+public:
+    uint32 WorldDataGeneration = 0;
+    size_t NextTriggerIndex = 0;
+    uint32 LastNodeID = 0;
+    bool HasLastNode = false;
+};
+
+class EverQuestTransportResyncStats
+{
+public:
+    std::atomic<uint64> ResyncsTriggered{ 0 };
+    std::atomic<uint64> RecreatesSent{ 0 };             // Destroy and create pairs sent as the resync happened
+    std::atomic<uint64> PlayersDeferred{ 0 };           // Out of view when the resync happened, so left until they come into range
+    std::atomic<uint64> DeferredRecreatesSent{ 0 };
+    std::atomic<uint64> DeferredPlayersDropped{ 0 };    // Left the map before ever needing the recreate
+};
+
 class EverQuestCreatureInstance
 {
 public:
@@ -797,6 +989,183 @@ public:
     uint32 PauseInSec = 0;
 };
 
+// One waypoint list, built once at load and only ever read after that, so every creature walking it shares the same copy
+class EverQuestCreatureWaypointSet
+{
+public:
+    vector<EverQuestCreatureWaypoint> Waypoints;
+
+    // Uniform 2D grid over the list's bounds for nearest waypoint queries.  Cell N holds the waypoint indexes from
+    // IndexCellStarts[N] up to IndexCellStarts[N + 1] in IndexWaypointIndexes
+    float IndexMinX = 0;
+    float IndexMinY = 0;
+    float IndexCellSize = EQ_WAYPOINT_SET_INDEX_MIN_CELL_SIZE;
+    uint32 IndexCellCountX = 0;
+    uint32 IndexCellCountY = 0;
+    vector<uint32> IndexCellStarts;
+    vector<uint32> IndexWaypointIndexes;
+};
+
+// A finished, Z-snapped spline between two waypoints of a list, shared by every creature on the map walking that list
+class EverQuestCachedWaypointLeg
+{
+public:
+    Movement::PointsArray Points;
+    float TerrainSnappedTargetZ = 0;
+    vector<uint32> GridIDs;
+};
+
+class EverQuestWaypointLegMapCache
+{
+public:
+    unordered_map<uint64, EverQuestCachedWaypointLeg> LegsByKey;
+    unordered_map<uint32, vector<uint64>> LegKeysByGridID;     // So a grid unload only drops the legs that cross it
+};
+
+class EverQuestWaypointLegCacheStats
+{
+public:
+    uint64 Hits = 0;
+    uint64 Misses = 0;
+    uint64 Stores = 0;
+    uint64 InvalidatedLegs = 0;
+    uint64 CachedLegCount = 0;
+    uint64 CachedBytes = 0;
+    uint64 BakedHits = 0;
+    uint64 BakedLegCount = 0;
+};
+
+// The quantized inputs of a terrain lookup, kept with its result so two cells that hash alike are never mistaken for each other.  Z is
+// snapped too so a bridge and the ground under it stay apart
+class EverQuestTerrainZCacheLookup
+{
+public:
+    int32 CellX = 0;
+    int32 CellY = 0;
+    int32 CellZ = 0;
+    float CollisionHeight = 0;
+    float BandHeight = 0;
+    uint32 PhaseMask = 0;
+    uint8 Kind = 0;
+};
+
+class EverQuestTerrainZCacheEntry
+{
+public:
+    EverQuestTerrainZCacheLookup Lookup;
+    float Z = 0;                // Floor height, or the liquid level
+    bool Found = false;         // Liquid status, unused for floors
+    uint8 HeightQueryCount = 0; // Map queries a hit on this entry saves
+};
+
+// Held in the map's own data, since only that map's update thread moves its creatures.  Two generations stand in for least recently used
+// order: hits in the older one are carried into the current one, and whatever is still only in the older one when the current fills is dropped
+class EverQuestTerrainZMapCache : public DataMap::Base
+{
+public:
+    unordered_map<uint64, EverQuestTerrainZCacheEntry> CurrentEntriesByKey;
+    unordered_map<uint64, EverQuestTerrainZCacheEntry> PreviousEntriesByKey;
+    uint32 PendingLookups = 0;
+    uint64 PendingHits = 0;
+    uint64 PendingMisses = 0;
+    uint64 PendingHeightQueriesAvoided = 0;
+    uint64 PendingEvictions = 0;
+    int64 PendingEntryCountChange = 0;
+};
+
+class EverQuestTerrainZCacheStats
+{
+public:
+    uint64 Hits = 0;
+    uint64 Misses = 0;
+    uint64 HeightQueriesAvoided = 0;
+    uint64 Evictions = 0;
+    uint64 EntryCount = 0;
+    uint64 MinuteStartMSTime = 0;
+    uint64 MinuteHits = 0;
+    uint64 MinuteHeightQueriesAvoided = 0;
+    uint64 LastMinuteHits = 0;
+    uint64 LastMinuteHeightQueriesAvoided = 0;
+};
+
+class EverQuestFailedWaypointLeg
+{
+public:
+    uint32 FailCount = 0;
+    uint64 LastFailMSTime = 0;
+    uint64 NextAttemptMSTime = 0;
+};
+
+// Shares out each map's path generator runs per update, and remembers the waypoint legs it couldn't path.  Only the map's own update thread
+// touches it, and a copy is reported out every EQ_MOVE_PATH_BUDGET_REPORT_MS for .eqpathfailures
+class EverQuestPathingMapBudget : public DataMap::Base
+{
+public:
+    uint32 MapID = 0;
+    uint32 InstanceID = 0;
+    uint32 WorldDataGeneration = 0;                         // The failed legs are keyed into these tables, so a reload starts them over
+    uint64 LastReportMSTime = 0;
+    uint64 TickMSTime = 0;
+    uint32 PathsThisTick = 0;
+    deque<std::pair<ObjectGuid, uint64>> WaitingCreatures;    // Creature GUID and when it last asked, in the order they first asked
+    uint64 PathsBuilt = 0;
+    uint64 Deferrals = 0;
+    uint64 WaypointLegFailures = 0;
+    uint64 RoamPathFailures = 0;
+    unordered_map<uint64, EverQuestFailedWaypointLeg> FailedWaypointLegsByLegKey;
+};
+
+class EverQuestDataTableLoader
+{
+public:
+    string Name;
+    std::function<void()> Load;
+    std::function<size_t()> GetLoadedEntryCount;
+    vector<string> DependsOnNames;  // Loaders that must finish first, as this one reads what they load
+};
+
+class EverQuestWaypointLegBakeResult
+{
+public:
+    uint32 WaypointListCount = 0;
+    uint32 BakedLegCount = 0;
+    uint32 FallbackLegCount = 0;    // No navmesh path, so the leg is the same straight line the AI would have walked
+    uint32 SkippedListCount = 0;    // No walker could be brought into the world, so the list kept whatever legs it had baked before
+    vector<string> FailedLegs;
+};
+
+// A waypoint list in the map's spawn data, baked from whichever of its walkers are in the world once their grids have been loaded
+class EverQuestWaypointLegBakeList
+{
+public:
+    uint32 WaypointListID = 0;
+    vector<uint32> SpawnIDs;
+    bool AreGridsLoaded = false;
+};
+
+class EverQuestWaypointLegBakeLeg
+{
+public:
+    ObjectGuid WalkerGUID;
+    uint32 FromWaypointIndex = 0;
+    uint32 ToWaypointIndex = 0;
+};
+
+// A running .eqpathbake, stepped a few legs at a time by the map's own update so nothing waits on it.  Legs it builds are merged over the
+// ones already baked for the map, so lists it couldn't reach keep theirs
+class EverQuestWaypointLegBakeJob : public DataMap::Base
+{
+public:
+    ObjectGuid RequesterGUID;
+    string BakeFilePath;            // Copied when the bake starts, so a config reload while it runs can't move where it saves
+    vector<EverQuestWaypointLegBakeList> Lists;
+    size_t NextListIndex = 0;
+    vector<EverQuestWaypointLegBakeLeg> PendingLegs;
+    size_t NextLegIndex = 0;
+    unordered_map<uint64, EverQuestCachedWaypointLeg> BakedLegsByKey;
+    EverQuestWaypointLegBakeResult Result;
+};
+
 class EverQuestAutoLearnSpell
 {
 public:
@@ -847,17 +1216,39 @@ public:
 
 // Mirror of the group totals that KillRewarder builds in _InitGroupData, but gathered for every group member in the zone
 // instead of only those inside the core's group reward distance
+struct EverQuestZoneWideKillRewardMember
+{
+    ObjectGuid MemberGUID;
+    uint8 Level = 0;
+    float ExperienceRate = 1.0f;
+};
+
 struct EverQuestZoneWideKillReward
 {
     bool IsValid = false;
     uint32 AliveMemberCount = 0;
     uint32 AliveSumLevel = 0;
     uint8 MaxLevel = 0;
-    Player* MaxNotGrayMember = nullptr;
+    ObjectGuid MaxNotGrayMemberGUID;
     uint8 MaxNotGrayMemberLevel = 0;
     bool IsFullXP = false;
     uint32 BaseExperience = 0;
     float GroupRate = 1.0f;
+    vector<EverQuestZoneWideKillRewardMember> Members;     // Every member in the zone for the kill, with the experience rate worked out once
+};
+
+// Online members of a group bucketed by the map instance they're in, rebuilt after any membership, login, logout or map change for the group.  The
+// reward for the kill being paid out is kept too, since the core asks for it once per member it rewards.  Only GUIDs are kept, since members
+// on other maps are updated by other threads, and each is looked up again on the map of the kill
+class EverQuestZoneWideGroupMemberCache
+{
+public:
+    bool IsBuilt = false;
+    unordered_map<uint64, vector<ObjectGuid>> MemberGUIDsByMapInstanceKey;
+    KillRewarder const* LastKillRewarder = nullptr;
+    ObjectGuid LastKillVictimGUID;
+    uint64 LastKillDeathSerial = 0;                     // A later kill of the same respawned victim can reuse the rewarder's stack address, but never the serial
+    EverQuestZoneWideKillReward LastKillReward;
 };
 
 class EverQuestFaction
@@ -889,7 +1280,25 @@ struct EverQuestPlayerTempFactionBonus
 class EverQuestCreatureDefendPlayerWatchState : public DataMap::Base
 {
 public:
-    uint32 RecheckTimerMS = 0;
+    ObjectGuid RegisteredPlayerGUID;
+};
+
+// Every creature-on-player fight on a map that defenders could answer, swept once per check interval for all attackers together.
+// Held in the map's own data, since only that map's update thread registers fights and sweeps them
+class EverQuestDefendMapBroker : public DataMap::Base
+{
+public:
+    uint64 LastSweepMSTime = 0;
+    unordered_map<ObjectGuid, ObjectGuid> AttackedPlayerGUIDByAttackerGUID;
+    unordered_set<ObjectGuid> NewAttackerGUIDs;     // Registered since the last sweep, answered on the next map update instead of waiting out the interval
+};
+
+class EverQuestDefendCandidate
+{
+public:
+    Player* AttackedPlayer = nullptr;
+    vector<Creature*> Attackers;
+    unordered_map<uint32, bool> IsFriendlyByDefenderFactionTemplateID;
 };
 
 struct EverQuestPlayerControllerData
@@ -904,6 +1313,35 @@ struct EverQuestPlayerControllerData
     bool HideWoWGear = false;
 };
 
+// Every mod-owned per-character row that OnPlayerLogin reads. The queries are issued asynchronously when the client asks to enter the world
+// (alongside the core's own login holder), so the character finishes loading with all of this already resident instead of blocking the world thread.
+// Never changed once the load is ready, so readers can keep their shared copy after the lock is released
+class EverQuestPlayerLoginData
+{
+public:
+    bool HasControllerRow = false;
+    EverQuestPlayerControllerData ControllerData;
+    map<uint8, uint8> SavedClassLevelsByClass;
+    bool HasBindHome = false;
+    uint32 BindHomeMapID = 0;
+    float BindHomeX = 0;
+    float BindHomeY = 0;
+    float BindHomeZ = 0;
+    bool AccountEarnedAdventurerAchievement = false;
+};
+
+// One in-flight or finished login data load.  The query callbacks hold their own reference to Data, so the load can be dropped at any time
+class EverQuestPlayerLoginDataLoad
+{
+public:
+    vector<QueryCallback> PendingQueryCallbacks;
+    uint32 IssuedMSTime = 0;
+    uint32 ReadyMSTime = 0;
+    std::shared_ptr<EverQuestPlayerLoginData> Data;
+
+    bool IsReady() const { return PendingQueryCallbacks.empty(); }
+};
+
 class EverQuestPlayerClassInfoItem
 {
 public:
@@ -931,6 +1369,17 @@ struct EverQuestUnitHasteAuraEffect
     uint32 HasteType;
 };
 
+// Positive EQ haste effects on one unit.  Lives on the unit, so only the unit's map thread touches it
+class EverQuestUnitHasteLedgerState : public DataMap::Base
+{
+public:
+    uint32 NextApplySequence = 1;
+    map<uint32, EverQuestUnitHasteAuraEffect> EffectsByApplySequence;                   // Apply order, which the cap clamping walks
+    map<tuple<uint32, ObjectGuid, uint8>, uint32> ApplySequencesByEffect;               // Keyed by spell ID, caster and effect index
+    set<pair<int32, uint32>> RankedEffectsByAuraTypeSlotThenHasteType[2][4];            // (-natural amount, apply sequence), so the first entry is the strongest and oldest
+    uint32 WinnerApplySequenceByAuraTypeSlotThenHasteType[2][4] = {};                   // 0 = no winner
+};
+
 class EverQuestClassMap
 {
 public:
@@ -940,6 +1389,56 @@ public:
     uint32 EQClassIDEligibleSecondMask;
 };
 
+// Every static table loaded from the mod_everquest_* world tables.  Built in full before it is published, and never written once readers can
+// see it, so a reload swaps in a whole new set instead of touching the live one
+class EverQuestWorldData
+{
+public:
+    unordered_map<uint32, EverQuestCreature> CreaturesByTemplateID;
+    unordered_map<uint32, list<EverQuestCreatureOnkillReputation>> CreatureOnkillReputationsByCreatureTemplateID;
+    unordered_map<uint32, vector<EverQuestCreatureKillSpawn>> CreatureKillSpawnsByTriggerCreatureTemplateID;
+    unordered_set<uint32> EvadeKillSpawnTriggerCreatureTemplateIDs;
+    unordered_map<uint32, uint32> OocTimerKillSpawnDurationMSByCreatureTemplateID;
+    unordered_map<uint32, vector<EverQuestCreatureEmote>> CreatureEmotesByCreatureTemplateID;
+    unordered_map<uint32, EverQuestCreatureMovementSound> CreatureMovementSoundsByDisplayID;
+    unordered_map<uint32, uint32> SilentFidgetDisplayIDsByDisplayID;
+    unordered_map<uint32, EverQuestItemTemplate> ItemTemplatesByEntryID;
+    uint32 ItemEQClassMaskBaseItemTemplateID = 0;
+    vector<uint32> ItemEQClassMasksByItemTemplateIDOffset;
+    unordered_map<uint64, vector<EverQuestGearSwapCandidate>> GearSwapCandidatesByLookupKey;
+    unordered_set<uint32> WornEffectSpellIDs;
+    unordered_map<uint32, EverQuestSpell> SpellDataBySpellID;
+    unordered_set<uint32> BardSongTickSpellIDs;
+    unordered_map<uint64, uint32> IllusionDisplayIDsByLookupKey;
+    unordered_map<uint64, uint32> IllusionFaceDisplayIDsByLookupKey;
+    uint32 IllusionMaxFaceIndex = 0;
+    unordered_set<uint32> IllusionFormSpellIDs;
+    unordered_map<uint32, list<EverQuestQuestCompletionReputation>> QuestCompletionReputationsByQuestTemplateID;
+    unordered_map<uint32, list<EverQuestQuestReaction>> QuestReactionListByQuestTemplateID;
+    unordered_map<uint32, vector<EverQuestGossipReaction>> GossipReactionsByGossipCreatureTemplateID;
+    unordered_map<uint32, EverQuestPet> PetDataByCreatureTemplateID;
+    unordered_map<uint8, unordered_map<uint8, EverQuestPlayerCreateInfo>> PlayerCreateInfoByRaceIDThenClassID;
+    unordered_map<uint8, list<uint32>> PlayerAutoLearnSkillsByEQClassID;
+    unordered_map<uint8, list<EverQuestAutoLearnSpell>> PlayerAutoLearnSpellsByClassID;
+    unordered_map<uint32, EverQuestCreatureSpawnPoint> CreatureSpawnPointsByCreatureGUID;
+    unordered_map<uint32, unordered_map<uint32, EverQuestCycleSpawnGroup>> CycleSpawnGroupsByMapIDThenSpawnGroupID;
+    unordered_map<uint32, vector<EverQuestCreatureLootGroup>> CreatureLootGroupsByCreatureTemplateID;
+    unordered_map<uint32, vector<EverQuestTransportShipTrigger>> ShipTriggersByTriggeringGameObjectTemplateEntryID;   // Each sorted by triggering node
+    unordered_map<uint32, int> ShipWaitNodesByGameObjectTemplateEntryID;
+    unordered_map<uint32, EverQuestCreatureInstance> CreatureInstancesByCreatureGUID;
+    unordered_map<uint32, unordered_map<uint32, EverQuestCreatureWaypointSet>> CreatureWaypointSetsByMapIDAndWaypointID;
+    unordered_map<uint32, vector<EverQuestForageZoneItem>> ForageZoneItemsByMapID;
+    unordered_map<uint32, uint32> ForageZoneItemTotalChanceByMapID;
+    unordered_map<uint32, EverQuestZoneSafePoint> ZoneSafePointByMapID;
+    unordered_map<uint32, EverQuestZone> ZoneByMapID;
+    unordered_set<uint32> InstanceRaidLowMapIDs;
+    unordered_map<uint32, uint32> OpenWorldMapIDByInstanceRaidLowMapID;
+    unordered_map<uint32, EverQuestFaction> FactionsByFactionTemplateID;
+    unordered_set<uint32> DefendCombatFactionTemplateIDs;
+    unordered_map<uint32, EverQuestReputationFactionInfo> EQReputationFactionInfoByFactionID;
+    unordered_map<uint8, EverQuestClassMap> ClassMapByWOWClassID;
+};
+
 class EverQuestMod
 {
 private:
@@ -948,6 +1447,23 @@ private:
     unordered_map<ObjectGuid, uint64> PendingEquipmentStorageCommitMSByGUID;
     std::mutex PendingStorageTransactionMutex;
     unordered_map<ObjectGuid, TransactionCallback> PendingStorageTransactionCallbacksByGUID;
+    std::mutex PlayerLoginDataMutex;
+    unordered_map<ObjectGuid, EverQuestPlayerLoginDataLoad> PlayerLoginDataByGUID;
+    unordered_map<uint32, ObjectGuid> PendingLoginDataRequestsByAccountID;         // Filled from the network threads, started on the world thread
+
+    // Readers only ever see the published tables, through one acquire load.  Replaced ones are retired for EQ_WORLD_DATA_RETIRE_GRACE_TICKS
+    // world updates before they're freed, and a reload builds its tables on WorldDataReloadThread until the world thread publishes them
+    std::unique_ptr<EverQuestWorldData> CurrentWorldData{ new EverQuestWorldData() };
+    std::atomic<const EverQuestWorldData*> PublishedWorldData{ CurrentWorldData.get() };
+    std::atomic<uint32> WorldDataGeneration{ 0 };
+    vector<pair<uint64, std::unique_ptr<EverQuestWorldData>>> RetiredWorldData;    // Paired with the world update tick they were retired on
+    uint64 WorldUpdateTickCount = 0;
+    std::mutex WorldDataReloadMutex;
+    std::thread WorldDataReloadThread;
+    std::unique_ptr<EverQuestWorldData> ReloadedWorldData;
+    unordered_map<uint32, unordered_map<uint64, EverQuestCachedWaypointLeg>> ReloadedBakedWaypointLegs;   // Read and checked against ReloadedWorldData by the reload thread
+    bool WorldDataReloadRunning = false;
+    bool WorldDataReloadReady = false;
 
 public:
     bool IsEnabled;
@@ -1071,6 +1587,9 @@ public:
     uint32 ConfigTrackingPulseIntervalInMS;
     bool ConfigSpellSummonPlayerAcrossZones;
     bool ConfigGroupZoneWideLootAndExperienceEnabled;
+    string ConfigPathingBakedWaypointLegFile;
+    uint32 ConfigStartupDataLoadThreadCount;
+    string ConfigStartupDataSnapshotFile;
 
     unordered_set<uint32> CrossClassExemptSpellIDs;
     unordered_set<uint32> RacialSpellIDs;
@@ -1084,77 +1603,46 @@ public:
     // owning entity's thread.
     std::mutex RuntimeStateMutex;
 
-    unordered_map<uint32, EverQuestCreature> CreaturesByTemplateID;
-    unordered_map<uint32, list<EverQuestCreatureOnkillReputation>> CreatureOnkillReputationsByCreatureTemplateID;
-    unordered_map<uint32, vector<EverQuestCreatureKillSpawn>> CreatureKillSpawnsByTriggerCreatureTemplateID;
-    unordered_set<uint32> EvadeKillSpawnTriggerCreatureTemplateIDs;
-    unordered_map<uint32, uint32> OocTimerKillSpawnDurationMSByCreatureTemplateID;
     unordered_map<uint32, vector<ObjectGuid::LowType>> VulakRequiredDragonSpawnIDsByMapID; // Keyed by map ID, since the raid instance copy of the zone has its own dragon spawn rows
-    unordered_map<uint32, vector<EverQuestCreatureEmote>> CreatureEmotesByCreatureTemplateID;
-    unordered_map<uint32, EverQuestCreatureMovementSound> CreatureMovementSoundsByDisplayID;
-    unordered_map<uint32, uint32> SilentFidgetDisplayIDsByDisplayID;
 
     std::mutex PendingKillSpawnActionsMutex;
     unordered_map<uint64, vector<EverQuestPendingKillSpawnAction>> PendingKillSpawnActionsByMapInstanceKey;
     unordered_map<uint64, vector<EverQuestTriggeredQuestKillSpawn>> TriggeredQuestKillSpawnsByMapInstanceKey;
-    unordered_map<uint32, EverQuestItemTemplate> ItemTemplatesByEntryID;
-    unordered_map<uint64, vector<EverQuestGearSwapCandidate>> GearSwapCandidatesByLookupKey;
-    unordered_set<uint32> WornEffectSpellIDs;
-    unordered_map<uint32, EverQuestSpell> SpellDataBySpellID;
-    unordered_set<uint32> BardSongTickSpellIDs;
-    unordered_map<uint64, uint32> IllusionDisplayIDsByLookupKey;
-    unordered_map<uint64, uint32> IllusionFaceDisplayIDsByLookupKey;
-    uint32 IllusionMaxFaceIndex;
-    unordered_set<uint32> IllusionFormSpellIDs;
+    unordered_set<ObjectGuid> PlayersWithBardPulseHidden;
+    std::atomic<uint32> PlayersWithBardPulseHiddenCount{ 0 };
     unordered_map<ObjectGuid, EverQuestPlayerIllusionState> PlayerIllusionStatesByPlayerGUID;
-    unordered_map<uint32, list<EverQuestQuestCompletionReputation>> QuestCompletionReputationsByQuestTemplateID;
-    unordered_map<uint32, list<EverQuestQuestReaction>> QuestReactionListByQuestTemplateID;
-    unordered_map<uint32, vector<EverQuestGossipReaction>> GossipReactionsByGossipCreatureTemplateID;
-    unordered_map<uint32, EverQuestPet> PetDataByCreatureTemplateID;
-    unordered_map<uint8, unordered_map<uint8, EverQuestPlayerCreateInfo>> PlayerCreateInfoByRaceIDThenClassID;
-    unordered_map<uint8, list<uint32>> PlayerAutoLearnSkillsByEQClassID;
-    unordered_map<uint8, list<EverQuestAutoLearnSpell>> PlayerAutoLearnSpellsByClassID;
     unordered_map<uint64, unordered_map<int, vector<Creature*>>> AllLoadedCreaturesByMapInstanceKeyThenCreatureEntryID;
-    unordered_map<uint32, EverQuestCreatureSpawnPoint> CreatureSpawnPointsByCreatureGUID;
     unordered_map<uint64, unordered_map<uint32, vector<Creature*>>> AllLoadedCreaturesByMapInstanceKeyThenSpawnPointID;
     unordered_map<uint64, unordered_map<uint32, vector<Creature*>>> AllLoadedCreaturesByMapInstanceKeyThenSpawnGroupID;
-    unordered_map<uint32, unordered_map<uint32, EverQuestCycleSpawnGroup>> CycleSpawnGroupsByMapIDThenSpawnGroupID;
     unordered_map<uint32, int32> CycleSpawnCheckTimerInMSByMapID;
     uint32 RestrictedMapCheckTimerInMS = 0;
     unordered_map<ObjectGuid, EverQuestPlayerClientVersionCheckState> PendingClientVersionChecksByPlayerGUID;
-    unordered_map<ObjectGuid, deque<uint32>> PlayerCasterConcurrentBardSongs;
     unordered_set<ObjectGuid> PlayersWithAuctionUsableFilterActive;
     unordered_set<ObjectGuid> PlayersGainingExperience;
     unordered_set<ObjectGuid> PlayersPendingLevelCapExperiencePark;
-    unordered_map<uint64, unordered_map<ObjectGuid, vector<EverQuestUnitHasteAuraEffect>>> EQHasteAuraEffectsByMapInstanceKeyThenUnitGUID; // Map-instance keyed since creature GUIDs repeat across instance copies of a map
     unordered_map<ObjectGuid, uint32> BearFormShieldArmorShiftAmountByPlayerGUID;
     unordered_map<ObjectGuid, uint32> AgileFighterRefreshTimerMSByPlayerGUID;
-    unordered_map<uint32, vector<EverQuestCreatureLootGroup>> CreatureLootGroupsByCreatureTemplateID;
     unordered_map<uint64, unordered_map<ObjectGuid, vector<uint32>>> PreloadedLootItemIDsByMapInstanceKeyThenCreatureGUID; // Map-instance keyed since creature GUIDs repeat across instance copies of a map
     unordered_map<uint64, unordered_map<ObjectGuid, unordered_map<uint32, uint32>>> PreloadedLootCountsByMapInstanceKeyThenCreatureGUID;
     unordered_map<uint64, unordered_map<ObjectGuid, EverQuestLoadedCreatureEquippedVisualItems>> VisualEquippedItemsByMapInstanceKeyThenCreatureGUID;
     unordered_map<uint64, unordered_set<ObjectGuid>> CreaturesResolvingEQMeleeExtraAttacksByMapInstanceKey; // Map-instance keyed since creature GUIDs repeat across instance copies of a map
-    unordered_map<uint32, vector<EverQuestTransportShipTrigger>> ShipTriggersByTriggeringGameObjectTemplateEntryID;
-    unordered_map<uint32, int> ShipWaitNodesByGameObjectTemplateEntryID;
     unordered_map<uint32, GameObject*> ShipGameObjectsByTemplateEntryID;
-    unordered_map<uint32, EverQuestCreatureInstance> CreatureInstancesByCreatureGUID;
-    unordered_map<uint32, unordered_map<uint32, vector<EverQuestCreatureWaypoint>>> CreatureWaypointsByMapIDAndWaypointID;
-    unordered_map<uint32, vector<EverQuestForageZoneItem>> ForageZoneItemsByMapID;
-    unordered_map<uint32, uint32> ForageZoneItemTotalChanceByMapID;
-    unordered_map<uint32, EverQuestZoneSafePoint> ZoneSafePointByMapID;
-    unordered_map<uint32, EverQuestZone> ZoneByMapID;
-    unordered_set<uint32> InstanceRaidLowMapIDs;
-    unordered_map<uint32, uint32> OpenWorldMapIDByInstanceRaidLowMapID;
+    EverQuestTransportResyncStats TransportResyncStats;
     unordered_map<ObjectGuid, EverQuestPlayerRaidLowInstanceState> RaidLowInstanceStateByPlayerGUID;
-    unordered_map<uint32, EverQuestFaction> FactionsByFactionTemplateID;
-    unordered_set<uint32> DefendCombatFactionTemplateIDs;
-    unordered_map<uint32, EverQuestReputationFactionInfo> EQReputationFactionInfoByFactionID;
     unordered_map<ObjectGuid, EverQuestPlayerTempFactionBonus> TempFactionBonusByPlayerGUID;
     unordered_map<ObjectGuid, vector<uint32>> ForcedFactionReactionIDsByPlayerGUID;
     unordered_set<ObjectGuid> PlayersPendingTempFactionRecalculation;
     unordered_map<ObjectGuid, uint32> CorpseIllusionOriginalNativeDisplayByPlayerGUID;
     unordered_map<ObjectGuid, EverQuestPendingSummonRequest> PendingSummonRequestByTargetPlayerGUID;
-    unordered_map<uint8, EverQuestClassMap> ClassMapByWOWClassID;
+    unordered_map<uint64, std::shared_ptr<const EverQuestTrackingMapSnapshot>> TrackingSnapshotsByMapInstanceKey;
+    unordered_map<ObjectGuid, EverQuestZoneWideGroupMemberCache> ZoneWideGroupMemberCachesByGroupGUID;
+    std::atomic<uint64> UnitDeathSerial{ 0 };           // Bumped on every death, after the kill's rewards are paid, so each kill is paid under its own value
+    unordered_map<uint64, EverQuestWaypointLegMapCache> WaypointLegCachesByMapInstanceKey;
+    EverQuestWaypointLegCacheStats WaypointLegCacheStats;
+    unordered_map<uint32, unordered_map<uint64, EverQuestCachedWaypointLeg>> BakedWaypointLegsByMapIDThenLegKey;
+    std::mutex BakedWaypointLegFileMutex;               // Two maps finishing a bake together would otherwise both write the same temp file
+    EverQuestTerrainZCacheStats TerrainZCacheStats;
+    unordered_map<uint64, EverQuestPathingMapBudget> PathingBudgetReportsByMapInstanceKey;
 
     static EverQuestMod* instance()
     {
@@ -1165,18 +1653,32 @@ public:
 
     bool LoadConfigurationSystemDataFromDB();
     void LoadConfigurationFile();
-    void LoadCreatureData();
+    const EverQuestWorldData& GetWorldData() const { return *PublishedWorldData.load(std::memory_order_acquire); }
+    uint32 GetWorldDataGeneration() const { return WorldDataGeneration.load(std::memory_order_acquire); }
+    void LoadWorldDataTables(EverQuestWorldData& worldData, const string& snapshotFilePath);
+    void PublishWorldData(std::unique_ptr<EverQuestWorldData> worldData, unordered_map<uint32, unordered_map<uint64, EverQuestCachedWaypointLeg>> bakedWaypointLegs);
+    void ResolveWorldDataReferences(EverQuestWorldData& worldData);
+    void ResolveStartupWorldDataReferences();
+    bool StartWorldDataReload();
+    void UpdateWorldDataReload();
+    uint64 GetWorldDataSourceChecksum();
+    void SerializeWorldDataTables(EverQuestWorldData& worldData, string& payloadOut);
+    bool DeserializeWorldDataTables(const string& payload, EverQuestWorldData& worldData);
+    bool ReadWorldDataSnapshotFile(const string& snapshotFilePath, uint64 sourceChecksum, string& payloadOut);
+    bool LoadWorldDataSnapshot(const string& snapshotFilePath, uint64 sourceChecksum, EverQuestWorldData& worldData);
+    bool WriteWorldDataSnapshot(const string& snapshotFilePath, uint64 sourceChecksum, EverQuestWorldData& worldData);
+    void LoadCreatureData(EverQuestWorldData& worldData);
     bool HasCreatureDataForCreatureTemplateID(uint32 creatureTemplateID);
     const EverQuestCreature& GetCreatureDataForCreatureTemplateID(uint32 creatureTemplateID);
-    void LoadCreatureSpawnPoints();
+    void LoadCreatureSpawnPoints(EverQuestWorldData& worldData);
     bool ShouldDespawnCreatureDueToSpawnRestrictions(Creature* creature);
     ObjectGuid::LowType RollCycleSpawnCreatureGUID(const EverQuestCycleSpawnGroup& cycleSpawnGroup, uint32 excludedSpawnPointID, Map* map);
     void ProcessCycleSpawnForCreatureDeath(Creature* deadCreature);
     void ApplyRaidBossRespawnVariance(Creature* deadCreature);
     void UpdateCycleSpawns(Map* map, uint32 diff);
-    void LoadCreatureKillSpawnData();
-    void ResolveKillSpawnRespawnTargetSpawnPoints();
-    void LoadCreatureEmoteData();
+    void LoadCreatureKillSpawnData(EverQuestWorldData& worldData);
+    void ResolveKillSpawnRespawnTargetSpawnPoints(EverQuestWorldData& worldData);
+    void LoadCreatureEmoteData(EverQuestWorldData& worldData);
     bool DoCreatureEmoteEvent(Creature* creature, uint8 emoteEventType, Unit* target);
     void EmitCreatureEmote(Creature* creature, const EverQuestCreatureEmote& emote, Unit* target);
     void SendCreatureChatToAllPlayersOnMap(Creature* creature, ChatMsg chatMsg, const string& text);
@@ -1184,7 +1686,7 @@ public:
     void SetupCreatureEmoteState(Creature* creature);
     void RemoveCreatureEmoteState(Creature* creature);
     void UpdateCreatureEmotes(Creature* creature, uint32 diff);
-    void LoadCreatureMovementSoundData();
+    void LoadCreatureMovementSoundData(EverQuestWorldData& worldData);
     void RemoveCreatureMovementSoundState(Creature* creature);
     void UpdateCreatureMovementSound(Creature* creature, uint32 diff);
     void ProcessKillSpawnsForCreatureEvent(Creature* eventCreature, Unit* otherUnit, uint8 triggerTypeID);
@@ -1201,14 +1703,16 @@ public:
     void UpdatePendingKillSpawnActions(Map* map, uint32 diff);
     bool HasAliveCreatureWithEntryInMap(Map* map, uint32 creatureTemplateID, Creature* ignoreCreature);
     void ExecuteKillSpawnAction(Map* map, EverQuestPendingKillSpawnAction& action);
-    void LoadCreatureOnkillReputations();
+    void LoadCreatureOnkillReputations(EverQuestWorldData& worldData);
     const list<EverQuestCreatureOnkillReputation>& GetOnkillReputationsForCreatureTemplate(uint32 creatureTemplateID);
-    void LoadItemTemplateData();
+    void LoadItemTemplateData(EverQuestWorldData& worldData);
     uint32 GetNPCEquipItemTemplateIDForItemTemplate(uint32 itemTemplateID);
     uint32 GetWornEffectSpellIDForItemTemplate(uint32 itemTemplateID);
     bool IsItemEQClassAllowedForPlayer(Player* player, uint32 itemTemplateID);
+    uint32 GetEQClassMaskForItemTemplate(uint32 itemTemplateID);
+    uint32 GetEQClassMaskForPlayer(Player* player);
     bool IsItemTemplateIDAnEQItemTemplateID(uint32 itemTemplateID);
-    void LoadItemWoWToEQSwapData();
+    void LoadItemWoWToEQSwapData(EverQuestWorldData& worldData);
     bool TryGetGearSwapPlayerState(Player* player, bool& hideWoWGear, uint8& secondEQClassID);
     uint32 GetGearSwapItemTemplateIDForWornItem(uint32 wearingPlayerGUIDCounter, uint8 rolledEQClassID, uint8 fallbackEQClassID, uint8 equipSlot, uint32 itemTemplateID);
     void PatchVisibleGearFieldsInValuesUpdate(Player* wearingPlayer, ByteBuffer& valuesUpdateBuf, BuildValuesCachePosPointers& posPointers);
@@ -1216,15 +1720,15 @@ public:
     bool IsAuctionUsableFilterActiveForPlayer(ObjectGuid playerGUID);
     bool BuildEQClassFilteredAuctionListPacket(Player* player, WorldPacket const& packet, WorldPacket& filteredPacket);
     bool IsWornEffectSpell(uint32 spellID);
-    void LoadSpellData();
+    void LoadSpellData(EverQuestWorldData& worldData);
     const EverQuestSpell& GetSpellDataForSpellID(uint32 spellID);
-    void LoadIllusionDisplayData();
+    void LoadIllusionDisplayData(EverQuestWorldData& worldData);
     bool IsIllusionFormSpell(uint32 spellID);
     uint64 GetIllusionDisplayLookupKey(uint32 formSpellID, uint32 bodySet, uint32 tintID, bool helmOn);
     bool TryGetIllusionDisplayID(uint32 formSpellID, uint32 bodySet, uint32 tintID, bool helmOn, uint32& displayIDOut);
     uint32 GetIllusionDisplayIDWithFallback(uint32 formSpellID, uint32 bodySet, uint32 tintID, bool helmOn);
     uint32 GetIllusionBodySetForEQArmorMaterial(uint32 eqArmorMaterial);
-    void LoadIllusionFaceData();
+    void LoadIllusionFaceData(EverQuestWorldData& worldData);
     uint64 GetIllusionFaceLookupKey(uint32 baseDisplayID, uint32 faceIndex);
     uint32 GetIllusionFaceDisplayIDForPlayer(Player* player, uint32 baseDisplayID);
     uint32 GetIllusionGearDisplayIDForPlayer(Player* player, uint32 formSpellID);
@@ -1240,10 +1744,9 @@ public:
     bool IsCreatureCharmBlockedByCharmLimits(uint32 spellID, Unit* target, Unit* caster);
     bool ApplyBardSongFearDiminishingReturnsOnAuraApply(Unit* target, Aura* aura);
     void RemoveCreatureFearDiminishingReturnState(Creature* creature);
-    uint64 GetHasteTrackingKeyForUnit(Unit* unit);
     void TrackEQHasteAurasAndEnforceCapOnAuraApply(Unit* unit, Aura* aura);
     void UntrackEQHasteAurasAndEnforceCapOnAuraRemove(Unit* unit, Aura* aura);
-    void EnforceEQHastePercentCapOnUnit(Unit* unit, vector<EverQuestUnitHasteAuraEffect>& trackedHasteAuraEffects);
+    void EnforceEQHastePercentCapOnUnit(Unit* unit, EverQuestUnitHasteLedgerState& hasteLedger, uint8 auraTypeSlot, vector<AuraEffect*> const& touchedAuraEffects);
     float GetEQHasteCapPercentForUnit(Unit* unit);
     uint32 GetEquippedShieldBaseArmorForPlayer(Player* player);
     void RefreshBearFormShieldArmorShiftForPlayer(Player* player);
@@ -1253,28 +1756,28 @@ public:
     void ReapplyAgileFighterCombatAuraForPlayer(Player* player);
     void UpdateAgileFighterCombatAura(Player* player, uint32 diffInMS);
     void ClearAgileFighterTrackingForPlayer(ObjectGuid playerGUID);
-    void LoadQuestCompletionReputations();
+    void LoadQuestCompletionReputations(EverQuestWorldData& worldData);
     const list<EverQuestQuestCompletionReputation>& GetQuestCompletionReputationsForQuestTemplate(uint32 questTemplateID);
-    void LoadQuestReactions();
+    void LoadQuestReactions(EverQuestWorldData& worldData);
     const list<EverQuestQuestReaction>& GetQuestReactions(uint32 questTemplateID);
-    void LoadGossipReactions();
+    void LoadGossipReactions(EverQuestWorldData& worldData);
     bool HandleGossipHello(Player* player, Creature* creature);
     bool HandleGossipSelect(Player* player, Creature* creature, uint32 sender, uint32 action);
     string FormatGossipTextForPlayer(Player* player, const string& text);
-    void LoadPetData();
-    void LoadPetSilentDisplayData();
-    void RemoveInvalidPetSilentDisplays();
+    void LoadPetData(EverQuestWorldData& worldData);
+    void LoadPetSilentDisplayData(EverQuestWorldData& worldData);
+    void RemoveInvalidPetSilentDisplays(EverQuestWorldData& worldData);
     uint32 GetSilentFidgetDisplayIDForDisplayID(uint32 displayID) const;
     void UpdatePetFidgetSilence(Creature* creature);
     bool HasPetDataForCreatureTemplateID(uint32 creatureTemplateID);
     const EverQuestPet& GetPetDataForCreatureTemplateID(uint32 creatureTemplateID);
     void FixInvalidCharacterPetModelIDs();
-    void LoadCreatePlayerData();
+    void LoadCreatePlayerData(EverQuestWorldData& worldData);
     bool HasCreatePlayerData(uint8 raceID, uint8 classID);
     const EverQuestPlayerCreateInfo& GetPlayerCreateInfo(uint8 raceID, uint8 classID);
-    void LoadAutoLearnSkillsData();
+    void LoadAutoLearnSkillsData(EverQuestWorldData& worldData);
     const list<uint32>& GetAutoLearnSkillsForClass(uint8 classID);
-    void LoadAutoLearnSpellsData();
+    void LoadAutoLearnSpellsData(EverQuestWorldData& worldData);
     const list<EverQuestAutoLearnSpell>& GetAutoLearnSpellsForClass(uint8 classID);
     void ApplyAutoLearnedClassSkillsAndSpells(Player* player);
     void GrantDeathKnightStarterAbilitiesIfNeeded(Player* player);
@@ -1293,8 +1796,13 @@ public:
     bool IsZoneWideGroupRewardEnabledForMap(uint32 mapID);
     bool IsInZoneWideGroupRewardRange(Player* member, WorldObject* rewardSource);
     uint8 GetPlayerLevelForExperienceGain(Player* player);
-    void BuildZoneWideKillReward(Group* group, Player* killer, Unit* victim, EverQuestZoneWideKillReward& outReward);
-    float GetZoneWideGroupExperienceRate(Player* player, const EverQuestZoneWideKillReward& reward);
+    void BuildZoneWideKillReward(Group* group, KillRewarder const* rewarder, Player* killer, Unit* victim, EverQuestZoneWideKillReward& outReward);
+    void AdvanceZoneWideKillRewardSerial();
+    float GetZoneWideGroupExperienceRate(uint8 memberLevel, const EverQuestZoneWideKillReward& reward);
+    float GetGroupExperienceRateForMemberLevel(uint8 memberLevel, const EverQuestZoneWideKillReward& reward);
+    void GetZoneWideGroupMembersInMap(Group* group, Map* map, vector<Player*>& membersOut);
+    void InvalidateZoneWideGroupMemberCache(Group* group);
+    void InvalidateZoneWideGroupMemberCacheForPlayer(Player* player);
     float GetGroupExperienceRateForMember(Player* member, const EverQuestZoneWideKillReward& reward);
     void ApplyEQOnkillReputationsForPlayer(Player* player, Unit* victim);
     void GrantZoneWideGroupRewardsForKill(Player* killer, Unit* victim, const EverQuestZoneWideKillReward& reward);
@@ -1305,7 +1813,7 @@ public:
     bool RevokeAdventurerAuraIfPresent(Player* player);
     void GrantAdventurerAchievementIfAccountEarned(Player* player);
     void ProcessAdventurerStateOnLevelChange(Player* player);
-    void LoadCreatureLootData();
+    void LoadCreatureLootData(EverQuestWorldData& worldData);
     bool HasCreatureLootDataForCreatureTemplateEntryID(uint32 creatureTemplateEntryID);
     bool HasPreloadedLootItemIDsForCreatureGUID(Map* map, ObjectGuid creatureGUID);
     bool HasPreloadedLootItemIDForCreatureGUID(Map* map, ObjectGuid creatureGUID, uint32 itemTemplateID);
@@ -1328,10 +1836,11 @@ public:
     void SetupCreatureSummon(Creature* creature);
     void RemoveCreatureSummonState(Creature* creature);
     void UpdateCreatureSummon(Creature* creature, uint32 diff);
-    void DoCreatureCombatAbilitySwingRound(Creature* creature, Unit* target, uint32 damagePct);
-    void DoCreatureFlurry(Creature* creature, Unit* victim);
-    void DoCreatureRampage(Creature* creature, Unit* victim, float range, uint32 damagePct);
-    void DoCreatureWildRampage(Creature* creature, Unit* victim, uint32 maxTargets, uint32 damagePct);
+    EverQuestCreatureCombatAbilityState* DoCreatureCombatAbilitySwingRound(Creature* creature, EverQuestCreatureCombatAbilityState* state, Unit* target, uint32 damagePct);
+    void ResolveCreatureSpecialAttackTargets(Creature* creature, vector<ObjectGuid>& hatedUnitGUIDs);
+    void DoCreatureFlurry(Creature* creature, EverQuestCreatureCombatAbilityState* state, Unit* victim);
+    void DoCreatureRampage(Creature* creature, EverQuestCreatureCombatAbilityState* state, Unit* victim, float range, uint32 damagePct);
+    void DoCreatureWildRampage(Creature* creature, EverQuestCreatureCombatAbilityState* state, Unit* victim, uint32 maxTargets, uint32 damagePct);
     bool IsCreatureEnragedForRiposte(Unit const* unit, Unit const* attacker);
     void TryDoCreatureEnrageRiposteCounter(Unit* victim, Unit* attacker);
     void ApplyCreatureCombatAbilityDamageMod(Unit* attacker, uint32& damage);
@@ -1341,9 +1850,12 @@ public:
     void UpdateNonEQCreatureLeash(Creature* creature);
     bool TryGetCustomSocialAggroScale(Creature* creature, float& scaleOut);
     void DoScaledSocialAggroSearch(Creature* caller, Unit* victim, float scale, float maxAgroZDistance);
+    vector<ObjectGuid> const& GatherSocialAggroCandidatesForCreature(Creature* caller, float radius);
     void ApplyScaledCreatureSocialAggroOnEngage(Creature* creature, Unit* victim);
     void ProcessCreatureRetaliationOnDamage(Unit* attacker, Unit* victim);
+    void TrackCreatureCrowdControlOnPlayerAuraApply(Player* player, Aura* aura);
     void RemoveCreatureCrowdControlAurasFromPlayersOnDeath(Creature* deadCreature);
+    void RemoveCreatureCrowdControlTargetsState(Creature* creature);
     void UpdateCreatureScaledSocialAggro(Creature* creature, uint32 diff);
     void RemoveCreatureSocialAggroState(Creature* creature);
     float GetMaxAgroZDistanceForMap(uint32 mapID);
@@ -1357,17 +1869,56 @@ public:
     void RemoveCreatureAggroPositionState(Creature* creature);
     void TeleportCreatureToLastAggroPosition(Creature* creature, uint32 gateSpellID);
     void RemoveVisualEquippedItemForCreatureGUIDIfExists(Map* map, ObjectGuid creatureGUID, uint32 itemTemplateID);
-    void LoadShipTriggerData();
+    void LoadShipTriggerData(EverQuestWorldData& worldData);
     const vector<EverQuestTransportShipTrigger>& GetShipTriggersForShip(int triggeringGameObjectTemplateEntryID);
-    void LoadCreatureInstanceData();
+    size_t GetShipTriggersReachedAtNode(WorldObject* ship, uint32 nodeID, const EverQuestTransportShipTrigger*& reachedTriggersOut);
+    static size_t AdvanceShipTriggerCursor(EverQuestShipTriggerCursor& cursor, const vector<EverQuestTransportShipTrigger>& shipTriggers, uint32 worldDataGeneration, uint32 nodeID,
+        const EverQuestTransportShipTrigger*& reachedTriggersOut);
+    bool ReplayShipTriggerRoutes(vector<string>& mismatchesOut, uint32& replayedRelocateCountOut);
+    void LoadCreatureInstanceData(EverQuestWorldData& worldData);
     const EverQuestCreatureInstance& GetCreatureInstanceData(uint32 creatureInstanceGUID);
-    void LoadCreatureWaypointData();
+    void LoadCreatureWaypointData(EverQuestWorldData& worldData);
     const vector<EverQuestCreatureWaypoint>& GetWaypoints(uint32 mapID, uint32 waypointListID);
-    void LoadForageData();
+    const EverQuestCreatureWaypointSet* GetWaypointSet(uint32 mapID, uint32 waypointListID);
+    const EverQuestCreatureWaypointSet* GetWaypointSet(const EverQuestWorldData& worldData, uint32 mapID, uint32 waypointListID);
+    static uint32 FindNearestWaypointIndex(const EverQuestCreatureWaypointSet& waypointSet, float x, float y, float z);
+    bool TryGetCachedWaypointLeg(Map* map, uint64 legKey, Movement::PointsArray& pointsOut, float& terrainSnappedTargetZOut);
+    void StoreCachedWaypointLeg(Map* map, uint64 legKey, const Movement::PointsArray& points, float terrainSnappedTargetZ);
+    void InvalidateCachedWaypointLegsForGrid(Map* map, uint32 gridX, uint32 gridY);
+    void ClearCachedWaypointLegsForMap(Map* map);
+    EverQuestWaypointLegCacheStats GetWaypointLegCacheStats();
+    static uint64 MakeWaypointLegCacheKey(uint32 waypointListID, uint32 fromWaypointIndex, uint32 toWaypointIndex, bool disableGroundContour, bool canFly);
+    static void DecodeWaypointLegCacheKey(uint64 legKey, uint32& waypointListID, uint32& fromWaypointIndex, uint32& toWaypointIndex);
+    bool TryReservePathingBudget(Creature* creature);
+    void RemovePathingBudgetWaiter(Creature* creature);
+    bool IsWaypointLegBackingOff(Map* map, uint64 legKey);
+    void RecordWaypointLegPathResult(Map* map, uint64 legKey, bool pathBuilt);
+    void RecordRoamPathFailure(Map* map);
+    void UpdatePathingBudgetReportForMap(Map* map);
+    void ClearPathingBudgetForMap(Map* map);
+    vector<EverQuestPathingMapBudget> GetPathingBudgetsSnapshot();
+    bool IsWaypointLegKeyInWaypointData(const EverQuestWorldData& worldData, uint32 mapID, uint64 legKey);
+    void LoadBakedWaypointLegs(const string& bakeFilePath, const EverQuestWorldData& worldData, unordered_map<uint32, unordered_map<uint64, EverQuestCachedWaypointLeg>>& bakedLegsOut);
+    bool WriteBakedWaypointLegs(const string& bakeFilePath, const unordered_map<uint32, unordered_map<uint64, EverQuestCachedWaypointLeg>>& bakedLegs);
+    bool StartWaypointLegBakeForMap(Map* map, Player* requester);
+    void UpdateWaypointLegBakeForMap(Map* map);
+    void FinishWaypointLegBakeForMap(Map* map, EverQuestWaypointLegBakeJob& bakeJob);
+    bool TryGetCachedTerrainZ(Map* map, uint64 terrainZKey, const EverQuestTerrainZCacheLookup& lookup, EverQuestTerrainZCacheEntry& entryOut);
+    void StoreCachedTerrainZ(Map* map, uint64 terrainZKey, const EverQuestTerrainZCacheEntry& entry);
+    void FlushTerrainZCacheStats(EverQuestTerrainZMapCache& zCache);
+    void ClearCachedTerrainZForMap(Map* map);
+    EverQuestTerrainZCacheStats GetTerrainZCacheStats();
+    bool GetTerrainLiquidLevel(Creature* creature, float x, float y, float z, float& liquidLevelOut);
+    float GetTerrainFloorZ(Creature* creature, float x, float y, float z, bool isPriorPointInWater, float minZ, float maxZ);
+    float GetEffectiveDestinationZForCreature(Creature* creature, bool disableGroundContour, float priorX, float priorY, float priorZ, float initialTargetX, float initialTargetY,
+        float initialTargetZ, bool& foundValidZ, float minZ = 0, float maxZ = 0);
+    bool BuildSnappedPathForCreature(Creature* creature, const EverQuestCreatureInstance& instanceData, bool isRoaming, const Position& startPosition, float initialTargetX,
+        float initialTargetY, float initialTargetZ, Movement::PointsArray& waypointPath, float& terrainSnappedTargetZ, bool* navmeshPathFoundOut = nullptr);
+    void LoadForageData(EverQuestWorldData& worldData);
     const vector<EverQuestForageZoneItem>& GetForageZoneItemsInMap(uint32 mapID);
-    void LoadZoneSafePointData();
+    void LoadZoneSafePointData(EverQuestWorldData& worldData);
     void SendPlayerToZoneSafePoint(Player* player, bool includeGroup);
-    void LoadZoneData();
+    void LoadZoneData(EverQuestWorldData& worldData);
     uint32 GetInstanceRaidLowMapIDForMap(uint32 mapID);
     uint32 GetOpenWorldMapIDForMapID(uint32 mapID);
     bool IsMapInstanceRaidLow(uint32 mapID);
@@ -1386,9 +1937,9 @@ public:
     void FailClientVersionCheckForPlayer(Player* player, EverQuestPlayerClientVersionCheckState& checkState);
     void UpdateClientVersionChecks(uint32 diff);
     void ClearClientVersionCheckForPlayer(ObjectGuid playerGUID);
-    void LoadFactionData();
-    void ResolveDefendCombatFactionTemplates();
-    void ResolveEQReputationFactions();
+    void LoadFactionData(EverQuestWorldData& worldData);
+    void ResolveDefendCombatFactionTemplates(EverQuestWorldData& worldData);
+    void ResolveEQReputationFactions(EverQuestWorldData& worldData);
     void HandleModFactionAuraApplyOnCreature(Creature* creature, Aura* aura);
     void HandleModFactionAuraRemoveFromCreature(Creature* creature, AuraApplication* aurApp);
     void RecalculateTemporaryFactionReactionsForPlayer(Player* player);
@@ -1398,12 +1949,14 @@ public:
     void GetIllusionFactionBandSteps(uint8 playerAlignment, uint8 illusionAlignment, int32& stepsTowardGoodOut, int32& stepsTowardEvilOut);
     void ClearTemporaryFactionStateForPlayer(ObjectGuid playerGUID);
     void ClearTempFactionBonusForPlayer(Player* player);
-    void UpdateCreatureDefendFriendlyPlayers(Creature* creature, uint32 diff);
+    void UpdateCreatureDefendFriendlyPlayers(Creature* creature);
     bool IsPlayerFriendlyWithCreatureByReputation(Creature* creature, Player* player);
-    void DoDefendFriendlyPlayersSearch(Creature* attacker, Player* attackedPlayer);
+    void UpdateDefendBrokerForMap(Map* map);
+    void DoDefendFriendlyPlayersSearch(Map* map, vector<pair<ObjectGuid, ObjectGuid>> const& attackerAndPlayerGUIDs);
+    bool IsDefendCandidateFriendlyToDefender(Creature* defender, uint32 defenderFactionTemplateID, EverQuestDefendCandidate& candidate);
     void RemoveCreatureDefendPlayerWatchState(Creature* creature);
     void UpdateCreatureDefendFactionRestore(Creature* creature);
-    void LoadClassMapData();
+    void LoadClassMapData(EverQuestWorldData& worldData);
     const EverQuestClassMap& GetClassMapForWOWClassID(uint8 wowClassID);
     bool IsEQClassABaseEQClass(uint8 eqClassID);
 
@@ -1425,6 +1978,10 @@ public:
     void MakeCreatureAttackPlayer(uint32 entryID, Map* map, Player* player);
     bool IsSpellAnEQSpell(uint32 spellID);
     bool IsSpellAnEQBardSong(uint32 spellID);
+    void RefreshConcurrentBardSongForPlayer(Player* player, uint32 spellID);
+    void RemoveConcurrentBardSongForPlayer(Player* player, uint32 spellID);
+    void RebuildConcurrentBardSongsForPlayer(Player* player);
+    string MeasureConcurrentBardSongThroughput();
     bool RollBashKickStunLands(Unit* attacker, Unit* defender);
     uint32 CalculateSpellFocusBoostValue(Unit* caster, uint32 spellID);
     void ProcessForage(Player* player);
@@ -1440,7 +1997,11 @@ public:
     float GetTrackingMaxDistanceForPlayer(Player* player);
     void HandleTrackingRangeChangeForPlayer(Player* player);
     void SendTrackingAddonMessageToPlayer(Player* player, const std::string& payload);
-    void SendTrackingListToPlayer(Player* player);
+    std::shared_ptr<const EverQuestTrackingMapSnapshot> GetTrackingSnapshotForMap(Map* map);
+    void GatherTrackingEntriesForPlayer(Player* player, float maxTrackDistance, std::vector<std::pair<float, Creature*>>& sortedCreatureEntriesOut);
+    void SendTrackingListToPlayer(Player* player, uint8 protocolVersion = EQ_TRACKING_PROTOCOL_VERSION_TEXT);
+    void SendPackedTrackingListToPlayer(Player* player, EverQuestPlayerTrackingState* trackingState, float maxTrackDistance, const std::vector<std::pair<float, Creature*>>& sortedCreatureEntries, bool isFullList);
+    void UpdatePlayerTrackingLiveList(Player* player, EverQuestPlayerTrackingState* trackingState, uint32 diffInMS);
     void StartTrackingForPlayer(Player* player, uint64 rawCreatureGUID);
     void StopTrackingForPlayer(Player* player, bool sendMessage);
     void UpdatePlayerTracking(Player* player, uint32 diffInMS);
@@ -1459,6 +2020,9 @@ public:
     bool GetShowBardPulseForPlayer(Player* player);
     void SetShowBardPulseForPlayer(Player* player, bool showBardPulse);
     void SaveShowBardPulseForPlayer(Player* player);
+    void SetBardPulseHiddenTrackedForPlayer(ObjectGuid playerGUID, bool isHidden);
+    void RetrackBardPulseHiddenForPlayerLogin(Player* player);
+    void UntrackBardPulseHiddenForPlayerLogout(ObjectGuid playerGUID);
     bool GetHideWoWGearForPlayer(Player* player);
     void SetHideWoWGearForPlayer(Player* player, bool hideWoWGear);
     void SaveHideWoWGearForPlayer(Player* player);
@@ -1472,8 +2036,14 @@ public:
     void SendExpPoolAddonMessageToPlayer(Player* player, uint32 gainedExp);
     void SetInitialEQClassesForPlayer(Player* player);
     void SetInitialCreatePositionForPlayer(Player* player);
+    EverQuestPlayerControllerData GetDefaultPlayerControllerData(Player* player);
     EverQuestPlayerControllerData GetPlayerControllerData(Player* player);
     EverQuestPlayerControllerData* GetOrLoadActivePlayerClassControllerData(Player* player);
+    void QueueLoginDataLoadForPlayer(WorldSession* session, ObjectGuid playerGUID);
+    void BeginLoginDataLoadForPlayer(uint32 accountID, ObjectGuid playerGUID);
+    void ProcessPendingLoginDataLoads();
+    std::shared_ptr<const EverQuestPlayerLoginData> GetReadyLoginDataForPlayer(ObjectGuid playerGUID);
+    void ClearLoginDataForPlayer(ObjectGuid playerGUID);
 
     std::map<std::string, EverQuestPlayerClassInfoItem> GetPlayerClassInfoByClassNameForPlayer(Player* player);
     std::map<uint8, uint8> GetClassLevelsByClassForPlayer(Player* player);
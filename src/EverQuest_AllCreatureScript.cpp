@@ -68,7 +68,10 @@ public:
         // Remove EverQuest creatures from the trackers
         uint32 mapID = creature->GetMap()->GetId();
         if (mapID >= EverQuest->ConfigSystemMapDBCIDMin && mapID <= EverQuest->ConfigSystemMapDBCIDMax)
+        {
             EverQuest->RemoveCreatureAsLoaded(creature);
+            EverQuest->RemovePathingBudgetWaiter(creature);
+        }
         EverQuest->RemoveCreatureRangedAttackState(creature);
         EverQuest->RemoveCreatureCombatAbilityState(creature);
         EverQuest->RemoveCreatureSummonState(creature);
@@ -82,6 +85,7 @@ public:
         EverQuest->RemoveCreatureAggroPositionState(creature);
         EverQuest->RemoveCreatureAgroZBlockState(creature);
         EverQuest->RemoveCreatureFearDiminishingReturnState(creature);
+        EverQuest->RemoveCreatureCrowdControlTargetsState(creature);
     }
 
     void OnAllCreatureUpdate(Creature* creature, uint32 diff) override
@@ -104,7 +108,7 @@ public:
         EverQuest->UpdateCreatureMovementSound(creature, diff);
         EverQuest->UpdateCreatureKillSpawnCombatWatch(creature, diff);
         EverQuest->UpdateVulakLock(creature, diff);
-        EverQuest->UpdateCreatureDefendFriendlyPlayers(creature, diff);
+        EverQuest->UpdateCreatureDefendFriendlyPlayers(creature);
         EverQuest->UpdateCreatureDefendFactionRestore(creature);
     }
 
@@ -28,11 +28,31 @@ public:
     {
         if (EverQuest->IsEnabled == false)
             return;
+        // Before the map ID check, since EQ creatures can be spawned onto other maps and still call for defenders
+        EverQuest->UpdateDefendBrokerForMap(map);
         uint32 mapID = map->GetId();
         if (mapID < EverQuest->ConfigSystemMapDBCIDMin || mapID > EverQuest->ConfigSystemMapDBCIDMax)
             return;
         EverQuest->UpdatePendingKillSpawnActions(map, diff);
         EverQuest->UpdateCycleSpawns(map, diff);
+        EverQuest->UpdateWaypointLegBakeForMap(map);
+        EverQuest->UpdatePathingBudgetReportForMap(map);
+    }
+
+    void OnUnloadGridMap(Map* map, GridTerrainData* /*gmap*/, uint32 gx, uint32 gy) override
+    {
+        if (EverQuest->IsEnabled == false)
+            return;
+        EverQuest->InvalidateCachedWaypointLegsForGrid(map, gx, gy);
+    }
+
+    void OnDestroyMap(Map* map) override
+    {
+        if (EverQuest->IsEnabled == false)
+            return;
+        EverQuest->ClearCachedWaypointLegsForMap(map);
+        EverQuest->ClearCachedTerrainZForMap(map);
+        EverQuest->ClearPathingBudgetForMap(map);
     }
 };
 
@@ -15,9 +15,11 @@
 //  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "CellImpl.h"
+#include "GameTime.h"
 #include "GridNotifiersImpl.h"
 #include "Group.h"
 #include "Map.h"
+#include "ObjectAccessor.h"
 #include "ReputationMgr.h"
 #include "ScriptMgr.h"
 #include "SpellAuras.h"
@@ -33,70 +35,104 @@ class EverQuest_BardSongAuraScript: public AuraScript
 {
     PrepareAuraScript(EverQuest_BardSongAuraScript);
 
-    bool IsUnitAnEnemyInLOS(Unit* caster, Unit* target)
+    EverQuestPlayerBardPulseState* GetPulseStateForTick(Player* player, uint32 nowGameTimeMS)
+    {
+        EverQuestPlayerBardPulseState* pulseState = player->CustomData.GetDefault<EverQuestPlayerBardPulseState>(EQ_PLAYER_CUSTOMDATA_BARDPULSE);
+        if (pulseState->TargetSetsGameTimeMS == nowGameTimeMS)
+            return pulseState;
+
+        // New world tick, so last tick's target sets are stale and this is a good time to drop expired LOS results
+        pulseState->TargetSetsGameTimeMS = nowGameTimeMS;
+        pulseState->TargetSetsThisTick.clear();
+        for (auto losItr = pulseState->LOSResultsByUnitGUID.begin(); losItr != pulseState->LOSResultsByUnitGUID.end();)
+        {
+            if (losItr->second.ExpireGameTimeMS <= nowGameTimeMS)
+                losItr = pulseState->LOSResultsByUnitGUID.erase(losItr);
+            else
+                ++losItr;
+        }
+        return pulseState;
+    }
+
+    bool IsUnitInLOS(Unit* caster, Unit* target, EverQuestPlayerBardPulseState* pulseState, uint32 nowGameTimeMS)
+    {
+        auto losItr = pulseState->LOSResultsByUnitGUID.find(target->GetGUID());
+        if (losItr != pulseState->LOSResultsByUnitGUID.end() && losItr->second.ExpireGameTimeMS > nowGameTimeMS)
+            return losItr->second.IsInLOS;
+
+        EverQuestBardPulseLOSResult& losResult = pulseState->LOSResultsByUnitGUID[target->GetGUID()];
+        losResult.IsInLOS = caster->IsWithinLOSInMap(target);
+        losResult.ExpireGameTimeMS = nowGameTimeMS + EQ_BARD_PULSE_LOS_CACHE_MS;
+        return losResult.IsInLOS;
+    }
+
+    EverQuestBardPulseFactionStanding const& GetFactionStanding(Player* player, uint32 factionTemplateID, EverQuestPlayerBardPulseState* pulseState, uint32 nowGameTimeMS)
+    {
+        EverQuestBardPulseFactionStanding& standing = pulseState->FactionStandingsByFactionTemplateID[factionTemplateID];
+        if (standing.ExpireGameTimeMS > nowGameTimeMS)
+            return standing;
+        standing.ExpireGameTimeMS = nowGameTimeMS + EQ_BARD_PULSE_FACTION_CACHE_MS;
+        standing.HasReputation = false;
+        standing.IsEnemyByReputation = false;
+        standing.IsFriendlyByReputation = false;
+
+        FactionTemplateEntry const* ftEntry = sFactionTemplateStore.LookupEntry(factionTemplateID);
+        if (ftEntry == nullptr)
+            return standing;
+
+        // The parent faction can be absent from Faction.dbc (faction 0 or trimmed rows), treat that like no-reputation
+        FactionEntry const* fEntry = sFactionStore.LookupEntry(ftEntry->faction);
+        if (fEntry == nullptr || fEntry->reputationListID == -1)
+            return standing;
+        bool isAtWar = player->GetReputationMgr().IsAtWar(fEntry->ID);
+        ReputationRank reputationRank = player->GetReputationRank(fEntry->ID);
+        standing.HasReputation = true;
+        standing.IsEnemyByReputation = isAtWar == true || reputationRank <= REP_HOSTILE;
+        standing.IsFriendlyByReputation = isAtWar == false || reputationRank > REP_HOSTILE;
+        return standing;
+    }
+
+    bool IsUnitAnEnemyInLOS(Unit* caster, Unit* target, EverQuestPlayerBardPulseState* pulseState, uint32 nowGameTimeMS)
     {
         if (target == nullptr)
             return false;
         Player* player = caster->ToPlayer();
-        if (target->IsAlive() == false || target == caster || caster->IsWithinLOSInMap(target) == false)
+        if (target->IsAlive() == false || target == caster || IsUnitInLOS(caster, target, pulseState, nowGameTimeMS) == false)
             return false;
         if (!caster->IsValidAttackTarget(target))
             return false;
 
-        uint32 factionTemplateId = target->GetFaction();
-        FactionTemplateEntry const* ftEntry = sFactionTemplateStore.LookupEntry(factionTemplateId);
-        if (ftEntry == nullptr)
-            return true;
-
-        // The parent faction can be absent from Faction.dbc (faction 0 or trimmed rows), treat that like no-reputation
-        FactionEntry const* fEntry = sFactionStore.LookupEntry(ftEntry->faction);
-        if (fEntry == nullptr || fEntry->reputationListID == -1)
+        EverQuestBardPulseFactionStanding const& standing = GetFactionStanding(player, target->GetFaction(), pulseState, nowGameTimeMS);
+        if (standing.HasReputation == false)
             return true;
-        if (player->GetReputationMgr().IsAtWar(fEntry->ID) == true || player->GetReputationRank(fEntry->ID) <= REP_HOSTILE)
-            return true;
-        return false;
+        return standing.IsEnemyByReputation;
     }
 
-    bool IsUnitAFriendlyInLOS(Unit* caster, Unit* target)
+    bool IsUnitAFriendlyInLOS(Unit* caster, Unit* target, EverQuestPlayerBardPulseState* pulseState, uint32 nowGameTimeMS)
     {
         if (target == nullptr)
             return false;
         Player* player = caster->ToPlayer();
         if (caster == target)
             return true;
-        if (target->IsAlive() == false || caster->IsWithinLOSInMap(target) == false)
+        if (target->IsAlive() == false || IsUnitInLOS(caster, target, pulseState, nowGameTimeMS) == false)
             return false;
         if (caster->IsValidAttackTarget(target) == false)
             return true;
 
-        uint32 factionTemplateId = target->GetFaction();
-        FactionTemplateEntry const* ftEntry = sFactionTemplateStore.LookupEntry(factionTemplateId);
-        if (ftEntry == nullptr)
-        {
-            if (caster->IsValidAttackTarget(target) == true)
-                return false;
-            else
-                return true;
-        }
-
-        // The parent faction can be absent from Faction.dbc (faction 0 or trimmed rows), treat that like no-reputation
-        FactionEntry const* fEntry = sFactionStore.LookupEntry(ftEntry->faction);
-        if (fEntry == nullptr || fEntry->reputationListID == -1)
-        {
-            if (caster->IsValidAttackTarget(target) == true)
-                return false;
-            else
-                return true;
-        }
-        if (player->GetReputationMgr().IsAtWar(fEntry->ID) == false || player->GetReputationRank(fEntry->ID) > REP_HOSTILE)
-            return true;
-        return false;
+        // Without a reputation row, a valid attack target (checked above) is never a friendly
+        EverQuestBardPulseFactionStanding const& standing = GetFactionStanding(player, target->GetFaction(), pulseState, nowGameTimeMS);
+        if (standing.HasReputation == false)
+            return false;
+        return standing.IsFriendlyByReputation;
     }
 
     list<Unit*> GetTargets(Unit* caster, int bardTargetType, uint32 radius)
     {
         Player* player = caster->ToPlayer();
         std::list<Unit*> validTargets;
+        uint32 nowGameTimeMS = uint32(GameTime::GetGameTimeMS().count());
+        EverQuestPlayerBardPulseState* pulseState = GetPulseStateForTick(player, nowGameTimeMS);
 
         // Do self and single target first since they are faster
         if (bardTargetType == EQ_BARDSONGAURATARGET_SELF)
@@ -111,9 +147,9 @@ class EverQuest_BardSongAuraScript: public AuraScript
                 return validTargets;
             if (currentTarget == caster)
                 validTargets.push_back(caster);
-            else if (IsUnitAnEnemyInLOS(caster, currentTarget) == true)
+            else if (IsUnitAnEnemyInLOS(caster, currentTarget, pulseState, nowGameTimeMS) == true)
                 validTargets.push_back(currentTarget);
-            else if (IsUnitAFriendlyInLOS(caster, currentTarget) == true)
+            else if (IsUnitAFriendlyInLOS(caster, currentTarget, pulseState, nowGameTimeMS) == true)
                 validTargets.push_back(currentTarget);
             return validTargets;
         }
@@ -122,7 +158,7 @@ class EverQuest_BardSongAuraScript: public AuraScript
             Unit* currentTarget = player->GetSelectedUnit();
             if (currentTarget == nullptr)
                 return validTargets;
-            if (IsUnitAnEnemyInLOS(caster, currentTarget) == true)
+            if (IsUnitAnEnemyInLOS(caster, currentTarget, pulseState, nowGameTimeMS) == true)
                 validTargets.push_back(currentTarget);
             return validTargets;
         }
@@ -131,11 +167,25 @@ class EverQuest_BardSongAuraScript: public AuraScript
             Unit* currentTarget = player->GetSelectedUnit();
             if (currentTarget == nullptr)
                 return validTargets;
-            if (IsUnitAFriendlyInLOS(caster, currentTarget) == true)
+            if (IsUnitAFriendlyInLOS(caster, currentTarget, pulseState, nowGameTimeMS) == true)
                 validTargets.push_back(currentTarget);
             return validTargets;
         }
 
+        // Another song of the same type and radius already gathered this tick, so reuse it (a unit the earlier pulse killed drops out here)
+        for (EverQuestBardPulseTargetSet const& targetSet : pulseState->TargetSetsThisTick)
+        {
+            if (targetSet.TargetType != bardTargetType || targetSet.Radius != radius)
+                continue;
+            for (ObjectGuid const& targetGUID : targetSet.TargetGUIDs)
+            {
+                Unit* target = targetGUID == caster->GetGUID() ? caster : ObjectAccessor::GetUnit(*caster, targetGUID);
+                if (target != nullptr && target->IsAlive() == true)
+                    validTargets.push_back(target);
+            }
+            return validTargets;
+        }
+
         // Do large groups otherwise
         std::list<Unit*> targetCandidates;
         Acore::AnyUnitInObjectRangeCheck u_check(caster, radius);
@@ -153,26 +203,35 @@ class EverQuest_BardSongAuraScript: public AuraScript
                 validTargets.push_back(caster);
 
             Group* group = player->GetGroup();
-            if (!group)
-                return validTargets;
-            for (Unit* target : targetCandidates)
+            if (group)
             {
-                if (!target->IsPlayer() || !target->IsAlive() || target == caster || !caster->IsWithinLOSInMap(target))
-                    continue;
+                for (Unit* target : targetCandidates)
+                {
+                    if (!target->IsPlayer() || !target->IsAlive() || target == caster || IsUnitInLOS(caster, target, pulseState, nowGameTimeMS) == false)
+                        continue;
 
-                Player* targetPlayer = target->ToPlayer();
-                if (group->SameSubGroup(player->GetGUID(), targetPlayer->GetGUID()) || group->IsMember(targetPlayer->GetGUID()))
-                    validTargets.push_back(targetPlayer);
+                    Player* targetPlayer = target->ToPlayer();
+                    if (group->SameSubGroup(player->GetGUID(), targetPlayer->GetGUID()) || group->IsMember(targetPlayer->GetGUID()))
+                        validTargets.push_back(targetPlayer);
+                }
             }
         }
         else if (bardTargetType == EQ_BARDSONGAURATARGET_ENEMYAREA)
         {
             for (Unit* target : targetCandidates)
             {
-                if (IsUnitAnEnemyInLOS(caster, target) == true)
+                if (IsUnitAnEnemyInLOS(caster, target, pulseState, nowGameTimeMS) == true)
                     validTargets.push_back(target);
             }
         }
+
+        EverQuestBardPulseTargetSet targetSet;
+        targetSet.TargetType = bardTargetType;
+        targetSet.Radius = radius;
+        targetSet.TargetGUIDs.reserve(validTargets.size());
+        for (Unit* target : validTargets)
+            targetSet.TargetGUIDs.push_back(target->GetGUID());
+        pulseState->TargetSetsThisTick.push_back(std::move(targetSet));
         return validTargets;
     }
 
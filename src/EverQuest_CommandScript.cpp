@@ -17,11 +17,14 @@
 */
 
 #include "EverQuest.h"
+#include "EverQuest_SpellTalentAlignment.h"
 #include "Chat.h"
 #include "ScriptMgr.h"
 #include "CommandScript.h"
+#include "GameTime.h"
 #include "boost/algorithm/string.hpp"
 
+#include <algorithm>
 #include <cctype>
 #include <iomanip>
 
@@ -94,6 +97,14 @@ public:
             { "eqface", HandleEQFaceCommand,                    SEC_PLAYER, Console::No },
             { "eqshowbardpulse", HandleEQShowBardPulseCommand,  SEC_PLAYER, Console::No },
             { "eqhidewowgear", HandleEQHideWoWGearCommand,      SEC_PLAYER, Console::No },
+            { "eqpathstats", HandleEQPathStatsCommand,          SEC_GAMEMASTER, Console::Yes },
+            { "eqpathbake", HandleEQPathBakeCommand,            SEC_ADMINISTRATOR, Console::No },
+            { "eqpathfailures", HandleEQPathFailuresCommand,    SEC_GAMEMASTER, Console::Yes },
+            { "eqshipstats", HandleEQShipStatsCommand,          SEC_GAMEMASTER, Console::Yes },
+            { "eqshipreplay", HandleEQShipReplayCommand,        SEC_GAMEMASTER, Console::Yes },
+            { "eqreloaddata", HandleEQReloadDataCommand,        SEC_ADMINISTRATOR, Console::Yes },
+            { "eqbenchproccheck", HandleEQBenchProcCheckCommand, SEC_ADMINISTRATOR, Console::Yes },
+            { "eqbenchbardsongs", HandleEQBenchBardSongsCommand, SEC_ADMINISTRATOR, Console::Yes },
             { "class",  classCommandTable                                               },
             { "track",  trackCommandTable                                               },
         };
@@ -143,7 +154,7 @@ public:
             return true;
 
         Player* player = handler->GetPlayer();
-        uint32 maxFaceIndex = EverQuest->IllusionMaxFaceIndex;
+        uint32 maxFaceIndex = EverQuest->GetWorldData().IllusionMaxFaceIndex;
 
         // Validate the passed value is a number between 0 and the highest known face index
         bool isValidFaceID = false;
@@ -290,6 +301,167 @@ public:
         return true;
     }
 
+    static bool HandleEQPathStatsCommand(ChatHandler* handler, const char* /*args*/)
+    {
+        if (EverQuest->IsEnabled == false)
+            return true;
+
+        EverQuestWaypointLegCacheStats stats = EverQuest->GetWaypointLegCacheStats();
+        uint64 lookups = stats.Hits + stats.Misses;
+        double hitPercent = lookups == 0 ? 0.0 : (double(stats.Hits) * 100.0) / double(lookups);
+        handler->PSendSysMessage("=== Waypoint leg cache ===");
+        handler->PSendSysMessage("Hits: {}  Misses: {}  Hit rate: {:.1f}%", stats.Hits, stats.Misses, hitPercent);
+        handler->PSendSysMessage("Cached legs: {}  Memory: {:.1f} KB", stats.CachedLegCount, double(stats.CachedBytes) / 1024.0);
+        handler->PSendSysMessage("Stored: {}  Invalidated: {}", stats.Stores, stats.InvalidatedLegs);
+        handler->PSendSysMessage("Baked legs: {}  Baked hits: {}", stats.BakedLegCount, stats.BakedHits);
+
+        EverQuestTerrainZCacheStats terrainZStats = EverQuest->GetTerrainZCacheStats();
+        uint64 terrainZLookups = terrainZStats.Hits + terrainZStats.Misses;
+        double terrainZHitPercent = terrainZLookups == 0 ? 0.0 : (double(terrainZStats.Hits) * 100.0) / double(terrainZLookups);
+        handler->PSendSysMessage("=== Terrain Z cache ===");
+        handler->PSendSysMessage("Hits: {}  Misses: {}  Hit rate: {:.1f}%", terrainZStats.Hits, terrainZStats.Misses, terrainZHitPercent);
+        handler->PSendSysMessage("Entries: {}  Evicted: {}  Height queries avoided: {}", terrainZStats.EntryCount, terrainZStats.Evictions, terrainZStats.HeightQueriesAvoided);
+        handler->PSendSysMessage("Last minute: {} hits, {} height queries avoided", terrainZStats.LastMinuteHits, terrainZStats.LastMinuteHeightQueriesAvoided);
+        return true;
+    }
+
+    static bool HandleEQPathFailuresCommand(ChatHandler* handler, const char* /*args*/)
+    {
+        if (EverQuest->IsEnabled == false)
+            return true;
+
+        // Worst maps first, by failed paths and then by how often creatures had to wait for a path generator run
+        vector<EverQuestPathingMapBudget> budgets = EverQuest->GetPathingBudgetsSnapshot();
+        std::sort(budgets.begin(), budgets.end(), [](const EverQuestPathingMapBudget& a, const EverQuestPathingMapBudget& b)
+        {
+            uint64 aFailures = a.WaypointLegFailures + a.RoamPathFailures;
+            uint64 bFailures = b.WaypointLegFailures + b.RoamPathFailures;
+            if (aFailures != bFailures)
+                return aFailures > bFailures;
+            return a.Deferrals > b.Deferrals;
+        });
+
+        handler->PSendSysMessage("=== Pathing offenders (budget {} paths per map update) ===", EQ_MOVE_PATH_BUDGET_PER_MAP_TICK);
+        if (budgets.empty() == true)
+            handler->PSendSysMessage("No map has pathed anything yet");
+        uint64 currentMSTime = GameTime::GetGameTimeMS().count();
+        for (size_t budgetIndex = 0; budgetIndex < budgets.size() && budgetIndex < 10; ++budgetIndex)
+        {
+            const EverQuestPathingMapBudget& budget = budgets[budgetIndex];
+            handler->PSendSysMessage("Map {} instance {}: {} paths, {} waits for budget, {} failed waypoint legs, {} failed roams, {} queued as of the last report", budget.MapID,
+                budget.InstanceID, budget.PathsBuilt, budget.Deferrals, budget.WaypointLegFailures, budget.RoamPathFailures, budget.WaitingCreatures.size());
+
+            vector<std::pair<uint64, EverQuestFailedWaypointLeg>> failedLegs(budget.FailedWaypointLegsByLegKey.begin(), budget.FailedWaypointLegsByLegKey.end());
+            std::sort(failedLegs.begin(), failedLegs.end(), [](const std::pair<uint64, EverQuestFailedWaypointLeg>& a, const std::pair<uint64, EverQuestFailedWaypointLeg>& b)
+            {
+                return a.second.FailCount > b.second.FailCount;
+            });
+            for (size_t legIndex = 0; legIndex < failedLegs.size() && legIndex < 5; ++legIndex)
+            {
+                uint32 waypointListID = 0;
+                uint32 fromWaypointIndex = 0;
+                uint32 toWaypointIndex = 0;
+                EverQuestMod::DecodeWaypointLegCacheKey(failedLegs[legIndex].first, waypointListID, fromWaypointIndex, toWaypointIndex);
+                const EverQuestFailedWaypointLeg& failedLeg = failedLegs[legIndex].second;
+                uint64 retryInSeconds = failedLeg.NextAttemptMSTime > currentMSTime ? (failedLeg.NextAttemptMSTime - currentMSTime) / 1000 : 0;
+                handler->PSendSysMessage("  List {} waypoint index {} -> {}: failed {} times, next try in {}s", waypointListID, fromWaypointIndex, toWaypointIndex,
+                    failedLeg.FailCount, retryInSeconds);
+            }
+        }
+        return true;
+    }
+
+    static bool HandleEQShipStatsCommand(ChatHandler* handler, const char* /*args*/)
+    {
+        if (EverQuest->IsEnabled == false)
+            return true;
+
+        const EverQuestTransportResyncStats& stats = EverQuest->TransportResyncStats;
+        handler->PSendSysMessage("=== Ship resyncs ===");
+        handler->PSendSysMessage("Resyncs: {}  Recreates sent at resync: {}", stats.ResyncsTriggered.load(), stats.RecreatesSent.load());
+        handler->PSendSysMessage("Players deferred: {}  Recreated on approach: {}  Left before needing it: {}", stats.PlayersDeferred.load(),
+            stats.DeferredRecreatesSent.load(), stats.DeferredPlayersDropped.load());
+        return true;
+    }
+
+    static bool HandleEQShipReplayCommand(ChatHandler* handler, const char* /*args*/)
+    {
+        if (EverQuest->IsEnabled == false)
+            return true;
+
+        vector<string> mismatches;
+        uint32 replayedRelocateCount = 0;
+        if (EverQuest->ReplayShipTriggerRoutes(mismatches, replayedRelocateCount) == true)
+        {
+            handler->PSendSysMessage("Ship trigger cursor matched the full scan on all {} replayed relocates", replayedRelocateCount);
+            return true;
+        }
+        handler->PSendSysMessage("Ship trigger cursor differed from the full scan on {} of {} replayed relocates", mismatches.size(), replayedRelocateCount);
+        for (const string& mismatch : mismatches)
+        {
+            LOG_ERROR("module.EverQuest", "EverQuestMod::HandleEQShipReplayCommand {}", mismatch);
+            handler->PSendSysMessage("{}", mismatch);
+        }
+        return true;
+    }
+
+    static bool HandleEQReloadDataCommand(ChatHandler* handler, const char* /*args*/)
+    {
+        if (EverQuest->IsEnabled == false)
+            return true;
+
+        if (EverQuest->StartWorldDataReload() == false)
+        {
+            handler->PSendSysMessage("A world data reload is already running");
+            return true;
+        }
+        handler->PSendSysMessage("Reloading the world data tables in the background, generation {} stays live until the new tables are published (see the server log)",
+            EverQuest->GetWorldDataGeneration());
+        return true;
+    }
+
+    static bool HandleEQBenchProcCheckCommand(ChatHandler* handler, const char* /*args*/)
+    {
+        if (EverQuest->IsEnabled == false)
+            return true;
+
+        // Runs on the world thread, so the server pauses for the length of the measurement
+        handler->SendSysMessage(EverQuestTalentAlignment->MeasureProcCheckThroughput());
+        return true;
+    }
+
+    static bool HandleEQBenchBardSongsCommand(ChatHandler* handler, const char* /*args*/)
+    {
+        if (EverQuest->IsEnabled == false)
+            return true;
+
+        // Runs on the world thread, so the server pauses for the length of the measurement
+        handler->SendSysMessage(EverQuest->MeasureConcurrentBardSongThroughput());
+        return true;
+    }
+
+    static bool HandleEQPathBakeCommand(ChatHandler* handler, const char* /*args*/)
+    {
+        if (EverQuest->IsEnabled == false)
+            return true;
+
+        Player* player = handler->GetPlayer();
+        Map* map = player->GetMap();
+        if (EverQuest->IsMapIDAnEverQuestMap(map->GetId()) == false)
+        {
+            handler->PSendSysMessage("Waypoint legs can only be baked while standing in an EverQuest zone");
+            return true;
+        }
+
+        if (EverQuest->StartWaypointLegBakeForMap(map, player) == false)
+        {
+            handler->PSendSysMessage("Waypoint legs are already being baked for map {}", map->GetId());
+            return true;
+        }
+        handler->PSendSysMessage("Baking waypoint legs for map {} in the background, a few legs per map update.  Stay on the map to see the result here (it also goes to the server log)", map->GetId());
+        return true;
+    }
+
     static bool HandleMultiClassChangeClass(ChatHandler* handler, const char* args)
     {
         if (EverQuest->IsEnabled == false)
@@ -380,12 +552,16 @@ public:
         return true;
     }
 
-    static bool HandleTrackList(ChatHandler* handler, const char* /*args*/)
+    static bool HandleTrackList(ChatHandler* handler, const char* args)
     {
         if (EverQuest->IsEnabled == false)
             return true;
 
-        EverQuest->SendTrackingListToPlayer(handler->GetPlayer());
+        // Addons that understand the packed protocol ask for it by version, and anything else gets the original text rows
+        uint8 protocolVersion = EQ_TRACKING_PROTOCOL_VERSION_TEXT;
+        if (args && *args && atoi(args) == EQ_TRACKING_PROTOCOL_VERSION_PACKED)
+            protocolVersion = EQ_TRACKING_PROTOCOL_VERSION_PACKED;
+        EverQuest->SendTrackingListToPlayer(handler->GetPlayer(), protocolVersion);
         return true;
     }
 
@@ -44,9 +44,11 @@ public:
         EverQuestCreatureInstance CreatureInstanceData;
         Position WaypointAndRoamTargetTravelPosition;
         uint32 PathRetryCount = 0;
+        uint32 RoamPathFailureCount = 0;
 
         // Waypoint
-        vector<EverQuestCreatureWaypoint> CreatureWaypoints;
+        const EverQuestCreatureWaypointSet* CreatureWaypointSet = nullptr;   // Shared and read-only, owned by the world data it was resolved from
+        uint32 CreatureWaypointSetGeneration = 0;                           // World data generation CreatureWaypointSet was resolved from
         uint32 WaypointPriorTargetWaypointIndex = 0;
         uint32 WaypointCurrentTargetWaypointIndex = 0;
         vector<uint32> WaypointRandom10Indices;
@@ -70,9 +72,42 @@ public:
         {
             uint32 creatureGUID = me->GetSpawnId();
             CreatureInstanceData = EverQuest->GetCreatureInstanceData(creatureGUID);
-            CreatureWaypoints.clear();
-            if (CreatureInstanceData.WaypointListID != uint32(-1))
-                CreatureWaypoints = EverQuest->GetWaypoints(CreatureInstanceData.MapID, CreatureInstanceData.WaypointListID);
+            CreatureWaypointSetGeneration = EverQuest->GetWorldDataGeneration();
+            CreatureWaypointSet = EverQuest->GetWaypointSet(CreatureInstanceData.MapID, CreatureInstanceData.WaypointListID);
+        }
+
+        // A world data reload frees the tables the waypoint set pointer points into a few world updates later, so it is resolved again
+        // against the new tables, and any waypoint index past the end of the new list starts over from the first waypoint
+        void RefreshWaypointSetAfterDataReload()
+        {
+            uint32 worldDataGeneration = EverQuest->GetWorldDataGeneration();
+            if (CreatureWaypointSetGeneration == worldDataGeneration)
+                return;
+            CreatureWaypointSetGeneration = worldDataGeneration;
+            CreatureWaypointSet = EverQuest->GetWaypointSet(CreatureInstanceData.MapID, CreatureInstanceData.WaypointListID);
+
+            uint32 waypointCount = uint32(CreatureWaypointSet->Waypoints.size());
+            for (uint32* waypointIndex : { &WaypointPriorTargetWaypointIndex, &WaypointCurrentTargetWaypointIndex, &WaypointRandomPathFinalTargetIndex,
+                &PreAgroCurrentTargetIdx, &PreAgroPriorTargetIdx, &PreAgroFinalTargetIdx })
+            {
+                if (*waypointIndex >= waypointCount)
+                    *waypointIndex = 0;
+            }
+            if (MovementType != EQ_CREATURE_MOVEMENT_CUSTOM_WAYPOINT)
+                return;
+            if (waypointCount == 0)
+            {
+                MovementType = EQ_CREATURE_MOVEMENT_NO_CUSTOM;
+                ActiveMovePhase = EQ_MOVE_PHASE_NONE;
+                events.CancelEvent(EVENT_PAUSE_DONE);
+                return;
+            }
+            if (CreatureInstanceData.WanderType == EQ_GRID_RANDOM_10)
+            {
+                uint32 currentTargetWaypointIndex = WaypointCurrentTargetWaypointIndex;
+                GenerateRandom10WaypointIndicesAndSetPriorIndex();
+                WaypointCurrentTargetWaypointIndex = currentTargetWaypointIndex;
+            }
         }
 
         void Reset() override
@@ -85,6 +120,7 @@ public:
             WaypointPriorTargetWaypointIndex = 0;
             WaypointCurrentTargetWaypointIndex = 0;
             WaypointRandomPathFinalTargetIndex = 0;
+            RoamPathFailureCount = 0;
 
             me->SetWalk(false);
             me->SetUnitMovementFlags(MOVEMENTFLAG_WALKING);
@@ -96,7 +132,7 @@ public:
                     NormalizeRoamZRange(CreatureInstanceData.RoamMinZ, CreatureInstanceData.RoamMaxZ);
                 MovementType = EQ_CREATURE_MOVEMENT_CUSTOM_ROAMING;
             }
-            else if (CreatureWaypoints.empty() == true)
+            else if (CreatureWaypointSet->Waypoints.empty() == true)
                 MovementType = EQ_CREATURE_MOVEMENT_NO_CUSTOM;
             else if (CreatureInstanceData.WanderType == EQ_GRID_RANDOM_10)
             {
@@ -166,98 +202,34 @@ public:
         float GetEffectiveDestinationZ(float priorX, float priorY, float priorZ, float initialTargetX, float initialTargetY, float initialTargetZ,
             bool& foundValidZ, float minZ = 0, float maxZ = 0)
         {
-            if (CreatureInstanceData.DisableGroundContour == true)
-            {
-                foundValidZ = true;
-                return initialTargetZ;
-            }
-            
-            foundValidZ = false;
-
-            // Prior point might be in water
-            bool isPriorPointInWater = false;
-            if (priorX != 0 && priorY != 0 && priorZ != 0)
-            {
-                LiquidData priorLiquidDataBelow = me->GetMap()->GetLiquidData(me->GetPhaseMask(), priorX, priorY, priorZ, 0, {});
-                if (priorLiquidDataBelow.Status)
-                    isPriorPointInWater = true;
-            }
-
-            // Calculate a solid floor
-            float solidFloorZ = -20001;
-            if (minZ != 0 && maxZ != 0)
-            {
-                solidFloorZ = me->GetMapHeight(initialTargetX, initialTargetY, maxZ, true, maxZ - minZ);
-            }
-            else
-            {
-                float targetTestZ = initialTargetZ;
-                int floorLoopNum = 0;
-                float curAddedZStep = 0;
-                if (isPriorPointInWater == false)
-                    curAddedZStep = 1.0f;
-                while (solidFloorZ < -20000)
-                {
-                    targetTestZ = initialTargetZ + (floorLoopNum * curAddedZStep);
-                    curAddedZStep += 1.0f;
-                    float floorSearchDist = floorLoopNum * 20.0f;
-                    if (floorSearchDist > 0.0f)
-                        solidFloorZ = me->GetMapHeight(initialTargetX, initialTargetY, targetTestZ, true, floorSearchDist);
-                    floorLoopNum++;
-                    if (floorLoopNum >= 10)
-                        break;
-                }
-            }
+            return EverQuest->GetEffectiveDestinationZForCreature(me, CreatureInstanceData.DisableGroundContour, priorX, priorY, priorZ, initialTargetX, initialTargetY,
+                initialTargetZ, foundValidZ, minZ, maxZ);
+        }
 
-            if (solidFloorZ < -20000)
+        void GenerateRandom10WaypointIndicesAndSetPriorIndex()
+        {
+            WaypointRandom10Indices.clear();
+            uint32 waypointCount = uint32(CreatureWaypointSet->Waypoints.size());
+            uint32 count = min<uint32>(10u, waypointCount);
+            if (count == waypointCount)
             {
-                // No solid floor means it's out of bounds or over a large body of water, so first test if it's a body of water
-                LiquidData targetLiquidDataBelow = me->GetMap()->GetLiquidData(me->GetPhaseMask(), initialTargetX, initialTargetY, initialTargetZ - EQ_MOVE_TEST_Z_DOWN_AMOUNT_FOR_WATER_TEST, 0, {});
-                if (targetLiquidDataBelow.Status)
-                {
-                    foundValidZ = true;
-                    if (isPriorPointInWater == true && priorZ <= (targetLiquidDataBelow.Level - EQ_MOVE_UNDER_WATER_SURFACE_SKIM_REDICTION))
-                        return priorZ;
-                    else
-                        return targetLiquidDataBelow.Level - EQ_MOVE_UNDER_WATER_SURFACE_SKIM_REDICTION;
-                }
-                else
-                    return initialTargetZ;
+                for (uint32 i = 0; i < waypointCount; ++i)
+                    WaypointRandom10Indices.push_back(i);
             }
             else
             {
-                foundValidZ = true;
-                if (isPriorPointInWater == true)
+                // Draw the ten straight from the shared list rather than shuffling a copy of every index
+                while (WaypointRandom10Indices.size() < count)
                 {
-                    LiquidData targetLiquidDataAtRef = me->GetMap()->GetLiquidData(me->GetPhaseMask(), initialTargetX, initialTargetY, initialTargetZ, 0, {});
-                    if (targetLiquidDataAtRef.Status)
-                    {
-                        float skimLevel = targetLiquidDataAtRef.Level - EQ_MOVE_UNDER_WATER_SURFACE_SKIM_REDICTION;
-                        if (solidFloorZ > priorZ || solidFloorZ > skimLevel)
-                            return solidFloorZ;
-                        else if (priorZ > skimLevel)
-                            return skimLevel;
-                        else
-                            return priorZ;
-                    }
+                    uint32 candidateIndex = urand(0, waypointCount - 1);
+                    if (find(WaypointRandom10Indices.begin(), WaypointRandom10Indices.end(), candidateIndex) == WaypointRandom10Indices.end())
+                        WaypointRandom10Indices.push_back(candidateIndex);
                 }
-                return solidFloorZ;
             }
-        }
-
-        void GenerateRandom10WaypointIndicesAndSetPriorIndex()
-        {
-            WaypointRandom10Indices.clear();
-            vector<uint32> allIndices;
-            for (uint32 i = 0; i < CreatureWaypoints.size(); ++i)
-                allIndices.push_back(i);
 
             // thread_local since creature AIs run on parallel map update threads and mt19937 state is not thread safe
             thread_local mt19937 rng(random_device{}());
-            shuffle(allIndices.begin(), allIndices.end(), rng);
-
-            uint32 count = min<uint32>(10u, allIndices.size());
-            WaypointRandom10Indices.assign(allIndices.begin(), allIndices.begin() + count);
+            shuffle(WaypointRandom10Indices.begin(), WaypointRandom10Indices.end(), rng);
 
             if (WaypointRandom10Indices.empty() == true)
             {
@@ -270,7 +242,7 @@ public:
             float minDist = 1000000.0f;
             for (uint32 i = 0; i < WaypointRandom10Indices.size(); ++i)
             {
-                const auto& wp = CreatureWaypoints[WaypointRandom10Indices[i]];
+                const auto& wp = CreatureWaypointSet->Waypoints[WaypointRandom10Indices[i]];
                 float dist = me->GetExactDist(wp.X, wp.Y, wp.Z);
                 if (dist < minDist)
                 {
@@ -286,132 +258,94 @@ public:
 
         bool BuildPathAndStartPointMovementToTarget(float initialTargetX, float initialTargetY, float initialTargetZ, uint32 moveType, bool run = false)
         {
-            bool foundValidZ = false;
-            float terrainSnappedTargetZ = GetEffectiveDestinationZ(0, 0, 0, initialTargetX, initialTargetY, initialTargetZ, foundValidZ,
-                CreatureInstanceData.RoamMinZ, CreatureInstanceData.RoamMaxZ);
-
-            // Generate a base path to make sure it exists
-            PathGenerator path(me);
-            bool result = path.CalculatePath(initialTargetX, initialTargetY, initialTargetZ, false);
-            PathType pathType = path.GetPathType();
-            bool pathFound = ((result == true) && ((pathType & PATHFIND_NOPATH) == 0));
-            Movement::PointsArray fallbackPath;
-            const Movement::PointsArray* pathNodesPtr = &path.GetPath();
-
-            // If there is no single spline-based path, it was probably too long so break it into parts
-            if (pathFound == false)
-            {
-                float distToTarget = me->GetExactDist(initialTargetX, initialTargetY, terrainSnappedTargetZ);
-                if (distToTarget > 30.0f)
-                {
-                    const float MAX_SAFE_SEGMENT = 220.0f;
-
-                    Position current = me->GetPosition();
-                    float dx = initialTargetX - current.GetPositionX();
-                    float dy = initialTargetY - current.GetPositionY();
-                    float dz = terrainSnappedTargetZ - current.GetPositionZ();
-                    float dist = std::sqrt(dx * dx + dy * dy + dz * dz);
-
-                    if (dist > 5.0f)
-                    {
-                        float ratio = std::min(1.0f, MAX_SAFE_SEGMENT / dist);
-                        float interX = current.GetPositionX() + dx * ratio;
-                        float interY = current.GetPositionY() + dy * ratio;
-                        float interZ = current.GetPositionZ() + dz * ratio;
-
-                        PathGenerator shortPath(me);
-                        bool shortResult = shortPath.CalculatePath(interX, interY, interZ, false);
-                        if (shortResult && (shortPath.GetPathType() & PATHFIND_NOPATH) == 0)
-                        {
-                            fallbackPath = shortPath.GetPath();
-                            if (fallbackPath.size() >= 2)
-                            {
-                                pathNodesPtr = &fallbackPath;
-                                pathFound = true;
-                            }
-                        }
-                    }
-                }
-            }
-
-            if (pathFound == false && foundValidZ == false && MovementType == EQ_CREATURE_MOVEMENT_CUSTOM_ROAMING)
-                return false;
-
-            const Movement::PointsArray& pathNodes = *pathNodesPtr;
-            if (pathNodes.size() < 2)
+            Movement::PointsArray waypointPath;
+            float terrainSnappedTargetZ = 0;
+            if (BuildSnappedPathToTarget(initialTargetX, initialTargetY, initialTargetZ, waypointPath, terrainSnappedTargetZ) == false)
                 return false;
+            StartPointMovementOnPath(waypointPath, initialTargetX, initialTargetY, terrainSnappedTargetZ, moveType, run);
+            return true;
+        }
 
-            // Walk the path to generate steps that are small enough to snap the character to the Z
+        // Waypoint legs come out the same for every creature walking the list, so finished ones are shared through the map's leg cache
+        // Returns false only when the leg could not be pathed.  A creature refused a path generator run this tick is left waiting instead
+        bool StartWaypointLegMovement(uint32 fromWaypointIndex, uint32 toWaypointIndex)
+        {
+            const EverQuestCreatureWaypoint& wp = CreatureWaypointSet->Waypoints[toWaypointIndex];
+            uint64 legCacheKey = 0;
+            bool isLegCacheable = TryGetWaypointLegCacheKey(fromWaypointIndex, toWaypointIndex, legCacheKey);
             Movement::PointsArray waypointPath;
-            waypointPath.emplace_back(me->GetPositionX(), me->GetPositionY(), me->GetPositionZ());
-            Position previousPosition = me->GetPosition();
-            float priorInterimZ = -100001.0f;
-            for (int cornerIndex = 1; cornerIndex < (int)pathNodes.size(); ++cornerIndex)
+            float terrainSnappedTargetZ = 0;
+            if (isLegCacheable == true && EverQuest->TryGetCachedWaypointLeg(me->GetMap(), legCacheKey, waypointPath, terrainSnappedTargetZ) == true)
             {
-                Position corner(pathNodes[cornerIndex].x, pathNodes[cornerIndex].y, pathNodes[cornerIndex].z);
-                bool isFinalCorner = (cornerIndex == (int)pathNodes.size() - 1);
-
-                float segDX = corner.GetPositionX() - previousPosition.GetPositionX();
-                float segDY = corner.GetPositionY() - previousPosition.GetPositionY();
-                float segDZ = corner.GetPositionZ() - previousPosition.GetPositionZ();
-                float segLength = std::sqrt(segDX * segDX + segDY * segDY + segDZ * segDZ);
+                waypointPath[0] = G3D::Vector3(me->GetPositionX(), me->GetPositionY(), me->GetPositionZ());
+                StartPointMovementOnPath(waypointPath, wp.X, wp.Y, terrainSnappedTargetZ, EQ_MOVE_PHASE_TRAVELING, false);
+                return true;
+            }
 
-                if (segLength < 0.001f)
-                    continue;
+            if (EverQuest->TryReservePathingBudget(me) == false)
+            {
+                WaitForNextMovement(EQ_MOVE_PATH_BUDGET_WAIT_MS);
+                return true;
+            }
 
-                float ux = segDX / segLength;
-                float uy = segDY / segLength;
-                float uz = segDZ / segLength;
+            // The result only says something about the leg when the path started at its from-waypoint.  After a reset the creature is at its
+            // spawn point, and after an evade wherever it fought, so a failure from there is not held against the leg
+            bool pathBuilt = BuildSnappedPathToTarget(wp.X, wp.Y, wp.Z, waypointPath, terrainSnappedTargetZ);
+            uint64 legKey = 0;
+            if (IsStandingOnWaypoint(fromWaypointIndex) == true && TryGetWaypointLegKey(fromWaypointIndex, toWaypointIndex, legKey) == true)
+                EverQuest->RecordWaypointLegPathResult(me->GetMap(), legKey, pathBuilt);
+            if (pathBuilt == false)
+                return false;
+            if (isLegCacheable == true)
+                EverQuest->StoreCachedWaypointLeg(me->GetMap(), legCacheKey, waypointPath, terrainSnappedTargetZ);
+            StartPointMovementOnPath(waypointPath, wp.X, wp.Y, terrainSnappedTargetZ, EQ_MOVE_PHASE_TRAVELING, false);
+            return true;
+        }
 
-                float endThreshold = isFinalCorner ? EQ_MOVE_SMALL_STEP_SIZE_LAST_DISTANCE : EQ_MOVE_SMALL_STEP_SIZE_DISTANCE;
-                float remainingDistance = segLength;
+        bool TryGetWaypointLegKey(uint32 fromWaypointIndex, uint32 toWaypointIndex, uint64& legKeyOut) const
+        {
+            if (fromWaypointIndex > EQ_MOVE_PATH_CACHE_MAX_WAYPOINT_INDEX || toWaypointIndex > EQ_MOVE_PATH_CACHE_MAX_WAYPOINT_INDEX || fromWaypointIndex >= CreatureWaypointSet->Waypoints.size())
+                return false;
+            legKeyOut = EverQuestMod::MakeWaypointLegCacheKey(CreatureInstanceData.WaypointListID, fromWaypointIndex, toWaypointIndex, CreatureInstanceData.DisableGroundContour, me->CanFly());
+            return true;
+        }
 
-                bool nodeCapReached = false;
-                while (remainingDistance > endThreshold)
-                {
-                    // Prevent oversizing paths
-                    if (waypointPath.size() >= EQ_MOVE_MAX_PATH_NODES)
-                    {
-                        nodeCapReached = true;
-                        break;
-                    }
-
-                    float interimX = previousPosition.GetPositionX() + ux * EQ_MOVE_SMALL_STEP_SIZE_DISTANCE;
-                    float interimY = previousPosition.GetPositionY() + uy * EQ_MOVE_SMALL_STEP_SIZE_DISTANCE;
-                    float interimZ = previousPosition.GetPositionZ() + uz * EQ_MOVE_SMALL_STEP_SIZE_DISTANCE;
-
-                    if (priorInterimZ < -100000)
-                        priorInterimZ = interimZ;
-
-                    interimZ = GetEffectiveDestinationZ(previousPosition.GetPositionX(), previousPosition.GetPositionY(),
-                        previousPosition.GetPositionZ(), interimX, interimY, priorInterimZ, foundValidZ,
-                        CreatureInstanceData.RoamMinZ, CreatureInstanceData.RoamMaxZ);
-
-                    waypointPath.emplace_back(interimX, interimY, interimZ);
-                    previousPosition = Position(interimX, interimY, interimZ);
-                    remainingDistance -= EQ_MOVE_SMALL_STEP_SIZE_DISTANCE;
-                    priorInterimZ = interimZ;
-                }
+        bool TryGetWaypointLegCacheKey(uint32 fromWaypointIndex, uint32 toWaypointIndex, uint64& legKeyOut) const
+        {
+            // Roam Z bands are per spawn, so only legs that snap the same way for everyone are shared
+            if (CreatureInstanceData.RoamMinZ != 0 || CreatureInstanceData.RoamMaxZ != 0)
+                return false;
+            if (TryGetWaypointLegKey(fromWaypointIndex, toWaypointIndex, legKeyOut) == false)
+                return false;
 
-                // When cap is hit, stop at the last interim node instead of an unsnapped one
-                if (nodeCapReached)
-                    break;
+            // The cached leg starts where the first walker stood, so this one has to be standing on the same waypoint
+            return IsStandingOnWaypoint(fromWaypointIndex);
+        }
 
-                // Add corner
-                float refZ = (priorInterimZ < -100000.0f) ? corner.GetPositionZ() : priorInterimZ;
-                float cornerZ = GetEffectiveDestinationZ(previousPosition.GetPositionX(), previousPosition.GetPositionY(),
-                    previousPosition.GetPositionZ(), corner.GetPositionX(), corner.GetPositionY(), refZ,
-                    foundValidZ, CreatureInstanceData.RoamMinZ, CreatureInstanceData.RoamMaxZ);
+        bool IsStandingOnWaypoint(uint32 waypointIndex) const
+        {
+            if (waypointIndex >= CreatureWaypointSet->Waypoints.size())
+                return false;
+            const EverQuestCreatureWaypoint& waypoint = CreatureWaypointSet->Waypoints[waypointIndex];
+            return me->GetExactDist2d(waypoint.X, waypoint.Y) <= EQ_MOVE_PATH_CACHE_START_TOLERANCE;
+        }
 
-                waypointPath.emplace_back(corner.GetPositionX(), corner.GetPositionY(), cornerZ);
-                previousPosition = Position(corner.GetPositionX(), corner.GetPositionY(), cornerZ);
-                priorInterimZ = cornerZ;
-            }
+        bool IsWaypointLegBackingOff(uint32 fromWaypointIndex, uint32 toWaypointIndex) const
+        {
+            uint64 legKey = 0;
+            if (TryGetWaypointLegKey(fromWaypointIndex, toWaypointIndex, legKey) == false)
+                return false;
+            return EverQuest->IsWaypointLegBackingOff(me->GetMap(), legKey);
+        }
 
-            // Add for saftey, though this shouldn't happen...
-            if (waypointPath.size() <= 1)
-                waypointPath.emplace_back(initialTargetX, initialTargetY, terrainSnappedTargetZ);
+        bool BuildSnappedPathToTarget(float initialTargetX, float initialTargetY, float initialTargetZ, Movement::PointsArray& waypointPath, float& terrainSnappedTargetZ)
+        {
+            return EverQuest->BuildSnappedPathForCreature(me, CreatureInstanceData, MovementType == EQ_CREATURE_MOVEMENT_CUSTOM_ROAMING, me->GetPosition(),
+                initialTargetX, initialTargetY, initialTargetZ, waypointPath, terrainSnappedTargetZ);
+        }
 
+        void StartPointMovementOnPath(Movement::PointsArray& waypointPath, float initialTargetX, float initialTargetY, float terrainSnappedTargetZ, uint32 moveType, bool run)
+        {
             // Track intended destination
             if (moveType == EQ_MOVE_PHASE_TRAVELING)
             {
@@ -430,8 +364,6 @@ public:
             ActiveMovePhase = moveType;
             if (moveType == EQ_MOVE_PHASE_TRAVELING)
                 PathRetryCount = 0;
-
-            return true;
         }
 
         void OnCustomPathCompleted()
@@ -440,7 +372,7 @@ public:
             {
                 ActiveMovePhase = EQ_MOVE_PHASE_NONE;
                 WaypointPriorTargetWaypointIndex = WaypointCurrentTargetWaypointIndex;
-                const EverQuestCreatureWaypoint& wp = CreatureWaypoints[WaypointPriorTargetWaypointIndex];
+                const EverQuestCreatureWaypoint& wp = CreatureWaypointSet->Waypoints[WaypointPriorTargetWaypointIndex];
                 if (wp.PauseInSec > 0)
                     events.ScheduleEvent(EVENT_PAUSE_DONE, Seconds(wp.PauseInSec));
                 else
@@ -462,11 +394,11 @@ public:
             // Make sure it's always a new waypoint, when possible
             uint32 priorIndex = currentIndex;
             uint32 newIndex = currentIndex;
-            if (CreatureWaypoints.size() > 1)
+            if (CreatureWaypointSet->Waypoints.size() > 1)
             {
                 do
                 {
-                    newIndex = urand(0, CreatureWaypoints.size() - 1);
+                    newIndex = urand(0, CreatureWaypointSet->Waypoints.size() - 1);
                 } while (newIndex == priorIndex);
             }
             return newIndex;
@@ -497,33 +429,57 @@ public:
                 ActiveMovePhase = EQ_MOVE_PHASE_NONE;
                 return;
             }
-            
-            events.ScheduleEvent(EVENT_PAUSE_DONE, 100ms);
+
+            uint32 retryDelayInMS = min<uint32>(EQ_MOVE_PATH_RETRY_BASE_MS << min<uint32>(PathRetryCount - 1, 16), EQ_MOVE_PATH_RETRY_MAX_MS);
+            WaitForNextMovement(retryDelayInMS);
+        }
+
+        void WaitForNextMovement(uint32 delayInMS)
+        {
+            events.ScheduleEvent(EVENT_PAUSE_DONE, Milliseconds(delayInMS));
             ActiveMovePhase = EQ_MOVE_PHASE_WAITING_FOR_TIMER;
         }
 
-        void PerformWaypointMovementForRandom10()
+        void StartCurrentWaypointLegOrRetry()
         {
-            WaypointCurrentTargetWaypointIndex = GetUniqueRandomWaypointIndexFromRandom10(WaypointCurrentTargetWaypointIndex);
-            const EverQuestCreatureWaypoint& wp = CreatureWaypoints[WaypointCurrentTargetWaypointIndex];
-            if (BuildPathAndStartPointMovementToTarget(wp.X, wp.Y, wp.Z, EQ_MOVE_PHASE_TRAVELING) == false)
+            // The map recently failed to path this leg, so wait it out rather than asking the path generator again
+            if (IsWaypointLegBackingOff(WaypointPriorTargetWaypointIndex, WaypointCurrentTargetWaypointIndex) == true)
+            {
+                WaitForNextMovement(EQ_MOVE_PATH_BACKOFF_BASE_MS);
+                return;
+            }
+            if (StartWaypointLegMovement(WaypointPriorTargetWaypointIndex, WaypointCurrentTargetWaypointIndex) == false)
                 ScheduleMovementRetry();
         }
 
+        void PerformWaypointMovementForRandom10()
+        {
+            uint32 pickCount = 0;
+            do
+            {
+                WaypointCurrentTargetWaypointIndex = GetUniqueRandomWaypointIndexFromRandom10(WaypointCurrentTargetWaypointIndex);
+                pickCount++;
+            } while (pickCount < EQ_MOVE_PATH_BACKOFF_MAX_TARGET_PICKS && IsWaypointLegBackingOff(WaypointPriorTargetWaypointIndex, WaypointCurrentTargetWaypointIndex) == true);
+            StartCurrentWaypointLegOrRetry();
+        }
+
         void PerformWaypointMovementForRandomAny()
         {
-            WaypointCurrentTargetWaypointIndex = GetUniqueRandomWaypointIndex(WaypointCurrentTargetWaypointIndex);
-            const EverQuestCreatureWaypoint& wp = CreatureWaypoints[WaypointCurrentTargetWaypointIndex];
-            if (BuildPathAndStartPointMovementToTarget(wp.X, wp.Y, wp.Z, EQ_MOVE_PHASE_TRAVELING) == false)
-                ScheduleMovementRetry();
+            uint32 pickCount = 0;
+            do
+            {
+                WaypointCurrentTargetWaypointIndex = GetUniqueRandomWaypointIndex(WaypointCurrentTargetWaypointIndex);
+                pickCount++;
+            } while (pickCount < EQ_MOVE_PATH_BACKOFF_MAX_TARGET_PICKS && IsWaypointLegBackingOff(WaypointPriorTargetWaypointIndex, WaypointCurrentTargetWaypointIndex) == true);
+            StartCurrentWaypointLegOrRetry();
         }
 
         void PerformWaypointMovementForRandomPath()
         {
             // A single-waypoint path can never step, and the index math below would underflow
-            if (CreatureWaypoints.size() < 2)
+            if (CreatureWaypointSet->Waypoints.size() < 2)
                 return;
-            if (WaypointPriorTargetWaypointIndex >= CreatureWaypoints.size())
+            if (WaypointPriorTargetWaypointIndex >= CreatureWaypointSet->Waypoints.size())
                 WaypointPriorTargetWaypointIndex = FindNearestWaypointIndex();
 
             if (WaypointPriorTargetWaypointIndex == WaypointRandomPathFinalTargetIndex)
@@ -535,29 +491,12 @@ public:
             else
                 WaypointCurrentTargetWaypointIndex = WaypointPriorTargetWaypointIndex - 1;
 
-            const EverQuestCreatureWaypoint& wp = CreatureWaypoints[WaypointCurrentTargetWaypointIndex];
-            if (BuildPathAndStartPointMovementToTarget(wp.X, wp.Y, wp.Z, EQ_MOVE_PHASE_TRAVELING) == false)
-                ScheduleMovementRetry();
+            StartCurrentWaypointLegOrRetry();
         }
 
         uint32 FindNearestWaypointIndex() const
         {
-            if (CreatureWaypoints.empty())
-                return 0;
-
-            uint32 nearest = 0;
-            float minDist = 1000000.0f;
-            for (uint32 i = 0; i < CreatureWaypoints.size(); ++i)
-            {
-                const auto& wp = CreatureWaypoints[i];
-                float dist = me->GetExactDist(wp.X, wp.Y, wp.Z);
-                if (dist < minDist)
-                {
-                    minDist = dist;
-                    nearest = i;
-                }
-            }
-            return nearest;
+            return EverQuestMod::FindNearestWaypointIndex(*CreatureWaypointSet, me->GetPositionX(), me->GetPositionY(), me->GetPositionZ());
         }
 
         void PerformRoamingMovement()
@@ -570,18 +509,33 @@ public:
             float z = GetEffectiveDestinationZ(me->GetPositionX(), me->GetPositionY(), me->GetPositionZ(), x, y, referenceZ, isValidPoint, CreatureInstanceData.RoamMinZ, CreatureInstanceData.RoamMaxZ);
 
             if (isValidPoint == true)
+            {
+                if (EverQuest->TryReservePathingBudget(me) == false)
+                {
+                    WaitForNextMovement(EQ_MOVE_PATH_BUDGET_WAIT_MS);
+                    return;
+                }
                 isValidPoint = BuildPathAndStartPointMovementToTarget(x, y, z, EQ_MOVE_PHASE_TRAVELING);
+                if (isValidPoint == true)
+                    RoamPathFailureCount = 0;
+                else
+                {
+                    RoamPathFailureCount++;
+                    EverQuest->RecordRoamPathFailure(me->GetMap());
+                }
+            }
 
+            // Each failed path in a row doubles the wait, so roamers over a broken navmesh stop leaning on the path generator
             if (isValidPoint == false)
             {
-                events.ScheduleEvent(EVENT_PAUSE_DONE, 100ms);
-                ActiveMovePhase = EQ_MOVE_PHASE_WAITING_FOR_TIMER;
+                WaitForNextMovement(min<uint32>(EQ_MOVE_PATH_RETRY_BASE_MS << min<uint32>(RoamPathFailureCount, 16), EQ_MOVE_PATH_RETRY_MAX_MS));
                 return;
             }
         }
 
         void MovementInform(uint32 type, uint32 id) override
         {
+            RefreshWaypointSetAfterDataReload();
             if (type == WAYPOINT_MOTION_TYPE)
             {
                 if (CreatureInstanceData.DespawnAtWaypointNum != -1 && id == static_cast<uint32>(CreatureInstanceData.DespawnAtWaypointNum))
@@ -591,6 +545,7 @@ public:
 
         void UpdateAI(uint32 diff) override
         {
+            RefreshWaypointSetAfterDataReload();
             events.Update(diff);
             while (uint32 eventId = events.ExecuteEvent())
             {
@@ -616,10 +571,14 @@ public:
 
         void JustEngagedWith(Unit* /*who*/) override
         {
+            RefreshWaypointSetAfterDataReload();
             events.CancelEvent(EVENT_PAUSE_DONE);
             if (MovementType == EQ_CREATURE_MOVEMENT_NO_CUSTOM)
                 return;
 
+            // Fighting creatures don't start new legs, so any place this one held in the path queue goes to the next walker
+            EverQuest->RemovePathingBudgetWaiter(me);
+
             // Snapshot the full waypoint state so EnterEvadeMode can restore it after since Reset() overwrites everything
             PreAgroCurrentTargetIdx = WaypointCurrentTargetWaypointIndex;
             PreAgroPriorTargetIdx = WaypointPriorTargetWaypointIndex;
@@ -633,6 +592,7 @@ public:
 
         void EnterEvadeMode(EvadeReason why) override
         {
+            RefreshWaypointSetAfterDataReload();
             ScriptedAI::EnterEvadeMode(why);
             if (MovementType == EQ_CREATURE_MOVEMENT_NO_CUSTOM)
                 return;
@@ -0,0 +1,54 @@
+//  Author: Nathan Handley (nathanhandley@protonmail.com)
+//  Copyright (c) 2026 Nathan Handley
+//
+//  This program is free software; you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published by the
+//  Free Software Foundation; either version 3 of the License, or (at your
+//  option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.See the GNU Affero General Public License for
+//  more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Group.h"
+#include "ScriptMgr.h"
+
+#include "EverQuest.h"
+
+using namespace std;
+
+class EverQuest_GroupScript : public GroupScript
+{
+public:
+    EverQuest_GroupScript() : GroupScript("EverQuest_GroupScript") {}
+
+    void OnAddMember(Group* group, ObjectGuid /*guid*/) override
+    {
+        if (EverQuest->IsEnabled == false)
+            return;
+        EverQuest->InvalidateZoneWideGroupMemberCache(group);
+    }
+
+    void OnRemoveMember(Group* group, ObjectGuid /*guid*/, RemoveMethod /*method*/, ObjectGuid /*kicker*/, const char* /*reason*/) override
+    {
+        if (EverQuest->IsEnabled == false)
+            return;
+        EverQuest->InvalidateZoneWideGroupMemberCache(group);
+    }
+
+    void OnDisband(Group* group) override
+    {
+        if (EverQuest->IsEnabled == false)
+            return;
+        EverQuest->InvalidateZoneWideGroupMemberCache(group);
+    }
+};
+
+void AddEverQuestGroupScripts()
+{
+    new EverQuest_GroupScript();
+}
@@ -41,6 +41,7 @@ void AddEverQuestCreatureInstanceScripts();
 void AddEverQuestGossipScripts();
 void AddEverQuestMiscScripts();
 void AddEverQuestAreaTriggerScripts();
+void AddEverQuestGroupScripts();
 
 void Addmod_everquestScripts()
 {
@@ -71,4 +72,5 @@ void Addmod_everquestScripts()
     AddEverQuestGossipScripts();
     AddEverQuestMiscScripts();
     AddEverQuestAreaTriggerScripts();
+    AddEverQuestGroupScripts();
 }
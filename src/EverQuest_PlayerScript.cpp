@@ -27,6 +27,7 @@
 #include "Spell.h"
 #include "SpellMgr.h"
 #include "QuestDef.h"
+#include "Timer.h"
 #include "World.h"
 #include "WorldSession.h"
 
@@ -320,7 +321,8 @@ public:
             return;
 
         // Earned reputation crossing a rank boundary can change temporary faction adjustments
-        if (EverQuest->EQReputationFactionInfoByFactionID.find(factionID) != EverQuest->EQReputationFactionInfoByFactionID.end())
+        const EverQuestWorldData& worldData = EverQuest->GetWorldData();
+        if (worldData.EQReputationFactionInfoByFactionID.find(factionID) != worldData.EQReputationFactionInfoByFactionID.end())
             EverQuest->QueueTemporaryFactionRecalculationForPlayer(player->GetGUID());
     }
 
@@ -357,7 +359,7 @@ public:
         if (zoneWideKiller != nullptr && zoneWideKiller->GetGroup() != nullptr && EverQuest->IsZoneWideGroupRewardEnabledForMap(zoneWideKiller->GetMapId()) == true)
         {
             EverQuestZoneWideKillReward zoneWideReward;
-            EverQuest->BuildZoneWideKillReward(zoneWideKiller->GetGroup(), zoneWideKiller, zoneWideVictim, zoneWideReward);
+            EverQuest->BuildZoneWideKillReward(zoneWideKiller->GetGroup(), rewarder, zoneWideKiller, zoneWideVictim, zoneWideReward);
             if (zoneWideReward.IsValid == true)
             {
                 // This already accounts for the alternate group formula when it is turned on
@@ -576,12 +578,20 @@ public:
         if (EverQuest->IsEnabled == false)
             return;
 
+        uint32 loginStartMSTime = getMSTime();
+
         // Start the grace timer for the client data version report (kicks stale clients that bypassed the update launcher)
         EverQuest->BeginClientVersionCheckForPlayer(player);
 
         // Pick up a character that logged out inside a raid instance
         EverQuest->UpdateRaidLowInstanceStateForPlayer(player);
 
+        // The group's zone-wide reward list was built without this member
+        EverQuest->InvalidateZoneWideGroupMemberCacheForPlayer(player);
+
+        // Logout stopped counting a character that hides bard pulses, and its controller data stayed cached so it won't be counted on load
+        EverQuest->RetrackBardPulseHiddenForPlayerLogin(player);
+
         // First login behavior
         if (player->HasAtLoginFlag(AT_LOGIN_FIRST) == true)
         {
@@ -630,21 +640,7 @@ public:
 
         // Grab any cast bard songs for the player
         if (EverQuest->ConfigBardMaxConcurrentSongs != 0)
-        {
-            deque<uint32>* queue = nullptr;
-            {
-                std::lock_guard<std::mutex> lock(EverQuest->RuntimeStateMutex);
-                queue = &EverQuest->PlayerCasterConcurrentBardSongs[player->GetGUID()];
-            }
-            queue->clear();
-            for (auto const& itr : player->GetAppliedAuras())
-            {
-                AuraApplication const* aurApp = itr.second;
-                uint32 spellID = aurApp->GetBase()->GetId();
-                if (EverQuest->IsSpellAnEQBardSong(spellID) == true)
-                    queue->push_back(spellID);
-            }
-        }
+            EverQuest->RebuildConcurrentBardSongsForPlayer(player);
 
         // Autolearning is based on EQ classes (primary and secondary)
         EverQuest->ApplyAutoLearnedClassSkillsAndSpells(player);
@@ -687,6 +683,10 @@ public:
 
         // Check gear to see if the agile fighter buff should trigger a sub buff
         EverQuest->ReapplyAgileFighterCombatAuraForPlayer(player);
+
+        // Everything that reads the login data has run, so later reads go back to the database
+        EverQuest->ClearLoginDataForPlayer(player->GetGUID());
+        LOG_DEBUG("module.EverQuest", "EverQuestMod OnPlayerLogin for player {} with GUID {} took {} ms", player->GetName(), player->GetGUID().GetCounter(), GetMSTimeDiffToNow(loginStartMSTime));
     }
 
     void OnPlayerLevelChanged(Player* player, uint8 /*oldlevel*/) override
@@ -730,6 +730,8 @@ public:
             return;
 
         EverQuest->ClearClientVersionCheckForPlayer(player->GetGUID());
+        EverQuest->ClearLoginDataForPlayer(player->GetGUID());
+        EverQuest->InvalidateZoneWideGroupMemberCacheForPlayer(player);
 
         // Stop counting the character as being inside a raid instance
         EverQuest->ClearRaidLowInstanceStateForPlayer(player->GetGUID());
@@ -737,12 +739,6 @@ public:
         // Don't leave a swapped native display behind (it is not saved, but the tracking entry must not linger)
         EverQuest->RestoreNativeDisplayAfterCorpseIllusion(player);
 
-        if (EverQuest->ConfigBardMaxConcurrentSongs != 0)
-        {
-            std::lock_guard<std::mutex> lock(EverQuest->RuntimeStateMutex);
-            EverQuest->PlayerCasterConcurrentBardSongs.erase(player->GetGUID());
-        }
-
         // Apply any pending level cap experience park before the character saves
         if (EverQuest->ConfigPlayerLevelCap != 0)
             EverQuest->ProcessLevelCapStateForPlayer(player);
@@ -765,6 +761,9 @@ public:
         // Stop tracking any temporary faction adjustment state
         EverQuest->ClearTemporaryFactionStateForPlayer(player->GetGUID());
 
+        // Stop counting the character as hiding bard pulses, so the spell packet fast path comes back once nobody online hides them
+        EverQuest->UntrackBardPulseHiddenForPlayerLogout(player->GetGUID());
+
         // Stop tracking the auction "Usable Items" filter state
         EverQuest->SetAuctionUsableFilterActiveForPlayer(player->GetGUID(), false);
 
@@ -810,6 +809,9 @@ public:
         // Catch map switches that bypass TeleportTo
         EverQuest->ClearTempFactionBonusForPlayer(player);
 
+        // Zone-wide group rewards bucket members by map
+        EverQuest->InvalidateZoneWideGroupMemberCacheForPlayer(player);
+
         // Track entering and leaving raid instances, which drives whether a zone line back in should return the player to theirs
         EverQuest->UpdateRaidLowInstanceStateForPlayer(player);
 
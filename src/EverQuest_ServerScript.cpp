@@ -23,24 +23,32 @@
 
 #include "EverQuest.h"
 
+#include <bit>
+#include <cstring>
+
 using namespace std;
 
 // Both SMSG_SPELL_START and SMSG_SPELL_GO open with two packed guids (cast item or caster, then caster), a cast count byte, and then the spell ID.
+// Reads straight out of the const buffer by offset, since this runs for every spell packet sent
 static uint32 ExtractSpellIDFromSpellStartOrGoPacket(WorldPacket const& packet)
 {
-    WorldPacket packetCopy(packet);
-    packetCopy.rpos(0);
+    size_t packetSize = packet.size();
+    size_t readPos = 0;
     try
     {
-        uint64 itemOrCasterGUID = 0;
-        packetCopy.readPackGUID(itemOrCasterGUID);
-        uint64 casterGUID = 0;
-        packetCopy.readPackGUID(casterGUID);
-        uint8 castCount = 0;
-        packetCopy >> castCount;
-        uint32 spellID = 0;
-        packetCopy >> spellID;
-        return spellID;
+        // A packed guid is a mask byte followed by one byte per set mask bit
+        for (uint8 i = 0; i < 2; ++i)
+        {
+            if (readPos >= packetSize)
+                return 0;
+            readPos += 1 + std::popcount(packet.read<uint8>(readPos));
+        }
+
+        // Skip the cast count
+        readPos += 1;
+        if (readPos + sizeof(uint32) > packetSize)
+            return 0;
+        return packet.read<uint32>(readPos);
     }
     catch (ByteBufferException const&)
     {
@@ -49,6 +57,32 @@ static uint32 ExtractSpellIDFromSpellStartOrGoPacket(WorldPacket const& packet)
     }
 }
 
+// Field layout must match WorldSession::HandleAuctionListItems (auctioneer guid, list from, searched name, level min/max, slot, main category,
+// sub category, quality, usable).  Reads by offset without copying the packet
+static bool TryReadUsableFlagFromAuctionListItemsPacket(WorldPacket const& packet, bool& isUsableOnly)
+{
+    static const size_t searchedNameOffset = 8 + 4;
+    size_t packetSize = packet.size();
+    if (packetSize <= searchedNameOffset)
+        return false;
+    try
+    {
+        uint8 const* packetContents = packet.contents();
+        void const* searchedNameEnd = memchr(packetContents + searchedNameOffset, 0, packetSize - searchedNameOffset);
+        if (searchedNameEnd == nullptr)
+            return false;
+        size_t usablePos = (size_t)((uint8 const*)searchedNameEnd - packetContents) + 1 + 1 + 1 + 4 + 4 + 4 + 4;
+        if (usablePos >= packetSize)
+            return false;
+        isUsableOnly = packet.read<uint8>(usablePos) != 0;
+        return true;
+    }
+    catch (ByteBufferException const&)
+    {
+        return false;
+    }
+}
+
 // Returns false when a replacement packet with EQ-class-unusable auctions removed was sent in place of the original
 static bool HandleAuctionListResultPacketSend(WorldSession* session, WorldPacket const& packet)
 {
@@ -72,9 +106,16 @@ class EverQuest_ServerScript : public ServerScript
 public:
     EverQuest_ServerScript() : ServerScript("EverQuest_ServerScript", { SERVERHOOK_CAN_PACKET_SEND, SERVERHOOK_CAN_PACKET_RECEIVE }) { }
 
-    // Watches auction search results to learn whether a player's "Usable Items" checkbox is set
+    // Watches auction search results to learn whether a player's "Usable Items" checkbox is set, and starts loading the mod's character data
+    // as soon as a character is picked to enter the world
     bool CanPacketReceive(WorldSession* session, WorldPacket const& packet) override
     {
+        if (packet.GetOpcode() == CMSG_PLAYER_LOGIN)
+        {
+            if (EverQuest->IsEnabled == true && packet.size() >= sizeof(uint64))
+                EverQuest->QueueLoginDataLoadForPlayer(session, ObjectGuid(packet.read<uint64>(0)));
+            return true;
+        }
         if (packet.GetOpcode() != CMSG_AUCTION_LIST_ITEMS)
             return true;
         if (EverQuest->IsEnabled == false)
@@ -83,27 +124,9 @@ public:
         if (player == nullptr)
             return true;
 
-        // Field layout must match WorldSession::HandleAuctionListItems
-        WorldPacket packetCopy(packet);
-        packetCopy.rpos(0);
-        try
-        {
-            ObjectGuid auctioneerGUID;
-            uint32 listFrom;
-            std::string searchedName;
-            uint8 levelMin, levelMax, usable;
-            uint32 auctionSlotID, auctionMainCategory, auctionSubCategory, quality;
-            packetCopy >> auctioneerGUID;
-            packetCopy >> listFrom;
-            packetCopy >> searchedName;
-            packetCopy >> levelMin >> levelMax;
-            packetCopy >> auctionSlotID >> auctionMainCategory >> auctionSubCategory;
-            packetCopy >> quality >> usable;
-            EverQuest->SetAuctionUsableFilterActiveForPlayer(player->GetGUID(), usable != 0);
-        }
-        catch (ByteBufferException const&)
-        {
-        }
+        bool isUsableOnly = false;
+        if (TryReadUsableFlagFromAuctionListItemsPacket(packet, isUsableOnly) == true)
+            EverQuest->SetAuctionUsableFilterActiveForPlayer(player->GetGUID(), isUsableOnly);
         return true;
     }
 
@@ -116,14 +139,19 @@ public:
             return HandleAuctionListResultPacketSend(session, packet);
         if (opcode != SMSG_SPELL_GO && opcode != SMSG_SPELL_START)
             return true;
-        if (EverQuest->IsEnabled == false || EverQuest->BardSongTickSpellIDs.empty() == true)
+
+        // Nobody has pulses hidden, so there's nothing to drop
+        if (EverQuest->PlayersWithBardPulseHiddenCount.load(std::memory_order_relaxed) == 0)
+            return true;
+        const EverQuestWorldData& worldData = EverQuest->GetWorldData();
+        if (EverQuest->IsEnabled == false || worldData.BardSongTickSpellIDs.empty() == true)
             return true;
         Player* player = session->GetPlayer();
         if (player == nullptr)
             return true;
 
         uint32 spellID = ExtractSpellIDFromSpellStartOrGoPacket(packet);
-        if (spellID == 0 || EverQuest->BardSongTickSpellIDs.find(spellID) == EverQuest->BardSongTickSpellIDs.end())
+        if (spellID == 0 || worldData.BardSongTickSpellIDs.find(spellID) == worldData.BardSongTickSpellIDs.end())
             return true;
         return EverQuest->GetShowBardPulseForPlayer(player);
     }
@@ -23,9 +23,14 @@
 #include "SpellAuras.h"
 #include "SpellInfo.h"
 #include "SpellMgr.h"
+#include "Timer.h"
 
 #include "EverQuest.h"
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
 EverQuestSpellTalentAlignment* EverQuestSpellTalentAlignment::instance()
 {
     static EverQuestSpellTalentAlignment instance;
@@ -257,186 +262,288 @@ void EverQuestSpellTalentAlignment::Load()
     if (ExcludedTalentSpellIDs.empty() == true && ExcludedTalentRank1SpellIDs.empty() == false)
         LOG_ERROR("module", "EverQuest: Talent alignment has {} exclusion rows but matched no talents, check that mod_everquest_talent_exclusion holds the first rank spell IDs",
             ExcludedTalentRank1SpellIDs.size());
+
+    BuildReachMatrix();
 }
 
-bool EverQuestSpellTalentAlignment::DoesSpellInfoDamage(SpellInfo const* spellInfo)
+void EverQuestSpellTalentAlignment::BuildReachMatrix()
 {
+    uint32 buildStartMSTime = getMSTime();
+    ReachPairBaseIndexByTalentSpellID.clear();
+    ReachRowIndexByEQSpellIDOffset.clear();
+    ReachRowBits.clear();
+    ReachPairNeedsModCheckBits.clear();
+    ReachMatrixEQSpellIDBase = EverQuest->ConfigSystemSpellDBCIDMin;
+    ReachMatrixWordsPerRow = 0;
+
+    // Hand out pair indexes to every talent spell that has an alignment (excluded talents never reach anything)
+    uint32 maxTalentSpellID = 0;
+    for (auto const& alignmentEntry : AlignmentsByTalentSpellIDAndEffect)
+        maxTalentSpellID = std::max(maxTalentSpellID, static_cast<uint32>(alignmentEntry.first >> 8));
+    ReachPairBaseIndexByTalentSpellID.assign(static_cast<size_t>(maxTalentSpellID) + 1, std::numeric_limits<uint32>::max());
+    std::vector<std::pair<uint32, EverQuestTalentModAlignment const*>> pairAlignments;
+    uint32 pairCount = 0;
+    for (auto const& alignmentEntry : AlignmentsByTalentSpellIDAndEffect)
+    {
+        uint32 talentSpellID = static_cast<uint32>(alignmentEntry.first >> 8);
+        if (ExcludedTalentSpellIDs.count(talentSpellID) > 0 || alignmentEntry.second.empty() == true)
+            continue;
+        if (ReachPairBaseIndexByTalentSpellID[talentSpellID] == std::numeric_limits<uint32>::max())
+        {
+            ReachPairBaseIndexByTalentSpellID[talentSpellID] = pairCount;
+            pairCount += MAX_SPELL_EFFECTS;
+        }
+        uint32 pairIndex = ReachPairBaseIndexByTalentSpellID[talentSpellID] + static_cast<uint32>(alignmentEntry.first & 0xFF);
+        for (EverQuestTalentModAlignment const& alignment : alignmentEntry.second)
+            pairAlignments.push_back(std::make_pair(pairIndex, &alignment));
+    }
+    ReachMatrixWordsPerRow = (pairCount + 63) / 64;
+    ReachPairNeedsModCheckBits.assign(ReachMatrixWordsPerRow, 0);
+
+    // Strength debuff reach depends on which effect slot the modifier targets, so those pairs stay on the slow path
+    for (auto const& pairAlignment : pairAlignments)
+        if (pairAlignment.second->SpellRestriction == EQTALENTRESTRICTION_STRENGTH_DEBUFF)
+            ReachPairNeedsModCheckBits[pairAlignment.first >> 6] |= uint64(1) << (pairAlignment.first & 63);
+
+    // One row per EQ spell that any pair reaches, so the many EQ spells no talent touches cost a single index slot
+    uint32 reachedEQSpellCount = 0;
+    uint32 reachedPairBitCount = 0;
+    if (EverQuest->ConfigSystemSpellDBCIDMax >= EverQuest->ConfigSystemSpellDBCIDMin && pairCount > 0)
+    {
+        ReachRowIndexByEQSpellIDOffset.assign(static_cast<size_t>(EverQuest->ConfigSystemSpellDBCIDMax - EverQuest->ConfigSystemSpellDBCIDMin) + 1, std::numeric_limits<uint32>::max());
+        std::vector<uint64> rowBits(ReachMatrixWordsPerRow, 0);
+        for (uint32 eqSpellID = EverQuest->ConfigSystemSpellDBCIDMin; eqSpellID <= EverQuest->ConfigSystemSpellDBCIDMax; ++eqSpellID)
+        {
+            SpellInfo const* eqSpellInfo = sSpellMgr->GetSpellInfo(eqSpellID);
+            if (eqSpellInfo == nullptr)
+                continue;
+            std::fill(rowBits.begin(), rowBits.end(), 0);
+            bool reachedAny = false;
+            for (auto const& pairAlignment : pairAlignments)
+            {
+                if (pairAlignment.second->SpellRestriction == EQTALENTRESTRICTION_STRENGTH_DEBUFF)
+                    continue;
+                if (IsReachBitSet(rowBits, pairAlignment.first) == true)
+                    continue;
+                if (DoesAlignmentReachEQSpell(*pairAlignment.second, eqSpellInfo, nullptr) == false)
+                    continue;
+                rowBits[pairAlignment.first >> 6] |= uint64(1) << (pairAlignment.first & 63);
+                reachedPairBitCount++;
+                reachedAny = true;
+            }
+            if (reachedAny == false)
+                continue;
+            ReachRowIndexByEQSpellIDOffset[eqSpellID - ReachMatrixEQSpellIDBase] = reachedEQSpellCount;
+            ReachRowBits.insert(ReachRowBits.end(), rowBits.begin(), rowBits.end());
+            reachedEQSpellCount++;
+        }
+    }
+
+    size_t matrixBytes = ReachPairBaseIndexByTalentSpellID.capacity() * sizeof(uint32) + ReachRowIndexByEQSpellIDOffset.capacity() * sizeof(uint32)
+        + ReachRowBits.capacity() * sizeof(uint64) + ReachPairNeedsModCheckBits.capacity() * sizeof(uint64);
+    LOG_INFO("module", "EverQuest: Talent alignment reach matrix built in {} ms, {} talent effect pairs across {} reached EQ spells ({} reach bits set, {} KB)",
+        GetMSTimeDiffToNow(buildStartMSTime), pairCount, reachedEQSpellCount, reachedPairBitCount, matrixBytes / 1024);
+}
+
+uint32 EverQuestSpellTalentAlignment::ComputeSpellInfoTraits(SpellInfo const* spellInfo)
+{
+    uint32 traits = 0;
     for (uint8 effectIndex = 0; effectIndex < MAX_SPELL_EFFECTS; ++effectIndex)
     {
         SpellEffectInfo const& effectInfo = spellInfo->Effects[effectIndex];
-        if (effectInfo.Effect == SPELL_EFFECT_SCHOOL_DAMAGE || effectInfo.Effect == SPELL_EFFECT_HEALTH_LEECH)
-            return true;
-        if (effectInfo.ApplyAuraName == SPELL_AURA_PERIODIC_DAMAGE
+        uint32 targetA = effectInfo.TargetA.GetTarget();
+        uint32 targetB = effectInfo.TargetB.GetTarget();
+
+        bool dealsDirectDamage = effectInfo.Effect == SPELL_EFFECT_SCHOOL_DAMAGE || effectInfo.Effect == SPELL_EFFECT_HEALTH_LEECH;
+        bool dealsPeriodicDamage = effectInfo.ApplyAuraName == SPELL_AURA_PERIODIC_DAMAGE
             || effectInfo.ApplyAuraName == SPELL_AURA_PERIODIC_DAMAGE_PERCENT
-            || effectInfo.ApplyAuraName == SPELL_AURA_PERIODIC_LEECH)
-            return true;
+            || effectInfo.ApplyAuraName == SPELL_AURA_PERIODIC_LEECH;
+        if (dealsDirectDamage == true)
+            traits |= EQSPELLTRAIT_DAMAGE | EQSPELLTRAIT_DIRECT_DAMAGE;
+        if (dealsPeriodicDamage == true)
+            traits |= EQSPELLTRAIT_DAMAGE | EQSPELLTRAIT_PERIODIC_DAMAGE;
+        if (dealsDirectDamage == true || dealsPeriodicDamage == true)
+        {
+            // The converter set area damage with implicit targets 15 (source area enemy) or 16 (destination area enemy)
+            if (targetA == TARGET_UNIT_SRC_AREA_ENEMY || targetA == TARGET_UNIT_DEST_AREA_ENEMY || targetB == TARGET_UNIT_SRC_AREA_ENEMY || targetB == TARGET_UNIT_DEST_AREA_ENEMY)
+                traits |= EQSPELLTRAIT_AREA_DAMAGE;
+
+            // The converter set caster-centered area damage as target A 22 (source is caster) with target B 15 (source area enemy)
+            if (targetA == TARGET_SRC_CASTER && targetB == TARGET_UNIT_SRC_AREA_ENEMY)
+                traits |= EQSPELLTRAIT_POINT_BLANK_AREA_DAMAGE;
+        }
+
+        bool dealsDirectHeal = effectInfo.Effect == SPELL_EFFECT_HEAL || effectInfo.Effect == SPELL_EFFECT_HEAL_MAX_HEALTH;
+        bool dealsPeriodicHeal = effectInfo.ApplyAuraName == SPELL_AURA_PERIODIC_HEAL;
+        if (dealsDirectHeal == true)
+            traits |= EQSPELLTRAIT_HEAL | EQSPELLTRAIT_DIRECT_HEAL;
+        if (dealsPeriodicHeal == true)
+            traits |= EQSPELLTRAIT_HEAL | EQSPELLTRAIT_PERIODIC_HEAL;
+
+        // The converter set group heals with implicit target 20 (caster area party), caster-centered area heals with target A 22 (source is caster), and targeted area heals with target B 31 (destination area ally) or 34 (destination area party)
+        if ((dealsDirectHeal == true || dealsPeriodicHeal == true)
+            && (targetA == TARGET_UNIT_CASTER_AREA_PARTY || targetA == TARGET_SRC_CASTER || targetB == TARGET_UNIT_DEST_AREA_ALLY || targetB == TARGET_UNIT_DEST_AREA_PARTY))
+            traits |= EQSPELLTRAIT_AREA_HEAL;
+
+        // The converter set EQ lifetaps as health leech (direct) or periodic leech (over time) effects on the same spell
+        if (effectInfo.Effect == SPELL_EFFECT_HEALTH_LEECH || effectInfo.ApplyAuraName == SPELL_AURA_PERIODIC_LEECH)
+            traits |= EQSPELLTRAIT_LEECH;
+
+        // The converter set EQ cancel magic / cure poison / cure disease as dispel effects
+        if (effectInfo.Effect == SPELL_EFFECT_DISPEL)
+            traits |= EQSPELLTRAIT_CURE;
+
+        // The converter set EQ pet summons as summon pet effects, or as plain summons whose generated summon properties mark an ally pet when the EQ level and behavior pet config is on
+        if (effectInfo.Effect == SPELL_EFFECT_SUMMON_PET)
+            traits |= EQSPELLTRAIT_SUMMON_PET;
+        else if (effectInfo.Effect == SPELL_EFFECT_SUMMON)
+        {
+            SummonPropertiesEntry const* summonProperties = sSummonPropertiesStore.LookupEntry(effectInfo.MiscValueB);
+            if (summonProperties != nullptr && summonProperties->Category == SUMMON_CATEGORY_ALLY && summonProperties->Type == SUMMON_TYPE_PET)
+                traits |= EQSPELLTRAIT_SUMMON_PET;
+        }
+
+        if (IsEffectAStrengthReduction(spellInfo, effectIndex) == true)
+            traits |= EQSPELLTRAIT_STRENGTH_REDUCTION_EFFECT_0 << effectIndex;
     }
-    return false;
+    return traits;
 }
 
-bool EverQuestSpellTalentAlignment::DoesSpellInfoHeal(SpellInfo const* spellInfo)
+void EverQuestSpellTalentAlignment::BuildSpellTraits()
 {
-    for (uint8 effectIndex = 0; effectIndex < MAX_SPELL_EFFECTS; ++effectIndex)
+    uint32 buildStartMSTime = getMSTime();
+    SpellTraitsByEQSpellIDOffset.clear();
+    SpellTraitsEQSpellIDBase = EverQuest->ConfigSystemSpellDBCIDMin;
+    if (EverQuest->ConfigSystemSpellDBCIDMax < EverQuest->ConfigSystemSpellDBCIDMin)
+        return;
+
+    // Built into a local first, since GetSpellInfoTraits reads the cache as soon as it has rows
+    std::vector<uint32> spellTraitsByEQSpellIDOffset(static_cast<size_t>(EverQuest->ConfigSystemSpellDBCIDMax - EverQuest->ConfigSystemSpellDBCIDMin) + 1, 0);
+    uint32 eqSpellCount = 0;
+    for (uint32 eqSpellID = EverQuest->ConfigSystemSpellDBCIDMin; eqSpellID <= EverQuest->ConfigSystemSpellDBCIDMax; ++eqSpellID)
     {
-        SpellEffectInfo const& effectInfo = spellInfo->Effects[effectIndex];
-        if (effectInfo.Effect == SPELL_EFFECT_HEAL || effectInfo.Effect == SPELL_EFFECT_HEAL_MAX_HEALTH)
-            return true;
-        if (effectInfo.ApplyAuraName == SPELL_AURA_PERIODIC_HEAL)
-            return true;
+        SpellInfo const* eqSpellInfo = sSpellMgr->GetSpellInfo(eqSpellID);
+        if (eqSpellInfo == nullptr)
+            continue;
+        spellTraitsByEQSpellIDOffset[eqSpellID - SpellTraitsEQSpellIDBase] = ComputeSpellInfoTraits(eqSpellInfo);
+        eqSpellCount++;
     }
-    return false;
+    SpellTraitsByEQSpellIDOffset.swap(spellTraitsByEQSpellIDOffset);
+    LOG_INFO("module", "EverQuest: Spell traits computed for {} EQ spells in {} ms", eqSpellCount, GetMSTimeDiffToNow(buildStartMSTime));
 }
 
-bool EverQuestSpellTalentAlignment::DoesEffectDealDamage(SpellInfo const* spellInfo, uint8 effectIndex)
+// Run on demand by .eqbenchproccheck rather than at startup.  Times the talent interaction proc predicates over every EQ spell, walking the
+// effects on each call (what every predicate did before the traits were cached, and still does for non-EQ spells) versus reading the cached traits
+std::string EverQuestSpellTalentAlignment::MeasureProcCheckThroughput()
 {
-    SpellEffectInfo const& effectInfo = spellInfo->Effects[effectIndex];
-    if (effectInfo.Effect == SPELL_EFFECT_SCHOOL_DAMAGE || effectInfo.Effect == SPELL_EFFECT_HEALTH_LEECH)
-        return true;
-    if (effectInfo.ApplyAuraName == SPELL_AURA_PERIODIC_DAMAGE
-        || effectInfo.ApplyAuraName == SPELL_AURA_PERIODIC_DAMAGE_PERCENT
-        || effectInfo.ApplyAuraName == SPELL_AURA_PERIODIC_LEECH)
-        return true;
-    return false;
+    static const uint32 procCheckPasses = 5;
+    static const uint32 procCheckTraits[] = { EQSPELLTRAIT_DIRECT_DAMAGE, EQSPELLTRAIT_AREA_DAMAGE, EQSPELLTRAIT_DAMAGE, EQSPELLTRAIT_LEECH, EQSPELLTRAIT_PERIODIC_DAMAGE, EQSPELLTRAIT_DIRECT_HEAL };
+    std::vector<SpellInfo const*> eqSpellInfos;
+    for (uint32 eqSpellID = EverQuest->ConfigSystemSpellDBCIDMin; eqSpellID <= EverQuest->ConfigSystemSpellDBCIDMax; ++eqSpellID)
+        if (SpellInfo const* eqSpellInfo = sSpellMgr->GetSpellInfo(eqSpellID))
+            eqSpellInfos.push_back(eqSpellInfo);
+    if (eqSpellInfos.empty() == true)
+        return "No EQ spells are loaded, so there is nothing to measure";
+
+    uint64 computedPassCount = 0;
+    auto computedStartTime = std::chrono::steady_clock::now();
+    for (uint32 pass = 0; pass < procCheckPasses; ++pass)
+        for (SpellInfo const* eqSpellInfo : eqSpellInfos)
+            for (uint32 procCheckTrait : procCheckTraits)
+                if ((ComputeSpellInfoTraits(eqSpellInfo) & procCheckTrait) != 0)
+                    computedPassCount++;
+    auto computedDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - computedStartTime);
+
+    uint64 cachedPassCount = 0;
+    auto cachedStartTime = std::chrono::steady_clock::now();
+    for (uint32 pass = 0; pass < procCheckPasses; ++pass)
+        for (SpellInfo const* eqSpellInfo : eqSpellInfos)
+            for (uint32 procCheckTrait : procCheckTraits)
+                if ((GetSpellInfoTraits(eqSpellInfo) & procCheckTrait) != 0)
+                    cachedPassCount++;
+    auto cachedDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - cachedStartTime);
+
+    uint64 procCheckCount = static_cast<uint64>(procCheckPasses) * eqSpellInfos.size() * (sizeof(procCheckTraits) / sizeof(procCheckTraits[0]));
+    if (computedPassCount != cachedPassCount)
+        LOG_ERROR("module", "EverQuest: Cached spell traits disagree with computed traits ({} vs {} passing proc checks)", cachedPassCount, computedPassCount);
+    std::string result = fmt::format("Proc check throughput over {} checks: {:.1f} ns/check walking effects vs {:.1f} ns/check from cached traits", procCheckCount,
+        static_cast<double>(computedDuration.count()) / procCheckCount, static_cast<double>(cachedDuration.count()) / procCheckCount);
+    LOG_INFO("module", "EverQuest: {}", result);
+    return result;
+}
+
+uint32 EverQuestSpellTalentAlignment::GetSpellInfoTraits(SpellInfo const* spellInfo)
+{
+    // Non-EQ spells (and any lookup before the cache is built) fall back to walking the effects
+    EverQuestSpellTalentAlignment* alignment = instance();
+    if (spellInfo->Id >= alignment->SpellTraitsEQSpellIDBase && spellInfo->Id - alignment->SpellTraitsEQSpellIDBase < alignment->SpellTraitsByEQSpellIDOffset.size())
+        return alignment->SpellTraitsByEQSpellIDOffset[spellInfo->Id - alignment->SpellTraitsEQSpellIDBase];
+    return ComputeSpellInfoTraits(spellInfo);
+}
+
+bool EverQuestSpellTalentAlignment::DoesSpellInfoDamage(SpellInfo const* spellInfo)
+{
+    return (GetSpellInfoTraits(spellInfo) & EQSPELLTRAIT_DAMAGE) != 0;
+}
+
+bool EverQuestSpellTalentAlignment::DoesSpellInfoHeal(SpellInfo const* spellInfo)
+{
+    return (GetSpellInfoTraits(spellInfo) & EQSPELLTRAIT_HEAL) != 0;
 }
 
 bool EverQuestSpellTalentAlignment::DoesSpellInfoDealDirectDamage(SpellInfo const* spellInfo)
 {
-    for (uint8 effectIndex = 0; effectIndex < MAX_SPELL_EFFECTS; ++effectIndex)
-    {
-        SpellEffectInfo const& effectInfo = spellInfo->Effects[effectIndex];
-        if (effectInfo.Effect == SPELL_EFFECT_SCHOOL_DAMAGE || effectInfo.Effect == SPELL_EFFECT_HEALTH_LEECH)
-            return true;
-    }
-    return false;
+    return (GetSpellInfoTraits(spellInfo) & EQSPELLTRAIT_DIRECT_DAMAGE) != 0;
 }
 
 bool EverQuestSpellTalentAlignment::DoesSpellInfoDealAreaDamage(SpellInfo const* spellInfo)
 {
-    for (uint8 effectIndex = 0; effectIndex < MAX_SPELL_EFFECTS; ++effectIndex)
-    {
-        if (DoesEffectDealDamage(spellInfo, effectIndex) == false)
-            continue;
-        SpellEffectInfo const& effectInfo = spellInfo->Effects[effectIndex];
-        uint32 targetA = effectInfo.TargetA.GetTarget();
-        uint32 targetB = effectInfo.TargetB.GetTarget();
-
-        // The converter set area damage with implicit targets 15 (source area enemy) or 16 (destination area enemy)
-        if (targetA == TARGET_UNIT_SRC_AREA_ENEMY || targetA == TARGET_UNIT_DEST_AREA_ENEMY || targetB == TARGET_UNIT_SRC_AREA_ENEMY || targetB == TARGET_UNIT_DEST_AREA_ENEMY)
-            return true;
-    }
-    return false;
+    return (GetSpellInfoTraits(spellInfo) & EQSPELLTRAIT_AREA_DAMAGE) != 0;
 }
 
 bool EverQuestSpellTalentAlignment::DoesSpellInfoDealPointBlankAreaDamage(SpellInfo const* spellInfo)
 {
-    for (uint8 effectIndex = 0; effectIndex < MAX_SPELL_EFFECTS; ++effectIndex)
-    {
-        if (DoesEffectDealDamage(spellInfo, effectIndex) == false)
-            continue;
-        SpellEffectInfo const& effectInfo = spellInfo->Effects[effectIndex];
-
-        // The converter set caster-centered area damage as target A 22 (source is caster) with target B 15 (source area enemy)
-        if (effectInfo.TargetA.GetTarget() == TARGET_SRC_CASTER && effectInfo.TargetB.GetTarget() == TARGET_UNIT_SRC_AREA_ENEMY)
-            return true;
-    }
-    return false;
+    return (GetSpellInfoTraits(spellInfo) & EQSPELLTRAIT_POINT_BLANK_AREA_DAMAGE) != 0;
 }
 
 bool EverQuestSpellTalentAlignment::DoesSpellInfoDealDirectHeal(SpellInfo const* spellInfo)
 {
-    for (uint8 effectIndex = 0; effectIndex < MAX_SPELL_EFFECTS; ++effectIndex)
-    {
-        SpellEffectInfo const& effectInfo = spellInfo->Effects[effectIndex];
-        if (effectInfo.Effect == SPELL_EFFECT_HEAL || effectInfo.Effect == SPELL_EFFECT_HEAL_MAX_HEALTH)
-            return true;
-    }
-    return false;
+    return (GetSpellInfoTraits(spellInfo) & EQSPELLTRAIT_DIRECT_HEAL) != 0;
 }
 
-
 bool EverQuestSpellTalentAlignment::DoesSpellInfoDealAreaHeal(SpellInfo const* spellInfo)
 {
-    for (uint8 effectIndex = 0; effectIndex < MAX_SPELL_EFFECTS; ++effectIndex)
-    {
-        // The converter set group heals with implicit target 20 (caster area party), caster-centered area heals with target A 22 (source is caster), and targeted area heals with target B 31 (destination area ally) or 34 (destination area party)
-        SpellEffectInfo const& effectInfo = spellInfo->Effects[effectIndex];
-        bool healsInSomeWay = effectInfo.Effect == SPELL_EFFECT_HEAL || effectInfo.Effect == SPELL_EFFECT_HEAL_MAX_HEALTH
-            || effectInfo.ApplyAuraName == SPELL_AURA_PERIODIC_HEAL;
-        if (healsInSomeWay == false)
-            continue;
-        uint32 targetA = effectInfo.TargetA.GetTarget();
-        uint32 targetB = effectInfo.TargetB.GetTarget();
-        if (targetA == TARGET_UNIT_CASTER_AREA_PARTY || targetA == TARGET_SRC_CASTER
-            || targetB == TARGET_UNIT_DEST_AREA_ALLY || targetB == TARGET_UNIT_DEST_AREA_PARTY)
-            return true;
-    }
-    return false;
+    return (GetSpellInfoTraits(spellInfo) & EQSPELLTRAIT_AREA_HEAL) != 0;
 }
 
 bool EverQuestSpellTalentAlignment::DoesSpellInfoDealSingleTargetDirectHeal(SpellInfo const* spellInfo)
 {
-    return DoesSpellInfoDealDirectHeal(spellInfo) == true && DoesSpellInfoDealAreaHeal(spellInfo) == false;
+    return (GetSpellInfoTraits(spellInfo) & (EQSPELLTRAIT_DIRECT_HEAL | EQSPELLTRAIT_AREA_HEAL)) == EQSPELLTRAIT_DIRECT_HEAL;
 }
 
 bool EverQuestSpellTalentAlignment::DoesSpellInfoDealPeriodicHeal(SpellInfo const* spellInfo)
 {
-    for (uint8 effectIndex = 0; effectIndex < MAX_SPELL_EFFECTS; ++effectIndex)
-        if (spellInfo->Effects[effectIndex].ApplyAuraName == SPELL_AURA_PERIODIC_HEAL)
-            return true;
-    return false;
+    return (GetSpellInfoTraits(spellInfo) & EQSPELLTRAIT_PERIODIC_HEAL) != 0;
 }
 
 bool EverQuestSpellTalentAlignment::DoesSpellInfoDealPeriodicDamage(SpellInfo const* spellInfo)
 {
-    for (uint8 effectIndex = 0; effectIndex < MAX_SPELL_EFFECTS; ++effectIndex)
-    {
-        SpellEffectInfo const& effectInfo = spellInfo->Effects[effectIndex];
-        if (effectInfo.ApplyAuraName == SPELL_AURA_PERIODIC_DAMAGE
-            || effectInfo.ApplyAuraName == SPELL_AURA_PERIODIC_DAMAGE_PERCENT
-            || effectInfo.ApplyAuraName == SPELL_AURA_PERIODIC_LEECH)
-            return true;
-    }
-    return false;
+    return (GetSpellInfoTraits(spellInfo) & EQSPELLTRAIT_PERIODIC_DAMAGE) != 0;
 }
 
 bool EverQuestSpellTalentAlignment::DoesSpellInfoLeech(SpellInfo const* spellInfo)
 {
-    for (uint8 effectIndex = 0; effectIndex < MAX_SPELL_EFFECTS; ++effectIndex)
-    {
-        SpellEffectInfo const& effectInfo = spellInfo->Effects[effectIndex];
-
-        // The converter set EQ lifetaps as health leech (direct) or periodic leech (over time) effects on the same spell
-        if (effectInfo.Effect == SPELL_EFFECT_HEALTH_LEECH || effectInfo.ApplyAuraName == SPELL_AURA_PERIODIC_LEECH)
-            return true;
-    }
-    return false;
+    return (GetSpellInfoTraits(spellInfo) & EQSPELLTRAIT_LEECH) != 0;
 }
 
 bool EverQuestSpellTalentAlignment::DoesSpellInfoSummonAPet(SpellInfo const* spellInfo)
 {
-    for (uint8 effectIndex = 0; effectIndex < MAX_SPELL_EFFECTS; ++effectIndex)
-    {
-        // The converter set EQ pet summons as summon pet effects, or as plain summons whose generated summon properties mark an ally pet when the EQ level and behavior pet config is on
-        SpellEffectInfo const& effectInfo = spellInfo->Effects[effectIndex];
-        if (effectInfo.Effect == SPELL_EFFECT_SUMMON_PET)
-            return true;
-        if (effectInfo.Effect == SPELL_EFFECT_SUMMON)
-        {
-            SummonPropertiesEntry const* summonProperties = sSummonPropertiesStore.LookupEntry(effectInfo.MiscValueB);
-            if (summonProperties != nullptr && summonProperties->Category == SUMMON_CATEGORY_ALLY && summonProperties->Type == SUMMON_TYPE_PET)
-                return true;
-        }
-    }
-    return false;
+    return (GetSpellInfoTraits(spellInfo) & EQSPELLTRAIT_SUMMON_PET) != 0;
 }
 
 bool EverQuestSpellTalentAlignment::DoesSpellInfoCure(SpellInfo const* spellInfo)
 {
-    // The converter set EQ cancel magic / cure poison / cure disease as dispel effects
-    for (uint8 effectIndex = 0; effectIndex < MAX_SPELL_EFFECTS; ++effectIndex)
-        if (spellInfo->Effects[effectIndex].Effect == SPELL_EFFECT_DISPEL)
-            return true;
-    return false;
+    return (GetSpellInfoTraits(spellInfo) & EQSPELLTRAIT_CURE) != 0;
 }
 
 bool EverQuestSpellTalentAlignment::IsEQSpell(SpellInfo const* spellInfo)
@@ -458,18 +565,13 @@ bool EverQuestSpellTalentAlignment::IsEffectAStrengthReduction(SpellInfo const*
 bool EverQuestSpellTalentAlignment::DoesModTargetAStrengthReduction(SpellInfo const* eqSpellInfo, SpellModifier const* spellMod)
 {
     // A modifier like Improved Curse of Weakness targets one effect index, so it only aligns when the EQ effect in that slot is the strength reduction (a debuff can bundle several stats, one per effect slot)
+    uint32 traits = GetSpellInfoTraits(eqSpellInfo);
     switch (spellMod->op)
     {
-        case SPELLMOD_EFFECT1: return IsEffectAStrengthReduction(eqSpellInfo, EFFECT_0);
-        case SPELLMOD_EFFECT2: return IsEffectAStrengthReduction(eqSpellInfo, EFFECT_1);
-        case SPELLMOD_EFFECT3: return IsEffectAStrengthReduction(eqSpellInfo, EFFECT_2);
-        default:
-        {
-            for (uint8 effectIndex = 0; effectIndex < MAX_SPELL_EFFECTS; ++effectIndex)
-                if (IsEffectAStrengthReduction(eqSpellInfo, effectIndex) == true)
-                    return true;
-            return false;
-        }
+        case SPELLMOD_EFFECT1: return (traits & (EQSPELLTRAIT_STRENGTH_REDUCTION_EFFECT_0 << EFFECT_0)) != 0;
+        case SPELLMOD_EFFECT2: return (traits & (EQSPELLTRAIT_STRENGTH_REDUCTION_EFFECT_0 << EFFECT_1)) != 0;
+        case SPELLMOD_EFFECT3: return (traits & (EQSPELLTRAIT_STRENGTH_REDUCTION_EFFECT_0 << EFFECT_2)) != 0;
+        default: return (traits & EQSPELLTRAIT_STRENGTH_REDUCTION_ANY) != 0;
     }
 }
 
@@ -570,23 +672,40 @@ bool EverQuestSpellTalentAlignment::ShouldTalentModAffectEQSpell(SpellInfo const
         return false;
     if (IsEQSpell(eqSpellInfo) == false)
         return false;
-    if (ExcludedTalentSpellIDs.count(talentSpellInfo->Id) > 0)
+
+    // Talents without a pair index have no alignment or are excluded
+    if (talentSpellInfo->Id >= ReachPairBaseIndexByTalentSpellID.size())
+        return false;
+    uint32 pairBaseIndex = ReachPairBaseIndexByTalentSpellID[talentSpellInfo->Id];
+    if (pairBaseIndex == std::numeric_limits<uint32>::max())
         return false;
+    uint32 rowIndex = std::numeric_limits<uint32>::max();
+    if (eqSpellInfo->Id >= ReachMatrixEQSpellIDBase && eqSpellInfo->Id - ReachMatrixEQSpellIDBase < ReachRowIndexByEQSpellIDOffset.size())
+        rowIndex = ReachRowIndexByEQSpellIDOffset[eqSpellInfo->Id - ReachMatrixEQSpellIDBase];
 
     for (uint8 effectIndex = 0; effectIndex < MAX_SPELL_EFFECTS; ++effectIndex)
     {
         if (talentSpellInfo->Effects[effectIndex].SpellClassMask != spellMod->mask)
             continue;
 
-        auto alignmentEntry = AlignmentsByTalentSpellIDAndEffect.find(MakeAlignmentKey(talentSpellInfo->Id, effectIndex));
-        if (alignmentEntry == AlignmentsByTalentSpellIDAndEffect.end())
-            continue;
-
-        for (EverQuestTalentModAlignment const& alignment : alignmentEntry->second)
+        uint32 pairIndex = pairBaseIndex + effectIndex;
+        if (IsReachBitSet(ReachPairNeedsModCheckBits, pairIndex) == true)
         {
-            if (DoesAlignmentReachEQSpell(alignment, eqSpellInfo, spellMod) == true)
-                return true;
+            auto alignmentEntry = AlignmentsByTalentSpellIDAndEffect.find(MakeAlignmentKey(talentSpellInfo->Id, effectIndex));
+            if (alignmentEntry == AlignmentsByTalentSpellIDAndEffect.end())
+                continue;
+            for (EverQuestTalentModAlignment const& alignment : alignmentEntry->second)
+            {
+                if (DoesAlignmentReachEQSpell(alignment, eqSpellInfo, spellMod) == true)
+                    return true;
+            }
+            continue;
         }
+
+        if (rowIndex == std::numeric_limits<uint32>::max())
+            continue;
+        if (IsReachBitSet(ReachRowBits, static_cast<size_t>(rowIndex) * ReachMatrixWordsPerRow * 64 + pairIndex) == true)
+            return true;
     }
     return false;
 }
@@ -47,6 +47,25 @@ enum EverQuestTalentAlignmentRestriction : uint8
     EQTALENTRESTRICTION_PET_SUMMON = 11              // EQ pet summoning spells, reached regardless of the damage and healing flags
 };
 
+// Spell traits the talent alignment and proc checks test, computed once per EQ spell from its effects and targets
+enum EverQuestSpellTrait : uint32
+{
+    EQSPELLTRAIT_DAMAGE                         = 0x00000001,
+    EQSPELLTRAIT_HEAL                           = 0x00000002,
+    EQSPELLTRAIT_DIRECT_DAMAGE                  = 0x00000004,
+    EQSPELLTRAIT_AREA_DAMAGE                    = 0x00000008,
+    EQSPELLTRAIT_POINT_BLANK_AREA_DAMAGE        = 0x00000010,
+    EQSPELLTRAIT_DIRECT_HEAL                    = 0x00000020,
+    EQSPELLTRAIT_AREA_HEAL                      = 0x00000040,
+    EQSPELLTRAIT_PERIODIC_HEAL                  = 0x00000080,
+    EQSPELLTRAIT_PERIODIC_DAMAGE                = 0x00000100,
+    EQSPELLTRAIT_CURE                           = 0x00000200,
+    EQSPELLTRAIT_LEECH                          = 0x00000400,
+    EQSPELLTRAIT_SUMMON_PET                     = 0x00000800,
+    EQSPELLTRAIT_STRENGTH_REDUCTION_EFFECT_0    = 0x00001000, // Followed by one bit per effect index
+    EQSPELLTRAIT_STRENGTH_REDUCTION_ANY         = 0x00007000
+};
+
 struct EverQuestTalentModAlignment
 {
     uint32 SchoolMask = 0;
@@ -62,6 +81,8 @@ public:
     static EverQuestSpellTalentAlignment* instance();
 
     void Load();
+    void BuildSpellTraits();
+    std::string MeasureProcCheckThroughput();
     bool ShouldTalentModAffectEQSpell(SpellInfo const* talentSpellInfo, SpellInfo const* eqSpellInfo, SpellModifier const* spellMod);
 
     static bool DoesSpellInfoDamage(SpellInfo const* spellInfo);
@@ -77,25 +98,43 @@ public:
     static bool DoesSpellInfoCure(SpellInfo const* spellInfo);
     static bool DoesSpellInfoLeech(SpellInfo const* spellInfo);
     static bool DoesSpellInfoSummonAPet(SpellInfo const* spellInfo);
+    static uint32 GetSpellInfoTraits(SpellInfo const* spellInfo);
 
 private:
     bool IsLoaded = false;
+    uint32 SpellTraitsEQSpellIDBase = 0;
+    std::vector<uint32> SpellTraitsByEQSpellIDOffset;
     std::unordered_map<uint32, std::vector<SpellInfo const*>> PlayerSpellsByFamily;
     std::unordered_map<uint64, std::vector<EverQuestTalentModAlignment>> AlignmentsByTalentSpellIDAndEffect;
     std::set<uint32> ExcludedTalentRank1SpellIDs;
     std::set<uint32> ExcludedTalentSpellIDs;
     std::unordered_map<uint32, std::vector<std::pair<uint8, EverQuestTalentModAlignment>>> ExplicitAlignmentsBySpellID;
 
+    // Reach matrix, built once at the end of Load().  Every aligned talent spell owns MAX_SPELL_EFFECTS consecutive pair indexes, and each
+    // EQ spell that any pair reaches owns one bit row over those indexes.  Pairs whose reach depends on the modifier itself are flagged for the
+    // slow path instead
+    uint32 ReachMatrixEQSpellIDBase = 0;
+    uint32 ReachMatrixWordsPerRow = 0;
+    std::vector<uint32> ReachPairBaseIndexByTalentSpellID;
+    std::vector<uint32> ReachRowIndexByEQSpellIDOffset;
+    std::vector<uint64> ReachRowBits;
+    std::vector<uint64> ReachPairNeedsModCheckBits;
+
     void LoadExcludedTalents();
     void LoadExplicitAlignments();
     void BuildPlayerSpellsByFamily();
+    void BuildReachMatrix();
     bool BuildAlignmentForMask(SpellInfo const* talentSpellInfo, flag96 const& classMask, EverQuestTalentModAlignment& alignmentOut);
     void ApplyExplicitAlignmentsToSpell(uint32 targetSpellID, uint32 rowSpellID, std::vector<std::pair<uint8, EverQuestTalentModAlignment>> const& explicitAlignments, uint32& explicitModifierCount);
     bool DoesAlignmentReachEQSpell(EverQuestTalentModAlignment const& alignment, SpellInfo const* eqSpellInfo, SpellModifier const* spellMod);
     static bool IsEffectAStrengthReduction(SpellInfo const* spellInfo, uint8 effectIndex);
     static bool DoesModTargetAStrengthReduction(SpellInfo const* eqSpellInfo, SpellModifier const* spellMod);
-    static bool DoesEffectDealDamage(SpellInfo const* spellInfo, uint8 effectIndex);
+    static uint32 ComputeSpellInfoTraits(SpellInfo const* spellInfo);
     static bool IsEQSpell(SpellInfo const* spellInfo);
+    static bool IsReachBitSet(std::vector<uint64> const& bits, size_t bitIndex)
+    {
+        return (bits[bitIndex >> 6] & (uint64(1) << (bitIndex & 63))) != 0;
+    }
     static uint64 MakeAlignmentKey(uint32 talentSpellID, uint8 effectIndex)
     {
         return (static_cast<uint64>(talentSpellID) << 8) | static_cast<uint64>(effectIndex);
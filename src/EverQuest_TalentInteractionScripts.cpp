@@ -398,9 +398,8 @@ class EverQuest_ImprovedSpiritTapAuraScript : public AuraScript
             return false;
         if (EverQuest->IsSpellAnEQSpell(procSpellInfo->Id) == false)
             return false;
-        if (EverQuestSpellTalentAlignment::DoesSpellInfoDealDirectDamage(procSpellInfo) == false)
-            return false;
-        if (EverQuestSpellTalentAlignment::DoesSpellInfoDealAreaDamage(procSpellInfo) == true)
+        uint32 procSpellTraits = EverQuestSpellTalentAlignment::GetSpellInfoTraits(procSpellInfo);
+        if ((procSpellTraits & (EQSPELLTRAIT_DIRECT_DAMAGE | EQSPELLTRAIT_AREA_DAMAGE)) != EQSPELLTRAIT_DIRECT_DAMAGE)
             return false;
         if (GetId() == EQ_SPELL_ID_PRIEST_IMPROVED_SPIRIT_TAP_RANK1)
             return roll_chance_i(50);
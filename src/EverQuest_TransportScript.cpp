@@ -19,6 +19,7 @@
 #include "Transport.h"
 
 #include "MapReference.h"
+#include "ObjectAccessor.h"
 
 #include "EverQuest.h"
 
@@ -30,19 +31,98 @@ private:
     // Ships on different maps relocate/update on different map threads, so guard this shared map
     std::mutex PendingResyncMutex;
     std::map<uint32, GOState> PendingResync;
+    std::map<uint32, std::unordered_set<ObjectGuid>> DeferredResyncPlayerGUIDsByShipEntry;
+    std::map<uint32, uint32> DeferredResyncCheckTimerByShipEntry;
+
+    static bool IsPlayerInShipResyncRange(Player* player, Transport* transport)
+    {
+        return player->GetTransport() == transport || player->GetExactDist2d(transport) <= transport->GetVisibilityRange() + EQ_SHIP_RESYNC_VIEW_RANGE_MARGIN;
+    }
+
+    static void RecreateTransportForPlayer(Transport* transport, Player* player)
+    {
+        transport->DestroyForPlayer(player);
+        transport->SendUpdateToPlayer(player);
+    }
 
     void ForceTransportResyncToPlayers(Transport* transport)
     {
-        // Force updates with client so that players see the server values set
+        // Force updates with client so that players see the server values set.  Only players who can see the ship (or are riding it)
+        // need it right now, so everyone else is recreated later if and when they come into range, which keeps a docking ship in a
+        // busy zone from sending a create to every player at once
+        EverQuest->TransportResyncStats.ResyncsTriggered++;
+        vector<ObjectGuid> deferredPlayerGUIDs;
         Map::PlayerList const& players = transport->GetMap()->GetPlayers();
         for (Map::PlayerList::const_iterator itr = players.begin(); itr != players.end(); ++itr)
         {
             if (Player* player = itr->GetSource())
             {
-                transport->DestroyForPlayer(player);
-                transport->SendUpdateToPlayer(player);
+                if (IsPlayerInShipResyncRange(player, transport) == true)
+                {
+                    RecreateTransportForPlayer(transport, player);
+                    EverQuest->TransportResyncStats.RecreatesSent++;
+                }
+                else
+                    deferredPlayerGUIDs.push_back(player->GetGUID());
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(PendingResyncMutex);
+        std::unordered_set<ObjectGuid>& deferredPlayerGUIDSet = DeferredResyncPlayerGUIDsByShipEntry[transport->GetEntry()];
+        for (const ObjectGuid& deferredPlayerGUID : deferredPlayerGUIDs)
+            if (deferredPlayerGUIDSet.insert(deferredPlayerGUID).second == true)
+                EverQuest->TransportResyncStats.PlayersDeferred++;
+        if (deferredPlayerGUIDSet.empty() == true)
+            DeferredResyncPlayerGUIDsByShipEntry.erase(transport->GetEntry());
+    }
+
+    void UpdateDeferredTransportResyncs(Transport* transport, uint32 diff)
+    {
+        vector<ObjectGuid> deferredPlayerGUIDs;
+        {
+            std::lock_guard<std::mutex> lock(PendingResyncMutex);
+            auto deferredIt = DeferredResyncPlayerGUIDsByShipEntry.find(transport->GetEntry());
+            if (deferredIt == DeferredResyncPlayerGUIDsByShipEntry.end())
+                return;
+            uint32& checkTimer = DeferredResyncCheckTimerByShipEntry[transport->GetEntry()];
+            checkTimer += diff;
+            if (checkTimer < EQ_SHIP_RESYNC_DEFERRED_CHECK_MS)
+                return;
+            checkTimer = 0;
+            deferredPlayerGUIDs.assign(deferredIt->second.begin(), deferredIt->second.end());
+        }
+
+        // Recreate for anyone who has come into range, and forget anyone who has left the map (they get a fresh create on return anyway)
+        vector<ObjectGuid> finishedPlayerGUIDs;
+        for (const ObjectGuid& deferredPlayerGUID : deferredPlayerGUIDs)
+        {
+            Player* player = ObjectAccessor::GetPlayer(transport->GetMap(), deferredPlayerGUID);
+            if (player == nullptr)
+            {
+                finishedPlayerGUIDs.push_back(deferredPlayerGUID);
+                EverQuest->TransportResyncStats.DeferredPlayersDropped++;
+            }
+            else if (IsPlayerInShipResyncRange(player, transport) == true)
+            {
+                RecreateTransportForPlayer(transport, player);
+                finishedPlayerGUIDs.push_back(deferredPlayerGUID);
+                EverQuest->TransportResyncStats.DeferredRecreatesSent++;
             }
         }
+        if (finishedPlayerGUIDs.empty() == true)
+            return;
+
+        std::lock_guard<std::mutex> lock(PendingResyncMutex);
+        auto deferredIt = DeferredResyncPlayerGUIDsByShipEntry.find(transport->GetEntry());
+        if (deferredIt == DeferredResyncPlayerGUIDsByShipEntry.end())
+            return;
+        for (const ObjectGuid& finishedPlayerGUID : finishedPlayerGUIDs)
+            deferredIt->second.erase(finishedPlayerGUID);
+        if (deferredIt->second.empty() == true)
+        {
+            DeferredResyncPlayerGUIDsByShipEntry.erase(deferredIt);
+            DeferredResyncCheckTimerByShipEntry.erase(transport->GetEntry());
+        }
     }
 
     // Looks up a registered ship and returns it as a MotionTransport, or nullptr if it was never registered
@@ -88,8 +168,9 @@ public:
             return;
 
         // Pause any triggered ships
-        auto waitNodeIt = EverQuest->ShipWaitNodesByGameObjectTemplateEntryID.find(transport->GetEntry());
-        if (waitNodeIt != EverQuest->ShipWaitNodesByGameObjectTemplateEntryID.end() && waypointId == (uint32)waitNodeIt->second)
+        const EverQuestWorldData& worldData = EverQuest->GetWorldData();
+        auto waitNodeIt = worldData.ShipWaitNodesByGameObjectTemplateEntryID.find(transport->GetEntry());
+        if (waitNodeIt != worldData.ShipWaitNodesByGameObjectTemplateEntryID.end() && waypointId == (uint32)waitNodeIt->second)
         {
             MotionTransport* waitingShipMotionTransport = GetRegisteredShipMotionTransport(transport->GetEntry());
             if (waitingShipMotionTransport != nullptr)
@@ -100,12 +181,11 @@ public:
         }
 
         // Trigger any dependent ships
-        for (const EverQuestTransportShipTrigger& shipTrigger : EverQuest->GetShipTriggersForShip(transport->GetEntry()))
+        const EverQuestTransportShipTrigger* reachedShipTriggers = nullptr;
+        size_t reachedShipTriggerCount = EverQuest->GetShipTriggersReachedAtNode(transport, waypointId, reachedShipTriggers);
+        for (size_t triggerIndex = 0; triggerIndex < reachedShipTriggerCount; ++triggerIndex)
         {
-            // Only trigger if a trigger point was reached
-            if (waypointId != shipTrigger.TriggeringNodeID)
-                continue;
-
+            const EverQuestTransportShipTrigger& shipTrigger = reachedShipTriggers[triggerIndex];
             // Get the triggered ship, respawning if needed
             MotionTransport* triggeredShipMotionTransport = GetRegisteredShipMotionTransport(shipTrigger.TriggeredShipGameObjectTemplateEntryID);
             if (triggeredShipMotionTransport == nullptr)
@@ -119,7 +199,7 @@ public:
         }
     }
 
-    void OnUpdate(Transport* transport, uint32 /*diff*/) override
+    void OnUpdate(Transport* transport, uint32 diff) override
     {
         if (EverQuest->IsEnabled == false)
             return;
@@ -127,14 +207,20 @@ public:
             return;
 
         // Force any needed client states
+        bool doResync = false;
         {
             std::lock_guard<std::mutex> lock(PendingResyncMutex);
             auto it = PendingResync.find(transport->GetEntry());
-            if (it == PendingResync.end() || transport->GetGoState() != it->second)
-                return;
-            PendingResync.erase(it);
+            if (it != PendingResync.end() && transport->GetGoState() == it->second)
+            {
+                PendingResync.erase(it);
+                doResync = true;
+            }
         }
-        ForceTransportResyncToPlayers(transport);
+        if (doResync == true)
+            ForceTransportResyncToPlayers(transport);
+        else
+            UpdateDeferredTransportResyncs(transport, diff);
     }
 };
 
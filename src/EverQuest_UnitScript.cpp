@@ -127,6 +127,10 @@ public:
             return;
         if (unit == nullptr)
             return;
+
+        // Rewards for this kill are all paid by now
+        EverQuest->AdvanceZoneWideKillRewardSerial();
+
         Creature* creature = unit->ToCreature();
         if (creature == nullptr)
             return;
@@ -193,6 +197,12 @@ public:
             }
         }
 
+        // Remembered on the caster so its death can clear the crowd control without visiting every player on the map.  Done ahead of
+        // the checks below that return early, since a landed bash or kick stun is crowd control too.  Auras those checks strip again
+        // just leave a stale entry that finds nothing to remove
+        if (unit->IsPlayer() == true)
+            EverQuest->TrackCreatureCrowdControlOnPlayerAuraApply(unit->ToPlayer(), aura);
+
         if (TryHandleBashKickStunChance(unit, aura) == true)
             return;
 
@@ -242,28 +252,7 @@ public:
         }
 
         if (EverQuest->IsSpellAnEQBardSong(spellID) == true && EverQuest->ConfigBardMaxConcurrentSongs != 0)
-        {
-            // Only the lookup needs the lock; the queue itself is only touched by this player's own thread
-            deque<uint32>* queue = nullptr;
-            {
-                std::lock_guard<std::mutex> lock(EverQuest->RuntimeStateMutex);
-                queue = &EverQuest->PlayerCasterConcurrentBardSongs[player->GetGUID()];
-            }
-
-            // Refresh the cast
-            auto it = std::find(queue->begin(), queue->end(), spellID);
-            if (it != queue->end())
-                queue->erase(it);
-            queue->push_back(spellID);
-
-            // Enforce a limit
-            while (queue->size() > EverQuest->ConfigBardMaxConcurrentSongs)
-            {
-                uint32 oldest = queue->front();
-                queue->pop_front();
-                player->RemoveAurasDueToSpell(oldest);
-            }
-        }
+            EverQuest->RefreshConcurrentBardSongForPlayer(player, spellID);
     }
 
     void OnAuraRemove(Unit* unit, AuraApplication* aurApp, AuraRemoveMode mode) override
@@ -319,21 +308,7 @@ public:
 
                 // Concurrence restrict
                 if (EverQuest->ConfigBardMaxConcurrentSongs != 0)
-                {
-                    deque<uint32>* queue = nullptr;
-                    {
-                        std::lock_guard<std::mutex> lock(EverQuest->RuntimeStateMutex);
-                        auto queueIt = EverQuest->PlayerCasterConcurrentBardSongs.find(player->GetGUID());
-                        if (queueIt != EverQuest->PlayerCasterConcurrentBardSongs.end())
-                            queue = &queueIt->second;
-                    }
-                    if (queue != nullptr)
-                    {
-                        auto it = std::find(queue->begin(), queue->end(), spellID);
-                        if (it != queue->end())
-                            queue->erase(it);
-                    }
-                }
+                    EverQuest->RemoveConcurrentBardSongForPlayer(player, spellID);
             }
         }
     }
@@ -0,0 +1,681 @@
+//  Author: Nathan Handley (nathanhandley@protonmail.com)
+//  Copyright (c) 2026 Nathan Handley
+//
+//  This program is free software; you can redistribute it and/or modify it
+//  under the terms of the GNU Affero General Public License as published by the
+//  Free Software Foundation; either version 3 of the License, or (at your
+//  option) any later version.
+//
+//  This program is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.See the GNU Affero General Public License for
+//  more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "DatabaseEnv.h"
+#include "Log.h"
+
+#include "EverQuest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <typeinfo>
+
+using namespace std;
+
+// Every world table the snapshot is built from.  Their checksums key the snapshot, so a change to any of them forces a reload from the database
+static const char* const WorldDataSnapshotSourceTables[] = {
+    "mod_everquest_classmap", "mod_everquest_creature", "mod_everquest_creature_spawn_point", "mod_everquest_creature_kill_spawn",
+    "mod_everquest_creature_emote", "mod_everquest_creature_movement_sound", "mod_everquest_creature_onkill_reputation",
+    "mod_everquest_item_template", "mod_everquest_item_wow_to_eq_swap", "mod_everquest_spell", "mod_everquest_illusion_display",
+    "mod_everquest_illusion_face", "mod_everquest_quest_complete_reputation", "mod_everquest_quest_reaction",
+    "mod_everquest_gossip_reaction", "mod_everquest_pet", "mod_everquest_pet_silent_display", "mod_everquest_playercreateinfo",
+    "mod_everquest_creature_loot", "mod_everquest_transport_trigger", "mod_everquest_creature_instance",
+    "mod_everquest_creature_waypoint", "mod_everquest_playerautolearnskills", "mod_everquest_playerautolearnspells",
+    "mod_everquest_forage_zone_items", "mod_everquest_zone_safe_point", "mod_everquest_zone", "mod_everquest_faction"
+};
+
+static uint64 HashSnapshotBytes(uint64 hash, const void* bytes, size_t byteCount)
+{
+    // 64-bit FNV-1a
+    const uint8* byteData = static_cast<const uint8*>(bytes);
+    for (size_t byteIndex = 0; byteIndex < byteCount; ++byteIndex)
+    {
+        hash ^= byteData[byteIndex];
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+// Appends every field in a fixed order.  Unordered containers are written in key order, so the same tables always give the same bytes
+class EverQuestSnapshotWriter
+{
+public:
+    string Buffer;
+
+    template<typename... T>
+    void Fields(T&... values) { (Field(values), ...); }
+
+    template<typename... T>
+    void Skip(T&... /*values*/) {}
+
+    template<typename T>
+    void Field(T& value)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            uint8 byteValue = value == true ? 1 : 0;
+            Buffer.append(reinterpret_cast<const char*>(&byteValue), sizeof(byteValue));
+        }
+        else if constexpr (std::is_arithmetic_v<T>)
+            Buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        else
+            SnapshotFields(*this, value);
+    }
+
+    void Field(string& value)
+    {
+        WriteCount(value.size());
+        Buffer.append(value);
+    }
+
+    template<typename T>
+    void Field(vector<T>& values) { WriteSequence(values); }
+
+    template<typename T>
+    void Field(list<T>& values) { WriteSequence(values); }
+
+    template<typename K, typename V>
+    void Field(map<K, V>& values) { WriteSequence(values); }
+
+    template<typename K>
+    void Field(unordered_set<K>& values)
+    {
+        vector<K> sortedValues(values.begin(), values.end());
+        std::sort(sortedValues.begin(), sortedValues.end());
+        WriteSequence(sortedValues);
+    }
+
+    template<typename K, typename V>
+    void Field(unordered_map<K, V>& values)
+    {
+        vector<std::pair<K, V*>> sortedEntries;
+        sortedEntries.reserve(values.size());
+        for (auto& entry : values)
+            sortedEntries.emplace_back(entry.first, &entry.second);
+        std::sort(sortedEntries.begin(), sortedEntries.end(), [](const std::pair<K, V*>& a, const std::pair<K, V*>& b) { return a.first < b.first; });
+        WriteCount(sortedEntries.size());
+        for (auto& entry : sortedEntries)
+        {
+            Field(entry.first);
+            Field(*entry.second);
+        }
+    }
+
+private:
+    void WriteCount(size_t count)
+    {
+        uint32 count32 = uint32(count);
+        Field(count32);
+    }
+
+    template<typename C>
+    void WriteSequence(C& values)
+    {
+        WriteCount(values.size());
+        for (auto& value : values)
+            WriteElement(value);
+    }
+
+    template<typename T>
+    void WriteElement(T& value) { Field(value); }
+
+    template<typename K, typename V>
+    void WriteElement(std::pair<const K, V>& entry)
+    {
+        K key = entry.first;
+        Field(key);
+        Field(entry.second);
+    }
+};
+
+// Reads fields back in the order the writer put them.  Any read past the end marks the whole snapshot as failed rather than throwing
+class EverQuestSnapshotReader
+{
+public:
+    const char* Data = nullptr;
+    size_t Size = 0;
+    size_t Offset = 0;
+    bool Failed = false;
+
+    template<typename... T>
+    void Fields(T&... values) { (Field(values), ...); }
+
+    template<typename... T>
+    void Skip(T&... /*values*/) {}
+
+    template<typename T>
+    void Field(T& value)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            uint8 byteValue = 0;
+            ReadBytes(&byteValue, sizeof(byteValue));
+            value = byteValue != 0;
+        }
+        else if constexpr (std::is_arithmetic_v<T>)
+            ReadBytes(&value, sizeof(value));
+        else
+            SnapshotFields(*this, value);
+    }
+
+    void Field(string& value)
+    {
+        uint32 length = ReadCount();
+        if (Failed == true)
+            return;
+        value.assign(Data + Offset, length);
+        Offset += length;
+    }
+
+    template<typename T>
+    void Field(vector<T>& values)
+    {
+        values.clear();
+        uint32 count = ReadCount();
+        values.reserve(count);
+        for (uint32 i = 0; i < count && Failed == false; ++i)
+            Field(values.emplace_back());
+    }
+
+    template<typename T>
+    void Field(list<T>& values)
+    {
+        values.clear();
+        uint32 count = ReadCount();
+        for (uint32 i = 0; i < count && Failed == false; ++i)
+            Field(values.emplace_back());
+    }
+
+    template<typename K>
+    void Field(unordered_set<K>& values)
+    {
+        values.clear();
+        uint32 count = ReadCount();
+        for (uint32 i = 0; i < count && Failed == false; ++i)
+        {
+            K value = K();
+            Field(value);
+            values.insert(value);
+        }
+    }
+
+    template<typename K, typename V>
+    void Field(map<K, V>& values) { ReadMap(values); }
+
+    template<typename K, typename V>
+    void Field(unordered_map<K, V>& values) { ReadMap(values); }
+
+private:
+    void ReadBytes(void* destination, size_t byteCount)
+    {
+        if (Failed == true || Size - Offset < byteCount)
+        {
+            Failed = true;
+            return;
+        }
+        memcpy(destination, Data + Offset, byteCount);
+        Offset += byteCount;
+    }
+
+    // Every element takes at least one byte, so a count larger than what's left can only come from a corrupt file
+    uint32 ReadCount()
+    {
+        uint32 count = 0;
+        ReadBytes(&count, sizeof(count));
+        if (Failed == false && count > Size - Offset)
+            Failed = true;
+        return Failed == true ? 0 : count;
+    }
+
+    template<typename M>
+    void ReadMap(M& values)
+    {
+        values.clear();
+        uint32 count = ReadCount();
+        for (uint32 i = 0; i < count && Failed == false; ++i)
+        {
+            typename M::key_type key = typename M::key_type();
+            Field(key);
+            Field(values[key]);
+        }
+    }
+};
+
+// Checks every field list against the layout of its class, since the writer and the reader share the lists and a round trip can't see a field
+// that neither of them knows about.  Listed (or skipped) fields are laid end to end in offset order, and any stretch between them wider than the
+// alignment padding the next one needs is a field the list is missing.  Row classes reached through containers are checked on a default copy.
+// The one thing it can't tell apart is a last field small enough to pass for the class's own tail padding
+class EverQuestSnapshotCoverageChecker
+{
+public:
+    vector<string> Problems;
+
+    template<typename... T>
+    void Fields(T&... values) { (Field(values), ...); }
+
+    template<typename... T>
+    void Skip(T&... values) { (RecordRange(values), ...); }
+
+    template<typename T>
+    void Field(T& value)
+    {
+        RecordRange(value);
+        CheckValue(value);
+    }
+
+    template<typename T, typename L>
+    void CheckClass(T& value, L listFields)
+    {
+        Frames.emplace_back();
+        Frames.back().Base = reinterpret_cast<const char*>(&value);
+        Frames.back().Size = sizeof(T);
+        listFields();
+        vector<FieldRange> ranges = std::move(Frames.back().Ranges);
+        Frames.pop_back();
+
+        std::sort(ranges.begin(), ranges.end(), [](const FieldRange& a, const FieldRange& b) { return a.Offset < b.Offset; });
+        size_t endOffset = 0;
+        for (const FieldRange& range : ranges)
+        {
+            if (range.Offset != AlignUp(endOffset, range.Alignment))
+                Problems.push_back(fmt::format("{} has {} unlisted bytes before offset {}", typeid(T).name(), range.Offset > endOffset ? range.Offset - endOffset : 0, range.Offset));
+            endOffset = std::max(endOffset, range.Offset + range.Size);
+        }
+        if (AlignUp(endOffset, alignof(T)) != sizeof(T))
+            Problems.push_back(fmt::format("{} has {} unlisted bytes after offset {}", typeid(T).name(), sizeof(T) - endOffset, endOffset));
+    }
+
+private:
+    struct FieldRange
+    {
+        size_t Offset = 0;
+        size_t Size = 0;
+        size_t Alignment = 1;
+    };
+
+    struct ClassFrame
+    {
+        const char* Base = nullptr;
+        size_t Size = 0;
+        vector<FieldRange> Ranges;
+    };
+
+    vector<ClassFrame> Frames;
+
+    static size_t AlignUp(size_t offset, size_t alignment) { return (offset + alignment - 1) / alignment * alignment; }
+
+    template<typename T>
+    void RecordRange(T& value)
+    {
+        if (Frames.empty() == true)
+            return;
+        const char* address = reinterpret_cast<const char*>(&value);
+        ClassFrame& frame = Frames.back();
+        if (address < frame.Base || address >= frame.Base + frame.Size)
+            return;
+        frame.Ranges.push_back({ size_t(address - frame.Base), sizeof(T), alignof(T) });
+    }
+
+    template<typename T>
+    void CheckValueType()
+    {
+        T value = T();
+        CheckValue(value);
+    }
+
+    template<typename T>
+    void CheckValue(T& value)
+    {
+        if constexpr (std::is_arithmetic_v<T> == false)
+            CheckClass(value, [this, &value]() { SnapshotFields(*this, value); });
+    }
+
+    void CheckValue(string& /*value*/) {}
+
+    template<typename T>
+    void CheckValue(vector<T>& /*values*/) { CheckValueType<T>(); }
+
+    template<typename T>
+    void CheckValue(list<T>& /*values*/) { CheckValueType<T>(); }
+
+    template<typename K>
+    void CheckValue(unordered_set<K>& /*values*/) { CheckValueType<K>(); }
+
+    template<typename K, typename V>
+    void CheckValue(map<K, V>& /*values*/)
+    {
+        CheckValueType<K>();
+        CheckValueType<V>();
+    }
+
+    template<typename K, typename V>
+    void CheckValue(unordered_map<K, V>& /*values*/)
+    {
+        CheckValueType<K>();
+        CheckValueType<V>();
+    }
+};
+
+// Field lists for every row class in the snapshot.  A field added to one of these classes has to be added here, and EQ_WORLD_DATA_SNAPSHOT_VERSION bumped
+template<class A> static void SnapshotFields(A& a, EverQuestClassMap& v) { a.Fields(v.WOWClassID, v.EQClassIDBase, v.EQClassIDDefaultSecond, v.EQClassIDEligibleSecondMask); }
+template<class A> static void SnapshotFields(A& a, EverQuestCreature& v)
+{
+    a.Fields(v.CreatureTemplateID, v.CanShowHeldLootItems, v.CanShowHeldLootShields, v.SpawnLimit, v.RangedAttackEnabled, v.RangedAttackMinRange, v.RangedAttackMaxRange,
+        v.RangedAttackDamageModPct, v.AgroSocialDistanceMod, v.EnrageEnabled, v.EnrageHPPct, v.EnrageDurationInMS, v.EnrageCooldownInMS, v.FlurryEnabled, v.FlurryChancePct,
+        v.RampageEnabled, v.RampageChancePct, v.RampageRange, v.RampageDamagePct, v.WildRampageEnabled, v.WildRampageChancePct, v.WildRampageMaxTargets,
+        v.WildRampageDamagePct, v.AttackRoundTimeInMS, v.DifficultyType);
+}
+template<class A> static void SnapshotFields(A& a, EverQuestCreatureSpawnPoint& v)
+{
+    a.Fields(v.CreatureGUID, v.MapID, v.SpawnPointID, v.SpawnGroupID, v.SpawnGroupLimit, v.CycleRespawnTimeSec, v.CycleChance);
+}
+template<class A> static void SnapshotFields(A& a, EverQuestCycleSpawnCandidate& v) { a.Fields(v.CreatureGUID, v.Chance); }
+template<class A> static void SnapshotFields(A& a, EverQuestCycleSpawnGroup& v) { a.Fields(v.MapID, v.SpawnGroupID, v.SpawnGroupLimit, v.CycleRespawnTimeSec, v.CandidatesBySpawnPointID); }
+template<class A> static void SnapshotFields(A& a, EverQuestCreatureKillSpawn& v)
+{
+    a.Fields(v.ID, v.TriggerCreatureTemplateID, v.TriggerTypeID, v.MapID, v.ActionType, v.TargetCreatureTemplateID, v.Chance, v.AltGroup, v.AltID, v.AltWeight,
+        v.SpawnAtCorpse, v.PositionX, v.PositionY, v.PositionZ, v.Orientation, v.DelayMinMS, v.DelayMaxMS, v.OnlyIfNotAliveCreatureTemplateID,
+        v.RequireDeadCreatureTemplateIDs, v.RequireAliveCreatureTemplateIDs, v.AddToHateList, v.TriggerMinLevel, v.TriggerMaxLevel, v.RespawnTimeSec,
+        v.TargetSpawnIDsByMapID);
+}
+template<class A> static void SnapshotFields(A& a, EverQuestCreatureEmote& v) { a.Fields(v.EventType, v.EmoteType, v.ChancePct, v.Param1, v.Param2, v.EmoteText); }
+template<class A> static void SnapshotFields(A& a, EverQuestCreatureMovementSound& v)
+{
+    a.Fields(v.WalkPieceSoundEntryIDs, v.WalkPieceDurationsMS, v.RunPieceSoundEntryIDs, v.RunPieceDurationsMS, v.MaxHearingDistance);
+}
+template<class A> static void SnapshotFields(A& a, EverQuestCreatureOnkillReputation& v) { a.Fields(v.CreatureTemplateID, v.SortOrder, v.FactionID, v.KillRewardValue); }
+template<class A> static void SnapshotFields(A& a, EverQuestItemTemplate& v)
+{
+    a.Fields(v.ItemTemplateEntryID, v.ItemTemplateEntryIDForNPCEquip, v.WornEffectSpellID, v.AllowedEQClassMask, v.EQArmorMaterial, v.IllusionTintID);
+}
+template<class A> static void SnapshotFields(A& a, EverQuestGearSwapCandidate& v) { a.Fields(v.ItemTemplateID, v.ItemDisplayID); }
+template<class A> static void SnapshotFields(A& a, EverQuestSpell& v)
+{
+    a.Fields(v.SpellID, v.AuraDurationBaseInMS, v.AuraDurationAddPerLevelInMS, v.AuraDurationMaxInMS, v.AuraDurationCalcMinLevel, v.AuraDurationCalcMaxLevel,
+        v.RecourseSpellID, v.SpellIDCastOnMeleeAttacker, v.FocusBoostType, v.PeriodicAuraSpellID, v.PeriodicAuraSpellRadius, v.MaleFormSpellID, v.FemaleFormSpellID,
+        v.EffectFailChancePercent, v.EffectFailableType, v.StunUsesBashKickChance, v.SpellIDCastOnTargetWhenStunLands, v.AuraStaysOnSecondaryClassSwitch,
+        v.MinTargetLevel, v.MaxCreatureTargetLevel, v.ResistDiff, v.HasteType, v.ModFactionRepValue, v.IllusionFormAlignment, v.IllusionFormEQRaceID,
+        v.PersistOnClassChange);
+}
+template<class A> static void SnapshotFields(A& a, EverQuestQuestCompletionReputation& v) { a.Fields(v.QuestTemplateID, v.SortOrder, v.FactionID, v.CompletionRewardValue); }
+template<class A> static void SnapshotFields(A& a, EverQuestQuestReaction& v)
+{
+    a.Fields(v.ID, v.QuestTemplateID, v.ReactionType, v.UsePlayerX, v.UsePlayerY, v.UsePlayerZ, v.AddedPlayerX, v.AddedPlayerY, v.UsePlayerOrientation,
+        v.PositionX, v.PositionY, v.PositionZ, v.Orientation, v.CreatureTemplateID, v.QuestgiverCreatureTemplateID, v.DelayInMS);
+}
+template<class A> static void SnapshotFields(A& a, EverQuestGossipReaction& v)
+{
+    a.Fields(v.GossipCreatureTemplateID, v.NpcTextID, v.OptionID, v.OptionText, v.ReactionType, v.SayText, v.TargetCreatureTemplateID, v.UsePlayerX, v.UsePlayerY,
+        v.UsePlayerZ, v.AddedPlayerX, v.AddedPlayerY, v.UsePlayerOrientation, v.UseNpcX, v.UseNpcY, v.UseNpcZ, v.UseNpcOrientation, v.PositionX, v.PositionY,
+        v.PositionZ, v.Orientation, v.DelayInMS);
+}
+template<class A> static void SnapshotFields(A& a, EverQuestPet& v)
+{
+    a.Fields(v.CreatingSpellID, v.NamingType, v.CreatureTemplateID, v.SummonPropertiesID, v.MainhandItemTemplateID, v.OffhandItemTemplateID);
+}
+template<class A> static void SnapshotFields(A& a, EverQuestPlayerCreateInfo& v)
+{
+    a.Fields(v.RaceID, v.ClassID, v.MapID, v.ZoneID, v.PositionX, v.PositionY, v.PositionZ, v.Orientation, v.IllusionItemID);
+}
+template<class A> static void SnapshotFields(A& a, EverQuestCreatureLootEntry& v) { a.Fields(v.ItemTemplateID, v.Chance, v.ItemMultiplier, v.ItemCharges); }
+template<class A> static void SnapshotFields(A& a, EverQuestCreatureLootGroup& v)
+{
+    a.Fields(v.LootGroupID, v.GroupMultiplier, v.GroupMultiplierMin, v.GroupProbability, v.DropLimit, v.MinDrop, v.Entries);
+}
+template<class A> static void SnapshotFields(A& a, EverQuestTransportShipTrigger& v)
+{
+    a.Fields(v.TriggeringShipGameObjectEntryTemplateID, v.TriggeredShipGameObjectTemplateEntryID, v.TriggeringNodeID, v.TriggerActivateNodeID);
+}
+template<class A> static void SnapshotFields(A& a, EverQuestCreatureInstance& v)
+{
+    a.Fields(v.CreatureGUID, v.WanderType, v.PauseType, v.MapID, v.WaypointListID, v.DoesRoam, v.RoamMinX, v.RoamMaxX, v.RoamMinY, v.RoamMaxY, v.RoamMinZ, v.RoamMaxZ,
+        v.RoamMinDelayInMS, v.RoamMaxDelayInMS, v.DespawnAtWaypointNum, v.DisableGroundContour);
+}
+template<class A> static void SnapshotFields(A& a, EverQuestCreatureWaypoint& v) { a.Fields(v.MapID, v.WaypointID, v.Number, v.X, v.Y, v.Z, v.PauseInSec); }
+template<class A> static void SnapshotFields(A& a, EverQuestCreatureWaypointSet& v)
+{
+    a.Fields(v.Waypoints, v.IndexMinX, v.IndexMinY, v.IndexCellSize, v.IndexCellCountX, v.IndexCellCountY, v.IndexCellStarts, v.IndexWaypointIndexes);
+}
+template<class A> static void SnapshotFields(A& a, EverQuestAutoLearnSpell& v) { a.Fields(v.EQClassID, v.RaceID, v.SpellID, v.Level); }
+template<class A> static void SnapshotFields(A& a, EverQuestForageZoneItem& v) { a.Fields(v.MapID, v.ItemTemplateID, v.Chance, v.ForageType); }
+template<class A> static void SnapshotFields(A& a, EverQuestZoneSafePoint& v) { a.Fields(v.MapID, v.X, v.Y, v.Z, v.Orientation); }
+template<class A> static void SnapshotFields(A& a, EverQuestZone& v) { a.Fields(v.MapID, v.AllowBind, v.ExpansionID, v.MaxAgroZDistance, v.InstanceRaidLowMapID); }
+template<class A> static void SnapshotFields(A& a, EverQuestFaction& v)
+{
+    a.Fields(v.FactionTemplateID, v.FactionID, v.BaseAlignment, v.PredominantEQRaceID, v.WillDefendFriendlyPlayers, v.DefendersWillAttackToDefendPlayer,
+        v.DefendCombatFactionTemplateID);
+}
+
+// Everything the loaders fill, in loader order.  The tables resolved against the DBC stores after the load are left out, as they are rebuilt every time
+template<class A> static void SnapshotWorldDataTables(A& a, EverQuestWorldData& worldData)
+{
+    a.Fields(worldData.ClassMapByWOWClassID);
+    a.Fields(worldData.CreaturesByTemplateID);
+    a.Fields(worldData.CreatureSpawnPointsByCreatureGUID, worldData.CycleSpawnGroupsByMapIDThenSpawnGroupID);
+    a.Fields(worldData.CreatureKillSpawnsByTriggerCreatureTemplateID, worldData.EvadeKillSpawnTriggerCreatureTemplateIDs, worldData.OocTimerKillSpawnDurationMSByCreatureTemplateID);
+    a.Fields(worldData.CreatureEmotesByCreatureTemplateID);
+    a.Fields(worldData.CreatureMovementSoundsByDisplayID);
+    a.Fields(worldData.CreatureOnkillReputationsByCreatureTemplateID);
+    a.Fields(worldData.ItemTemplatesByEntryID, worldData.ItemEQClassMaskBaseItemTemplateID, worldData.ItemEQClassMasksByItemTemplateIDOffset, worldData.WornEffectSpellIDs);
+    a.Fields(worldData.GearSwapCandidatesByLookupKey);
+    a.Fields(worldData.SpellDataBySpellID, worldData.BardSongTickSpellIDs);
+    a.Fields(worldData.IllusionDisplayIDsByLookupKey, worldData.IllusionFormSpellIDs);
+    a.Fields(worldData.IllusionFaceDisplayIDsByLookupKey, worldData.IllusionMaxFaceIndex);
+    a.Fields(worldData.QuestCompletionReputationsByQuestTemplateID);
+    a.Fields(worldData.QuestReactionListByQuestTemplateID);
+    a.Fields(worldData.GossipReactionsByGossipCreatureTemplateID);
+    a.Fields(worldData.PetDataByCreatureTemplateID);
+    a.Fields(worldData.SilentFidgetDisplayIDsByDisplayID);
+    a.Fields(worldData.PlayerCreateInfoByRaceIDThenClassID);
+    a.Fields(worldData.CreatureLootGroupsByCreatureTemplateID);
+    a.Fields(worldData.ShipTriggersByTriggeringGameObjectTemplateEntryID, worldData.ShipWaitNodesByGameObjectTemplateEntryID);
+    a.Fields(worldData.CreatureInstancesByCreatureGUID);
+    a.Fields(worldData.CreatureWaypointSetsByMapIDAndWaypointID);
+    a.Fields(worldData.PlayerAutoLearnSkillsByEQClassID);
+    a.Fields(worldData.PlayerAutoLearnSpellsByClassID);
+    a.Fields(worldData.ForageZoneItemsByMapID, worldData.ForageZoneItemTotalChanceByMapID);
+    a.Fields(worldData.ZoneSafePointByMapID);
+    a.Fields(worldData.ZoneByMapID, worldData.InstanceRaidLowMapIDs, worldData.OpenWorldMapIDByInstanceRaidLowMapID);
+    a.Fields(worldData.FactionsByFactionTemplateID);
+
+    // Rebuilt from the loaded factions and the DBC stores after every load, snapshot or not
+    a.Skip(worldData.DefendCombatFactionTemplateIDs, worldData.EQReputationFactionInfoByFactionID);
+}
+
+uint64 EverQuestMod::GetWorldDataSourceChecksum()
+{
+    string checksumQuery = "CHECKSUM TABLE ";
+    for (size_t tableIndex = 0; tableIndex < std::size(WorldDataSnapshotSourceTables); ++tableIndex)
+    {
+        if (tableIndex > 0)
+            checksumQuery += ", ";
+        checksumQuery += WorldDataSnapshotSourceTables[tableIndex];
+    }
+
+    // A missing table comes back with a NULL checksum, which still changes the combined hash
+    QueryResult queryResult = WorldDatabase.Query(checksumQuery);
+    if (!queryResult)
+        return 0;
+    uint64 sourceChecksum = 0xCBF29CE484222325ULL;
+    do
+    {
+        Field* fields = queryResult->Fetch();
+        string tableName = fields[0].Get<string>();
+        uint64 tableChecksum = fields[1].IsNull() == true ? 0 : fields[1].Get<uint64>();
+        sourceChecksum = HashSnapshotBytes(sourceChecksum, tableName.data(), tableName.size());
+        sourceChecksum = HashSnapshotBytes(sourceChecksum, &tableChecksum, sizeof(tableChecksum));
+    } while (queryResult->NextRow());
+    return sourceChecksum;
+}
+
+void EverQuestMod::SerializeWorldDataTables(EverQuestWorldData& worldData, string& payloadOut)
+{
+    EverQuestSnapshotWriter snapshotWriter;
+    SnapshotWorldDataTables(snapshotWriter, worldData);
+    payloadOut.swap(snapshotWriter.Buffer);
+}
+
+bool EverQuestMod::DeserializeWorldDataTables(const string& payload, EverQuestWorldData& worldData)
+{
+    EverQuestSnapshotReader snapshotReader;
+    snapshotReader.Data = payload.data();
+    snapshotReader.Size = payload.size();
+    SnapshotWorldDataTables(snapshotReader, worldData);
+    return snapshotReader.Failed == false && snapshotReader.Offset == snapshotReader.Size;
+}
+
+bool EverQuestMod::ReadWorldDataSnapshotFile(const string& snapshotFilePath, uint64 sourceChecksum, string& payloadOut)
+{
+    std::ifstream snapshotFile(snapshotFilePath, std::ios::binary | std::ios::ate);
+    if (snapshotFile.is_open() == false)
+    {
+        LOG_INFO("module.EverQuest", "EverQuestMod::ReadWorldDataSnapshotFile found no world data snapshot at '{}', so the tables will load from the database", snapshotFilePath);
+        return false;
+    }
+
+    // The whole file is read in one go, then parsed straight out of the buffer
+    string fileBytes;
+    fileBytes.resize(size_t(snapshotFile.tellg()));
+    snapshotFile.seekg(0);
+    snapshotFile.read(fileBytes.data(), fileBytes.size());
+    if (snapshotFile.good() == false || fileBytes.size() < EQ_WORLD_DATA_SNAPSHOT_HEADER_SIZE)
+    {
+        LOG_ERROR("module.EverQuest", "EverQuestMod::ReadWorldDataSnapshotFile could not read '{}', so the tables will load from the database", snapshotFilePath);
+        return false;
+    }
+    uint32 magic = 0;
+    uint32 version = 0;
+    uint32 modVersion = 0;
+    uint64 fileSourceChecksum = 0;
+    uint64 payloadHash = 0;
+    memcpy(&magic, fileBytes.data(), sizeof(magic));
+    memcpy(&version, fileBytes.data() + 4, sizeof(version));
+    memcpy(&modVersion, fileBytes.data() + 8, sizeof(modVersion));
+    memcpy(&fileSourceChecksum, fileBytes.data() + 12, sizeof(fileSourceChecksum));
+    memcpy(&payloadHash, fileBytes.data() + 20, sizeof(payloadHash));
+    if (magic != EQ_WORLD_DATA_SNAPSHOT_MAGIC || version != EQ_WORLD_DATA_SNAPSHOT_VERSION || modVersion != EQ_MOD_VERSION)
+    {
+        LOG_INFO("module.EverQuest", "EverQuestMod::ReadWorldDataSnapshotFile found '{}' was written by another build, so the tables will load from the database", snapshotFilePath);
+        return false;
+    }
+    if (fileSourceChecksum != sourceChecksum)
+    {
+        LOG_INFO("module.EverQuest", "EverQuestMod::ReadWorldDataSnapshotFile found the world tables changed since '{}' was written, so the tables will load from the database", snapshotFilePath);
+        return false;
+    }
+    payloadOut = fileBytes.substr(EQ_WORLD_DATA_SNAPSHOT_HEADER_SIZE);
+    if (HashSnapshotBytes(0xCBF29CE484222325ULL, payloadOut.data(), payloadOut.size()) != payloadHash)
+    {
+        LOG_ERROR("module.EverQuest", "EverQuestMod::ReadWorldDataSnapshotFile found '{}' corrupt, so the tables will load from the database", snapshotFilePath);
+        return false;
+    }
+    return true;
+}
+
+bool EverQuestMod::LoadWorldDataSnapshot(const string& snapshotFilePath, uint64 sourceChecksum, EverQuestWorldData& worldData)
+{
+    std::chrono::steady_clock::time_point loadStartTime = std::chrono::steady_clock::now();
+    string payload;
+    if (ReadWorldDataSnapshotFile(snapshotFilePath, sourceChecksum, payload) == false)
+        return false;
+    if (DeserializeWorldDataTables(payload, worldData) == false)
+    {
+        LOG_ERROR("module.EverQuest", "EverQuestMod::LoadWorldDataSnapshot could not parse '{}', so the tables will load from the database", snapshotFilePath);
+        return false;
+    }
+
+    uint64 loadTimeInUS = (uint64)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - loadStartTime).count();
+    LOG_INFO("module.EverQuest", "EverQuestMod::LoadWorldDataSnapshot loaded the world tables from '{}' ({} bytes) in {:.1f} ms", snapshotFilePath,
+        payload.size(), (double)loadTimeInUS / 1000.0);
+    return true;
+}
+
+bool EverQuestMod::WriteWorldDataSnapshot(const string& snapshotFilePath, uint64 sourceChecksum, EverQuestWorldData& worldData)
+{
+    // A field missing from a list would read back as its default without the round trip below noticing, so the lists are checked first
+    EverQuestSnapshotCoverageChecker coverageChecker;
+    coverageChecker.CheckClass(worldData, [&coverageChecker, &worldData]() { SnapshotWorldDataTables(coverageChecker, worldData); });
+    if (coverageChecker.Problems.empty() == false)
+    {
+        for (const string& problem : coverageChecker.Problems)
+            LOG_ERROR("module.EverQuest", "EverQuestMod::WriteWorldDataSnapshot field lists don't cover their classes: {}", problem);
+        LOG_ERROR("module.EverQuest", "EverQuestMod::WriteWorldDataSnapshot did not write '{}', so the tables will keep loading from the database", snapshotFilePath);
+        std::remove(snapshotFilePath.c_str());
+        return false;
+    }
+
+    string payload;
+    SerializeWorldDataTables(worldData, payload);
+
+    // Written to the side and then swapped in, so a crash mid-write never leaves a torn file for the next startup
+    string tempFilePath = snapshotFilePath + ".tmp";
+    {
+        std::ofstream snapshotFile(tempFilePath, std::ios::binary | std::ios::trunc);
+        if (snapshotFile.is_open() == false)
+        {
+            LOG_ERROR("module.EverQuest", "EverQuestMod::WriteWorldDataSnapshot could not open '{}' for writing", tempFilePath);
+            return false;
+        }
+        uint32 magic = EQ_WORLD_DATA_SNAPSHOT_MAGIC;
+        uint32 version = EQ_WORLD_DATA_SNAPSHOT_VERSION;
+        uint32 modVersion = EQ_MOD_VERSION;
+        uint64 payloadHash = HashSnapshotBytes(0xCBF29CE484222325ULL, payload.data(), payload.size());
+        snapshotFile.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
+        snapshotFile.write(reinterpret_cast<const char*>(&version), sizeof(version));
+        snapshotFile.write(reinterpret_cast<const char*>(&modVersion), sizeof(modVersion));
+        snapshotFile.write(reinterpret_cast<const char*>(&sourceChecksum), sizeof(sourceChecksum));
+        snapshotFile.write(reinterpret_cast<const char*>(&payloadHash), sizeof(payloadHash));
+        snapshotFile.write(payload.data(), payload.size());
+        if (snapshotFile.good() == false)
+        {
+            LOG_ERROR("module.EverQuest", "EverQuestMod::WriteWorldDataSnapshot failed while writing '{}'", tempFilePath);
+            return false;
+        }
+    }
+    std::remove(snapshotFilePath.c_str());
+    if (std::rename(tempFilePath.c_str(), snapshotFilePath.c_str()) != 0)
+    {
+        LOG_ERROR("module.EverQuest", "EverQuestMod::WriteWorldDataSnapshot could not move '{}' over '{}'", tempFilePath, snapshotFilePath);
+        return false;
+    }
+
+    // Round trip the file the next startup will read into a scratch copy of the tables, and compare every container against the ones
+    // loaded from the database.  A reader that drifted from the writer gets the file thrown out now instead of quietly loading different tables later
+    string reloadedPayload;
+    std::unique_ptr<EverQuestWorldData> roundTripWorldData(new EverQuestWorldData());
+    if (ReadWorldDataSnapshotFile(snapshotFilePath, sourceChecksum, reloadedPayload) == false || DeserializeWorldDataTables(reloadedPayload, *roundTripWorldData) == false)
+    {
+        LOG_ERROR("module.EverQuest", "EverQuestMod::WriteWorldDataSnapshot could not read back '{}', so it was removed", snapshotFilePath);
+        std::remove(snapshotFilePath.c_str());
+        return false;
+    }
+    SerializeWorldDataTables(*roundTripWorldData, reloadedPayload);
+    if (reloadedPayload != payload)
+    {
+        LOG_ERROR("module.EverQuest", "EverQuestMod::WriteWorldDataSnapshot found the tables read back from '{}' differ from the ones loaded from the database, so it was removed", snapshotFilePath);
+        std::remove(snapshotFilePath.c_str());
+        return false;
+    }
+
+    LOG_INFO("module.EverQuest", "EverQuestMod::WriteWorldDataSnapshot wrote and verified '{}' ({} bytes)", snapshotFilePath, payload.size());
+    return true;
+}
@@ -33,12 +33,11 @@ public:
         if (EverQuest->IsEnabled == false)
             return;
 
-        // The data tables below are read lock-free by the map update threads, so rebuilding them on a live
-        // ".reload config" would be a use-after-free for any thread mid-read. Only load them at startup;
-        // a live reload still refreshes the file-based config values above
+        // The data tables below are read lock-free by the map update threads, so a live ".reload config" leaves them alone and
+        // only refreshes the file-based config values above.  ".eqreloaddata" rebuilds them and swaps the new set in safely
         if (reload == true)
         {
-            LOG_INFO("module.EverQuest", "EverQuestMod skipped reloading its data tables (loaded at startup only); file config values were refreshed. Restart the server to apply data table changes.");
+            LOG_INFO("module.EverQuest", "EverQuestMod skipped reloading its data tables; file config values were refreshed. Use .eqreloaddata to apply data table changes.");
             return;
         }
 
@@ -49,34 +48,13 @@ public:
             EverQuest->IsEnabled = false;
             return;
         }
-        EverQuest->LoadClassMapData();
-        EverQuest->LoadCreatureData();
-        EverQuest->LoadCreatureSpawnPoints();
-        EverQuest->LoadCreatureKillSpawnData();
-        EverQuest->LoadCreatureEmoteData();
-        EverQuest->LoadCreatureMovementSoundData();
-        EverQuest->LoadCreatureOnkillReputations();
-        EverQuest->LoadItemTemplateData();
-        EverQuest->LoadItemWoWToEQSwapData();
-        EverQuest->LoadSpellData();
-        EverQuest->LoadIllusionDisplayData();
-        EverQuest->LoadIllusionFaceData();
-        EverQuest->LoadQuestCompletionReputations();
-        EverQuest->LoadQuestReactions();
-        EverQuest->LoadGossipReactions();
-        EverQuest->LoadPetData();
-        EverQuest->LoadPetSilentDisplayData();
-        EverQuest->LoadCreatePlayerData();
-        EverQuest->LoadCreatureLootData();
-        EverQuest->LoadShipTriggerData();
-        EverQuest->LoadCreatureInstanceData();
-        EverQuest->LoadCreatureWaypointData();
-        EverQuest->LoadAutoLearnSkillsData();
-        EverQuest->LoadAutoLearnSpellsData();
-        EverQuest->LoadForageData();
-        EverQuest->LoadZoneSafePointData();
-        EverQuest->LoadZoneData();
-        EverQuest->LoadFactionData();
+
+        // The data tables load concurrently, with the loaders that read another's results declared in the loader list
+        std::unique_ptr<EverQuestWorldData> worldData(new EverQuestWorldData());
+        EverQuest->LoadWorldDataTables(*worldData, EverQuest->ConfigStartupDataSnapshotFile);
+        unordered_map<uint32, unordered_map<uint64, EverQuestCachedWaypointLeg>> bakedWaypointLegs;
+        EverQuest->LoadBakedWaypointLegs(EverQuest->ConfigPathingBakedWaypointLegFile, *worldData, bakedWaypointLegs);
+        EverQuest->PublishWorldData(std::move(worldData), std::move(bakedWaypointLegs));
     }
 
     // The restricted map sweep runs here rather than on a map thread, since it has to look at every online
@@ -89,6 +67,8 @@ public:
         EverQuest->UpdateRestrictedMapPlayerCheck(diff);
         EverQuest->UpdateClientVersionChecks(diff);
         EverQuest->ProcessPendingEquipmentStorageTransactions();
+        EverQuest->ProcessPendingLoginDataLoads();
+        EverQuest->UpdateWorldDataReload();
     }
 
     void OnStartup() override
@@ -96,25 +76,19 @@ public:
         if (EverQuest->IsEnabled == false)
             return;
 
+        // Spell traits back the damage / heal / leech predicates used by the unit and talent scripts, and read the spell store which isn't ready when the config loads
+        EverQuestTalentAlignment->BuildSpellTraits();
+
         // Talent alignment reads Talent.dbc, SkillLineAbility.dbc and the spell store, none of which are ready when the config loads, so it builds here instead
         if (EverQuest->ConfigSpellTalentAlignmentEnabled == true)
             EverQuestTalentAlignment->Load();
 
-        // The creature spawn tables aren't loaded yet when the kill spawn data loads with the config so respawn target spawn points resolve here instead
-        EverQuest->ResolveKillSpawnRespawnTargetSpawnPoints();
+        // The creature spawn tables and the DBC stores aren't loaded yet when the data tables load with the config, so anything resolved against them resolves here instead
+        EverQuest->ResolveStartupWorldDataReferences();
         EverQuest->ResolveVulakRequiredDragonSpawnPoints();
 
         // Saved pet display IDs can become wrong when converted content updates invalide previous display IDs, which crashes the core on pet summon
         EverQuest->FixInvalidCharacterPetModelIDs();
-
-        // The silent pet displays validate against CreatureDisplayInfo.dbc, which isn't loaded when the pet silent display data loads with the config
-        EverQuest->RemoveInvalidPetSilentDisplays();
-
-        // Defend combat faction templates validate against FactionTemplate.dbc, which isn't loaded when the faction data loads with the config
-        EverQuest->ResolveDefendCombatFactionTemplates();
-
-        // The set of reputation-capable EQ factions validates against Faction.dbc, which also isn't loaded when the faction data loads with the config
-        EverQuest->ResolveEQReputationFactions();
     }
 };
 